@@ -258,6 +258,19 @@
     result.representation() %= x.crepresentation();
   }
 
+  template<const ::math::wide_integer::size_t MyWidth2,
+           typename MyLimbType>
+  WIDE_INTEGER_CONSTEXPR void eval_qr(const uintwide_t_backend<MyWidth2, MyLimbType>& x,
+                                      const uintwide_t_backend<MyWidth2, MyLimbType>& y,
+                                            uintwide_t_backend<MyWidth2, MyLimbType>& q,
+                                            uintwide_t_backend<MyWidth2, MyLimbType>& r)
+  {
+    const auto qr = ::math::wide_integer::divmod(x.crepresentation(), y.crepresentation());
+
+    q.representation() = qr.first;
+    r.representation() = qr.second;
+  }
+
   template<const ::math::wide_integer::size_t MyWidth2,
            typename MyLimbType,
            typename IntegralType,
@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2018 - 2022.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <examples/example_uintwide_t.h>
+#include <math/wide_integer/uintwide_t.h>
+
+namespace local_timed_mul_tiers
+{
+  // Time the multiplication at widths on either side of the thresholds
+  // which select schoolbook, Karatsuba, Toom-3 and NTT multiplication.
+  // The time per multiplication normalized by the square of the
+  // limb count drops wherever a faster tier takes over.
+
+  template<const math::wide_integer::size_t Width2>
+  auto timed_mul() -> bool
+  {
+    using big_uint_type = math::wide_integer::uintwide_t<Width2, std::uint32_t, std::allocator<void>>;
+
+    using distribution_type =
+      math::wide_integer::uniform_int_distribution<Width2, std::uint32_t, std::allocator<void>>;
+
+    using random_engine_type =
+      std::linear_congruential_engine<std::uint32_t, UINT32_C(48271), UINT32_C(0), UINT32_C(2147483647)>;
+
+    random_engine_type rng; // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    rng.seed(static_cast<typename random_engine_type::result_type>(std::clock()));
+
+    distribution_type distribution;
+
+    std::vector<big_uint_type> a(8U);
+    std::vector<big_uint_type> b(a.size());
+
+    for(auto i = static_cast<typename std::vector<big_uint_type>::size_type>(0U); i < a.size(); ++i)
+    {
+      a[i] = distribution(rng);
+      b[i] = distribution(rng);
+    }
+
+    std::uint64_t count = 0U;
+    std::size_t   index = 0U;
+
+    long long total_time { }; // NOLINT(google-runtime-int)
+
+    big_uint_type c;
+
+    const std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+    for(;;)
+    {
+      c = a[index] * b[index];
+
+      const std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+      total_time = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+
+      ++count;
+      ++index;
+
+      if(index >= a.size())
+      {
+        index = 0U;
+      }
+
+      if(total_time > 299999)
+      {
+        break;
+      }
+    }
+
+    constexpr auto limbs = static_cast<float>(big_uint_type::number_of_limbs);
+
+    const char* tier =
+      ((big_uint_type::number_of_limbs < big_uint_type::number_of_limbs_karatsuba_threshold)
+        ? "schoolbook"
+        : ((big_uint_type::number_of_limbs < big_uint_type::number_of_limbs_toom3_threshold)
+            ? "karatsuba "
+            : ((big_uint_type::number_of_limbs < big_uint_type::number_of_limbs_ntt_threshold)
+                ? "toom-3    "
+                : "ntt       ")));
+
+    const float us_per_mul = float(static_cast<std::uint32_t>(total_time)) / float(count);
+
+    std::cout << "bits: "
+              << std::setw(7)
+              << std::numeric_limits<big_uint_type>::digits
+              << ", limbs: "
+              << std::setw(5)
+              << big_uint_type::number_of_limbs
+              << ", tier: "
+              << tier
+              << ", us_per_mul: "
+              << std::fixed
+              << std::setprecision(3)
+              << us_per_mul
+              << ", ns_per_limb_squared: "
+              << ((us_per_mul * 1000.0F) / (limbs * limbs))
+              << std::endl;
+
+    return ((us_per_mul > (std::numeric_limits<float>::min)()) && (c != 0U));
+  }
+} // namespace local_timed_mul_tiers
+
+auto math::wide_integer::example009c_timed_mul_tiers() -> bool
+{
+  bool result_is_ok = true;
+
+  result_is_ok &= local_timed_mul_tiers::timed_mul<size_t(UINT32_C(  2048))>();
+  result_is_ok &= local_timed_mul_tiers::timed_mul<size_t(UINT32_C(  4096))>();
+  result_is_ok &= local_timed_mul_tiers::timed_mul<size_t(UINT32_C(  8192))>();
+  result_is_ok &= local_timed_mul_tiers::timed_mul<size_t(UINT32_C( 16384))>();
+  result_is_ok &= local_timed_mul_tiers::timed_mul<size_t(UINT32_C( 32768))>();
+  result_is_ok &= local_timed_mul_tiers::timed_mul<size_t(UINT32_C( 65536))>();
+  result_is_ok &= local_timed_mul_tiers::timed_mul<size_t(UINT32_C(131072))>();
+  result_is_ok &= local_timed_mul_tiers::timed_mul<size_t(UINT32_C(262144))>();
+
+  return result_is_ok;
+}
+
+// Enable this if you would like to activate this main() as a standalone example.
+#if 0
+
+int main()
+{
+  const bool result_is_ok = wide_integer::example009c_timed_mul_tiers();
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+}
+
+#endif
@@ -0,0 +1,311 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2018 - 2022.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <examples/example_uintwide_t.h>
+#include <math/wide_integer/uintwide_t.h>
+
+namespace local_calibrate_thresholds
+{
+  // Measure the crossovers between the multiplication algorithms
+  // on the host and print specializations of multiplication_thresholds
+  // which can be used with WIDE_INTEGER_MULTIPLICATION_THRESHOLDS_HEADER.
+  // Each crossover is measured with the other thresholds held
+  // at their default values.
+
+  using math::wide_integer::size_t;
+
+  template<const size_t KaratsubaThreshold,
+           const size_t Toom3Threshold,
+           const size_t NttThreshold,
+           const size_t KaratsubaBase>
+  struct policy
+  {
+    static constexpr size_t karatsuba_threshold = KaratsubaThreshold;
+    static constexpr size_t toom3_threshold     = Toom3Threshold;
+    static constexpr size_t ntt_threshold       = NttThreshold;
+    static constexpr size_t karatsuba_base      = KaratsubaBase;
+  };
+
+  // An allocator whose only purpose is to select the policy
+  // which is used as multiplication_thresholds of uintwide_t.
+  template<typename T,
+           typename PolicyType>
+  class policy_allocator : public std::allocator<T>
+  {
+  public:
+    template<typename U>
+    struct rebind
+    {
+      using other = policy_allocator<U, PolicyType>;
+    };
+
+    policy_allocator() = default;
+
+    template<typename U>
+    policy_allocator(const policy_allocator<U, PolicyType>&) noexcept { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+  };
+} // namespace local_calibrate_thresholds
+
+namespace math { namespace wide_integer {
+
+template<typename LimbType,
+         typename PolicyType>
+struct multiplication_thresholds<LimbType, local_calibrate_thresholds::policy_allocator<void, PolicyType>> : public PolicyType { };
+
+} } // namespace math::wide_integer
+
+namespace local_calibrate_thresholds
+{
+  using default_thresholds_type = math::wide_integer::multiplication_thresholds<std::uint32_t>;
+
+  constexpr auto min_of(const size_t a, const size_t b) -> size_t { return (a < b) ? a : b; }
+  constexpr auto max_of(const size_t a, const size_t b) -> size_t { return (a > b) ? a : b; }
+
+  // The policies below select the baseline algorithm or the candidate
+  // algorithm at the top level of a multiplication of N limbs.
+  template<const size_t N, const size_t Base>
+  using karatsuba_base_policy = policy<N,
+                                       max_of(size_t(N + 1U), default_thresholds_type::toom3_threshold),
+                                       max_of(size_t(N + 1U), default_thresholds_type::ntt_threshold),
+                                       Base>;
+
+  template<const size_t N>
+  using karatsuba_baseline_policy = policy<size_t(N + 1U),
+                                           max_of(size_t(N + 1U), default_thresholds_type::toom3_threshold),
+                                           max_of(size_t(N + 1U), default_thresholds_type::ntt_threshold),
+                                           default_thresholds_type::karatsuba_base>;
+
+  template<const size_t N>
+  using karatsuba_candidate_policy = karatsuba_base_policy<N, default_thresholds_type::karatsuba_base>;
+
+  template<const size_t N>
+  using toom3_baseline_policy = karatsuba_candidate_policy<N>;
+
+  template<const size_t N>
+  using toom3_candidate_policy = policy<min_of(N, default_thresholds_type::karatsuba_threshold),
+                                        N,
+                                        max_of(size_t(N + 1U), default_thresholds_type::ntt_threshold),
+                                        default_thresholds_type::karatsuba_base>;
+
+  template<const size_t N>
+  using ntt_baseline_policy = policy<min_of(N, default_thresholds_type::karatsuba_threshold),
+                                     min_of(N, default_thresholds_type::toom3_threshold),
+                                     size_t(N + 1U),
+                                     default_thresholds_type::karatsuba_base>;
+
+  template<const size_t N>
+  using ntt_candidate_policy = policy<min_of(N, default_thresholds_type::karatsuba_threshold),
+                                      min_of(N, default_thresholds_type::toom3_threshold),
+                                      N,
+                                      default_thresholds_type::karatsuba_base>;
+
+  template<typename UintType>
+  auto timed_mul(const std::vector<UintType>& a, const std::vector<UintType>& b) -> double
+  {
+    // Return the time per multiplication in microseconds.
+
+    std::uint64_t count = 0U;
+    std::size_t   index = 0U;
+
+    long long total_time { }; // NOLINT(google-runtime-int)
+
+    UintType c;
+
+    const std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+    for(;;)
+    {
+      c = a[index] * b[index];
+
+      const std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+      total_time = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+
+      ++count;
+      ++index;
+
+      if(index >= a.size())
+      {
+        index = 0U;
+      }
+
+      if(total_time > 19999)
+      {
+        break;
+      }
+    }
+
+    return (c != 0U) ? double(total_time) / double(count) : (std::numeric_limits<double>::max)();
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  auto random_operands(const std::uint32_t seed) -> std::vector<math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType>>
+  {
+    using distribution_type =
+      math::wide_integer::uniform_int_distribution<Width2, LimbType, AllocatorType>;
+
+    using random_engine_type =
+      std::linear_congruential_engine<std::uint32_t, UINT32_C(48271), UINT32_C(0), UINT32_C(2147483647)>;
+
+    random_engine_type rng(seed);
+
+    distribution_type distribution;
+
+    std::vector<math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType>> x(4U);
+
+    for(auto& xi : x)
+    {
+      xi = distribution(rng);
+    }
+
+    return x;
+  }
+
+  template<typename LimbType,
+           const size_t N,
+           typename PolicyTypeA,
+           typename PolicyTypeB>
+  auto is_faster() -> bool
+  {
+    // Is the multiplication of N limbs faster with policy B than with
+    // policy A? Take the best of several alternating measurements.
+
+    constexpr size_t width2 = size_t(N * size_t(std::numeric_limits<LimbType>::digits));
+
+    using a_allocator_type = policy_allocator<void, PolicyTypeA>;
+    using b_allocator_type = policy_allocator<void, PolicyTypeB>;
+
+    const auto a_u = random_operands<width2, LimbType, a_allocator_type>(UINT32_C(1));
+    const auto a_v = random_operands<width2, LimbType, a_allocator_type>(UINT32_C(2));
+    const auto b_u = random_operands<width2, LimbType, b_allocator_type>(UINT32_C(1));
+    const auto b_v = random_operands<width2, LimbType, b_allocator_type>(UINT32_C(2));
+
+    double time_a = (std::numeric_limits<double>::max)();
+    double time_b = (std::numeric_limits<double>::max)();
+
+    for(auto i = 0U; i < 3U; ++i)
+    {
+      time_a = (std::min)(time_a, timed_mul(a_u, a_v));
+      time_b = (std::min)(time_b, timed_mul(b_u, b_v));
+    }
+
+    return (time_b < time_a);
+  }
+
+  template<typename LimbType,
+           template<const size_t> class BaselinePolicyType,
+           template<const size_t> class CandidatePolicyType,
+           const size_t N,
+           const size_t NMax>
+  auto crossover() -> typename std::enable_if<(N > NMax), size_t>::type
+  {
+    return size_t(NMax + 1U);
+  }
+
+  template<typename LimbType,
+           template<const size_t> class BaselinePolicyType,
+           template<const size_t> class CandidatePolicyType,
+           const size_t N,
+           const size_t NMax>
+  auto crossover() -> typename std::enable_if<(N <= NMax), size_t>::type
+  {
+    // Sweep the limb counts N, 2N, 4N, ... up to NMax. At the first limb
+    // count for which the candidate algorithm is faster than the baseline,
+    // the threshold is set just above the preceding limb count.
+    return is_faster<LimbType, N, BaselinePolicyType<N>, CandidatePolicyType<N>>()
+             ? size_t(size_t(N / 2U) + 1U)
+             : crossover<LimbType, BaselinePolicyType, CandidatePolicyType, size_t(N * 2U), NMax>();
+  }
+
+  template<typename LimbType>
+  auto karatsuba_base() -> size_t
+  {
+    // Find the fastest base case of the Karatsuba recursion at 256 limbs.
+    constexpr size_t n = size_t(256U);
+
+    size_t base = size_t(12U);
+
+    if(is_faster<LimbType, n, karatsuba_base_policy<n, size_t(12U)>, karatsuba_base_policy<n, size_t(24U)>>()) { base = size_t(24U); }
+
+    if(base == size_t(24U))
+    {
+      if(is_faster<LimbType, n, karatsuba_base_policy<n, size_t(24U)>, karatsuba_base_policy<n, size_t(48U)>>()) { base = size_t(48U); }
+    }
+
+    if(base == size_t(48U))
+    {
+      if(is_faster<LimbType, n, karatsuba_base_policy<n, size_t(48U)>, karatsuba_base_policy<n, size_t(96U)>>()) { base = size_t(96U); }
+    }
+
+    return base;
+  }
+
+  template<typename LimbType>
+  auto limb_type_name() -> std::string
+  {
+    return "std::uint" + std::to_string(std::numeric_limits<LimbType>::digits) + "_t";
+  }
+
+  template<typename LimbType>
+  auto calibrate(std::ostream& os) -> bool
+  {
+    const size_t base = karatsuba_base<LimbType>();
+
+    const size_t karatsuba_threshold =
+      crossover<LimbType, karatsuba_baseline_policy, karatsuba_candidate_policy, size_t(16U), size_t(1024U)>();
+
+    const size_t toom3_threshold =
+      max_of(karatsuba_threshold, crossover<LimbType, toom3_baseline_policy, toom3_candidate_policy, size_t(256U), size_t(8192U)>());
+
+    const size_t ntt_threshold =
+      max_of(toom3_threshold, crossover<LimbType, ntt_baseline_policy, ntt_candidate_policy, size_t(1024U), size_t(16384U)>());
+
+    os << "// Multiplication thresholds measured by example009d_mul_thresholds.\n"
+       << "template<typename AllocatorType>\n"
+       << "struct multiplication_thresholds<" << limb_type_name<LimbType>() << ", AllocatorType>\n"
+       << "{\n"
+       << "  static constexpr size_t karatsuba_threshold = size_t(" << (karatsuba_threshold - 1U) << "U + 1U);\n"
+       << "  static constexpr size_t toom3_threshold     = size_t(" << (toom3_threshold     - 1U) << "U + 1U);\n"
+       << "  static constexpr size_t ntt_threshold       = size_t(" << (ntt_threshold       - 1U) << "U + 1U);\n"
+       << "  static constexpr size_t karatsuba_base      = size_t(" << base                << "U);\n"
+       << "};\n";
+
+    return ((karatsuba_threshold <= toom3_threshold) && (toom3_threshold <= ntt_threshold));
+  }
+} // namespace local_calibrate_thresholds
+
+auto math::wide_integer::example009d_mul_thresholds() -> bool
+{
+  const bool result_is_ok = local_calibrate_thresholds::calibrate<std::uint32_t>(std::cout);
+
+  return result_is_ok;
+}
+
+// Enable this if you would like to activate this main() as a standalone example.
+#if 0
+
+int main()
+{
+  const bool result_is_ok = wide_integer::example009d_mul_thresholds();
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+}
+
+#endif
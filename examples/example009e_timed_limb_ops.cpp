@@ -0,0 +1,202 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2018 - 2022.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <examples/example_uintwide_t.h>
+#include <math/wide_integer/uintwide_t.h>
+
+namespace local_timed_limb_ops
+{
+  // Time the limb-level operations add and multiply, which are routed
+  // through the architecture-specific limb kernels when these are active,
+  // together with division by a single limb. Build once with and once
+  // without WIDE_INTEGER_HAS_X86_64_ADX_KERNELS in order to compare
+  // the kernels with the portable code.
+
+  #if defined(WIDE_INTEGER_HAS_LIMB_TYPE_UINT64)
+  using limb_type = std::uint64_t;
+  #else
+  using limb_type = std::uint32_t;
+  #endif
+
+  auto kernel_name() -> const char*
+  {
+    #if (WIDE_INTEGER_X86_64_ADX_KERNELS_ARE_ACTIVE == 1)
+    return "x86_64-adx";
+    #else
+    return "portable";
+    #endif
+  }
+
+  enum class limb_op_type
+  {
+    op_add,
+    op_mul,
+    op_div_by_limb
+  };
+
+  template<const math::wide_integer::size_t Width2,
+           const limb_op_type LimbOp>
+  auto timed_op() -> bool
+  {
+    using big_uint_type = math::wide_integer::uintwide_t<Width2, limb_type, std::allocator<void>>;
+
+    using distribution_type =
+      math::wide_integer::uniform_int_distribution<Width2, limb_type, std::allocator<void>>;
+
+    using random_engine_type =
+      std::linear_congruential_engine<std::uint32_t, UINT32_C(48271), UINT32_C(0), UINT32_C(2147483647)>;
+
+    random_engine_type rng; // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    rng.seed(static_cast<typename random_engine_type::result_type>(std::clock()));
+
+    distribution_type distribution;
+
+    std::vector<big_uint_type> a(16U);
+    std::vector<big_uint_type> b(a.size());
+
+    for(auto i = static_cast<typename std::vector<big_uint_type>::size_type>(0U); i < a.size(); ++i)
+    {
+      a[i] = distribution(rng);
+      b[i] = distribution(rng);
+    }
+
+    // A single-limb divisor with its high bit set exercises the
+    // full-width two-by-one limb division.
+    const auto d =
+      static_cast<limb_type>
+      (
+          static_cast<limb_type>(static_cast<limb_type>(rng()) | static_cast<limb_type>(1U))
+        | static_cast<limb_type>(static_cast<limb_type>(1U) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits - 1))
+      );
+
+    std::uint64_t count = 0U;
+    std::size_t   index = 0U;
+
+    long long total_time { }; // NOLINT(google-runtime-int)
+
+    big_uint_type c;
+
+    const std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+    for(;;)
+    {
+      for(auto j = static_cast<unsigned>(UINT8_C(0)); j < static_cast<unsigned>(UINT8_C(16)); ++j)
+      {
+        switch(LimbOp)
+        {
+          case limb_op_type::op_add:
+            c = a[index] + b[index];
+            break;
+
+          case limb_op_type::op_mul:
+            c = a[index] * b[index];
+            break;
+
+          case limb_op_type::op_div_by_limb:
+          default:
+            c = a[index] / d;
+            break;
+        }
+
+        ++index;
+
+        if(index >= a.size())
+        {
+          index = 0U;
+        }
+      }
+
+      count += 16U;
+
+      const std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+      total_time = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+
+      if(total_time > 199999)
+      {
+        break;
+      }
+    }
+
+    const char* op_name =
+      ((LimbOp == limb_op_type::op_add)
+        ? "add     "
+        : ((LimbOp == limb_op_type::op_mul)
+            ? "mul     "
+            : "div_limb"));
+
+    const float ns_per_op = (float(static_cast<std::uint32_t>(total_time)) * 1000.0F) / float(count);
+
+    std::cout << "kernels: "
+              << kernel_name()
+              << ", bits: "
+              << std::setw(5)
+              << std::numeric_limits<big_uint_type>::digits
+              << ", op: "
+              << op_name
+              << ", ns_per_op: "
+              << std::fixed
+              << std::setprecision(1)
+              << ns_per_op
+              << std::endl;
+
+    // Cross-check the last result so that the timed work is not discarded.
+    const bool result_is_ok =
+    (
+         (ns_per_op > (std::numeric_limits<float>::min)())
+      && ((LimbOp != limb_op_type::op_div_by_limb) || (c <= a[(index == 0U) ? a.size() - 1U : index - 1U]))
+    );
+
+    return result_is_ok;
+  }
+
+  template<const math::wide_integer::size_t Width2>
+  auto timed_ops() -> bool
+  {
+    bool result_is_ok = true;
+
+    result_is_ok &= timed_op<Width2, limb_op_type::op_add>();
+    result_is_ok &= timed_op<Width2, limb_op_type::op_mul>();
+    result_is_ok &= timed_op<Width2, limb_op_type::op_div_by_limb>();
+
+    return result_is_ok;
+  }
+} // namespace local_timed_limb_ops
+
+auto math::wide_integer::example009e_timed_limb_ops() -> bool
+{
+  bool result_is_ok = true;
+
+  result_is_ok &= local_timed_limb_ops::timed_ops<size_t(UINT32_C( 256))>();
+  result_is_ok &= local_timed_limb_ops::timed_ops<size_t(UINT32_C( 512))>();
+  result_is_ok &= local_timed_limb_ops::timed_ops<size_t(UINT32_C(4096))>();
+
+  return result_is_ok;
+}
+
+// Enable this if you would like to activate this main() as a standalone example.
+#if 0
+
+int main()
+{
+  const bool result_is_ok = wide_integer::example009e_timed_limb_ops();
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+}
+
+#endif
@@ -0,0 +1,236 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2018 - 2022.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <examples/example_uintwide_t.h>
+#include <math/wide_integer/uintwide_t.h>
+
+namespace local_dudect_const_time
+{
+  // Test for timing leaks in the manner of dudect, see O. Reparaz,
+  // J. Balasch and I. Verbauwhede, "Dude, is my code constant time?",
+  // DATE 2017. The secret input of a function is drawn either from
+  // a fixed class (one fixed value) or from a random class, in random
+  // order. Welch's t-test is applied to the two sets of timings,
+  // after cropping the slowest ten percent (mostly interrupts).
+  // Values of |t| above 10 indicate a timing leak with certainty.
+
+  // The constant-time functions powm_ct and invmod_ct must pass,
+  // whereas their variable-time counterparts powm and invmod serve
+  // as a check that the test does detect leaks.
+
+  constexpr auto t_threshold = 10.0F;
+
+  constexpr auto number_of_measurements = static_cast<std::size_t>(UINT16_C(4000));
+
+  using uint256_t = math::wide_integer::uintwide_t<math::wide_integer::size_t(UINT32_C(256)), std::uint32_t>;
+
+  using random_engine_type = std::mt19937;
+
+  class welch_t_test
+  {
+  public:
+    void push(const int class_index, const float x)
+    {
+      // Accumulate the mean and the sum of squared
+      // deviations with Welford's online algorithm.
+      const auto i = static_cast<std::size_t>(class_index);
+
+      ++my_n[i];
+
+      const float delta = x - my_mean[i];
+
+      my_mean[i] += delta / static_cast<float>(my_n[i]);
+      my_m2  [i] += delta * (x - my_mean[i]);
+    }
+
+    auto t_value() const -> float
+    {
+      const float var_0 = my_m2[0U] / static_cast<float>(my_n[0U] - 1U);
+      const float var_1 = my_m2[1U] / static_cast<float>(my_n[1U] - 1U);
+
+      const float den = std::sqrt((var_0 / static_cast<float>(my_n[0U])) + (var_1 / static_cast<float>(my_n[1U])));
+
+      return ((den > 0.0F) ? ((my_mean[0U] - my_mean[1U]) / den) : 0.0F);
+    }
+
+  private:
+    std::size_t my_n   [2U] = { 0U, 0U };
+    float       my_mean[2U] = { 0.0F, 0.0F };
+    float       my_m2  [2U] = { 0.0F, 0.0F };
+  };
+
+  template<typename FunctionType,
+           typename ReferenceFunctionType>
+  auto measure(FunctionType          function,
+               ReferenceFunctionType reference,
+               const uint256_t&      fixed_secret,
+               random_engine_type&   rng,
+               float&                t) -> bool
+  {
+    // Prepare the inputs before timing, so that only
+    // the function itself is measured.
+    math::wide_integer::uniform_int_distribution<math::wide_integer::size_t(UINT32_C(256)), std::uint32_t> distribution;
+
+    std::vector<int>       classes(number_of_measurements);
+    std::vector<uint256_t> secrets(number_of_measurements);
+    std::vector<uint256_t> publics(number_of_measurements);
+    std::vector<uint256_t> results(number_of_measurements);
+    std::vector<float>     timings(number_of_measurements);
+
+    for(auto i = static_cast<std::size_t>(0U); i < number_of_measurements; ++i)
+    {
+      classes[i] = static_cast<int>(rng() & 1U);
+      secrets[i] = ((classes[i] == 0) ? fixed_secret : distribution(rng));
+      publics[i] = distribution(rng);
+    }
+
+    for(auto i = static_cast<std::size_t>(0U); i < number_of_measurements; ++i)
+    {
+      const auto begin = std::chrono::high_resolution_clock::now();
+
+      results[i] = function(secrets[i], publics[i]);
+
+      const auto end = std::chrono::high_resolution_clock::now();
+
+      timings[i] = static_cast<float>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    }
+
+    std::vector<float> sorted_timings(timings);
+
+    const auto crop_index = static_cast<std::ptrdiff_t>((number_of_measurements * 9U) / 10U);
+
+    std::nth_element(sorted_timings.begin(), sorted_timings.begin() + crop_index, sorted_timings.end());
+
+    const float crop_limit = *(sorted_timings.begin() + crop_index);
+
+    welch_t_test test;
+
+    for(auto i = static_cast<std::size_t>(0U); i < number_of_measurements; ++i)
+    {
+      if(timings[i] < crop_limit)
+      {
+        test.push(classes[i], timings[i]);
+      }
+    }
+
+    t = test.t_value();
+
+    // Verify the results (after the timing) with the reference function.
+    bool result_is_ok = true;
+
+    for(auto i = static_cast<std::size_t>(0U); i < number_of_measurements; ++i)
+    {
+      result_is_ok &= (results[i] == reference(secrets[i], publics[i]));
+    }
+
+    return result_is_ok;
+  }
+
+  // The modulus 2^255 - 19 is prime.
+  auto modulus() -> uint256_t
+  {
+    return (uint256_t(1U) << 255U) - 19U;
+  }
+
+  auto powm_ct_of_secret_exponent(const uint256_t& secret, const uint256_t& b) -> uint256_t
+  {
+    return powm_ct(b, secret, modulus());
+  }
+
+  auto powm_of_secret_exponent(const uint256_t& secret, const uint256_t& b) -> uint256_t
+  {
+    return powm(b, secret, modulus());
+  }
+
+  auto invmod_ct_of_secret(const uint256_t& secret, const uint256_t&) -> uint256_t
+  {
+    return invmod_ct(math::wide_integer::const_time::mod(secret, modulus()), modulus());
+  }
+
+  auto invmod_of_secret(const uint256_t& secret, const uint256_t&) -> uint256_t
+  {
+    return invmod(secret % modulus(), modulus());
+  }
+
+  template<typename FunctionType,
+           typename ReferenceFunctionType>
+  auto test_and_report(const char*           name,
+                       FunctionType          function,
+                       ReferenceFunctionType reference,
+                       const uint256_t&      fixed_secret,
+                       random_engine_type&   rng,
+                       const bool            is_const_time) -> bool
+  {
+    float t { };
+
+    const bool results_are_ok = measure(function, reference, fixed_secret, rng, t);
+
+    const bool leak_is_detected = (std::fabs(t) > t_threshold);
+
+    std::cout << "function: "
+              << name
+              << ", t: "
+              << std::fixed
+              << std::setprecision(1)
+              << std::setw(8)
+              << t
+              << (leak_is_detected ? ", leak detected" : ", no leak detected")
+              << std::endl;
+
+    return (results_are_ok && (is_const_time ? (!leak_is_detected) : leak_is_detected));
+  }
+} // namespace local_dudect_const_time
+
+auto math::wide_integer::example009f_dudect_const_time() -> bool
+{
+  using local_dudect_const_time::uint256_t;
+
+  // Use a fixed seed, so that the classes and inputs are reproducible.
+  local_dudect_const_time::random_engine_type rng(static_cast<typename local_dudect_const_time::random_engine_type::result_type>(UINT32_C(0x5EED0009))); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+  // For the exponentiation, the fixed secret exponent is short.
+  // For the inverse, the fixed secret is one.
+  const uint256_t fixed_exponent(UINT32_C(65537));
+  const uint256_t fixed_value   (1U);
+
+  bool result_is_ok = true;
+
+  using local_dudect_const_time::test_and_report;
+  using local_dudect_const_time::powm_ct_of_secret_exponent;
+  using local_dudect_const_time::powm_of_secret_exponent;
+  using local_dudect_const_time::invmod_ct_of_secret;
+  using local_dudect_const_time::invmod_of_secret;
+
+  result_is_ok &= test_and_report("powm_ct  ", powm_ct_of_secret_exponent, powm_of_secret_exponent,    fixed_exponent, rng, true);
+  result_is_ok &= test_and_report("powm     ", powm_of_secret_exponent,    powm_ct_of_secret_exponent, fixed_exponent, rng, false);
+  result_is_ok &= test_and_report("invmod_ct", invmod_ct_of_secret,        invmod_of_secret,           fixed_value,    rng, true);
+  result_is_ok &= test_and_report("invmod   ", invmod_of_secret,           invmod_ct_of_secret,        fixed_value,    rng, false);
+
+  return result_is_ok;
+}
+
+// Enable this if you would like to activate this main() as a standalone example.
+#if 0
+
+int main()
+{
+  const bool result_is_ok = wide_integer::example009f_dudect_const_time();
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+}
+
+#endif
@@ -50,37 +50,6 @@ namespace local_rsa
 
     virtual ~rsa_base() = default;
 
-    struct euclidean
-    {
-      template<typename IntegerType>
-      static auto extended_euclidean(const IntegerType& a, // NOLINT(misc-no-recursion)
-                                     const IntegerType& b,
-                                           IntegerType* x,
-                                           IntegerType* y) -> IntegerType
-      {
-        // Recursive extended Euclidean algorithm.
-        using local_integer_type = IntegerType;
-
-        if(a == 0)
-        {
-          *x = local_integer_type(0U);
-          *y = local_integer_type(1U);
-
-          return b;
-        }
-
-        local_integer_type tmp_x;
-        local_integer_type tmp_y;
-
-        local_integer_type gcd_ext = extended_euclidean(b % a, a, &tmp_x, &tmp_y);
-
-        *x = tmp_y - ((b / a) * tmp_x);
-        *y = tmp_x;
-
-        return gcd_ext;
-      }
-    };
-
     class encryptor
     {
     public:
@@ -236,38 +205,12 @@ namespace local_rsa
 
     void calculate_private_key()
     {
-      my_uintwide_t a = phi_of_m;
-      my_uintwide_t b = my_r;
-
-      my_uintwide_t x(0U);
-      my_uintwide_t s(0U);
-
-      euclidean::extended_euclidean(a, b, &x, &s);
-
-      s = is_neg(s) ? make_positive(s, phi_of_m) : s;
+      // The private exponent is the inverse of the public
+      // exponent r modulo phi(m).
+      const my_uintwide_t s = invmod(my_r, phi_of_m);
 
       private_key = private_key_type { s, my_p, my_q };
     }
-
-  private:
-    static auto is_neg(const my_uintwide_t& x) -> bool
-    {
-      const bool x_is_neg = ((x & (my_uintwide_t(1U) << (std::numeric_limits<my_uintwide_t>::digits - 1))) != 0);
-
-      return x_is_neg;
-    }
-
-    static auto make_positive(const my_uintwide_t& numb, const my_uintwide_t& mod) -> my_uintwide_t
-    {
-      my_uintwide_t tmp = numb;
-
-      while(is_neg(tmp))
-      {
-        tmp += mod;
-      }
-
-      return tmp;
-    }
   };
 
   template<const std::size_t RsaBitCount,
@@ -389,6 +332,10 @@ auto math::wide_integer::example012_rsa_crypto() -> bool
 
   result_is_ok &= rsa_type::is_prime(q);
 
+  // Cross-check the primes (and the composite modulus)
+  // with the deterministic Baillie-PSW test.
+  result_is_ok &= (baillie_psw(p) && baillie_psw(q) && (!baillie_psw(n)));
+
   const rsa_type rsa(p, q, e);
 
   result_is_ok &= (   (rsa.get_p() == p)
@@ -23,7 +23,9 @@
   #include <initializer_list>
   #include <iterator>
   #include <limits>
+  #include <tuple>
   #include <type_traits>
+  #include <utility>
 
   #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
   #include <cmath>
@@ -36,6 +38,25 @@
   #include <sstream>
   #endif
 
+  #if !defined(WIDE_INTEGER_DISABLE_TO_CHARS)
+  #include <system_error>
+  #endif
+
+  #if defined(WIDE_INTEGER_HAS_THREADS)
+  #include <atomic>
+  #include <condition_variable>
+  #include <exception>
+  #include <mutex>
+  #include <thread>
+  #include <vector>
+  #endif
+
+  // The thread-local scratch arena is not used on freestanding
+  // implementations and on AVR, which may lack thread_local storage.
+  #if (defined(__AVR__) || (defined(__STDC_HOSTED__) && (__STDC_HOSTED__ == 0))) && !defined(WIDE_INTEGER_DISABLE_SCRATCH_ARENA)
+  #define WIDE_INTEGER_DISABLE_SCRATCH_ARENA
+  #endif
+
   #if (defined(__clang__) && (__clang_major__ <= 9))
   #define WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE struct
   #else
@@ -86,6 +107,57 @@
     #endif
   #endif
 
+  // The optional limb kernels (WIDE_INTEGER_HAS_X86_64_ADX_KERNELS)
+  // use GCC-style inline assembly and 64-bit limbs. They need a target
+  // having ADX and BMI2 (such as -madx -mbmi2). When uintwide_t is
+  // constexpr, the kernels also need a way to detect constant evaluation.
+  // Otherwise the portable limb arithmetic is used.
+  #if (defined(WIDE_INTEGER_HAS_LIMB_TYPE_UINT64) && (defined(__GNUC__) || defined(__clang__)))
+    #if ((WIDE_INTEGER_CONSTEXPR_IS_COMPILE_TIME_CONST == 0) || (defined(__cpp_lib_is_constant_evaluated) && (__cpp_lib_is_constant_evaluated >= 201811L)) || (defined(__clang__) && (__clang_major__ >= 9)) || (!defined(__clang__) && (__GNUC__ >= 9)))
+      #if (defined(WIDE_INTEGER_HAS_X86_64_ADX_KERNELS) && defined(__x86_64__) && defined(__ADX__) && defined(__BMI2__))
+      #define WIDE_INTEGER_X86_64_ADX_KERNELS_ARE_ACTIVE 1 /* NOLINT(cppcoreguidelines-macro-usage) */
+      #endif
+    #endif
+  #endif
+
+  #if !defined(WIDE_INTEGER_X86_64_ADX_KERNELS_ARE_ACTIVE)
+  #define WIDE_INTEGER_X86_64_ADX_KERNELS_ARE_ACTIVE 0 /* NOLINT(cppcoreguidelines-macro-usage) */
+  #endif
+
+  #if (WIDE_INTEGER_X86_64_ADX_KERNELS_ARE_ACTIVE == 1)
+  #define WIDE_INTEGER_LIMB_KERNELS_ARE_ACTIVE 1 /* NOLINT(cppcoreguidelines-macro-usage) */
+  #else
+  #define WIDE_INTEGER_LIMB_KERNELS_ARE_ACTIVE 0 /* NOLINT(cppcoreguidelines-macro-usage) */
+  #endif
+
+  // The optional batch kernels (WIDE_INTEGER_HAS_X86_64_SIMD_KERNELS)
+  // of uintwide_batch use the intrinsics of AVX2 and, when the target
+  // has them, of AVX-512F and AVX-512 IFMA (such as -mavx2, -mavx512f
+  // -mavx512ifma or -march=native). Otherwise the portable
+  // batch arithmetic is used.
+  #if (defined(WIDE_INTEGER_HAS_X86_64_SIMD_KERNELS) && (defined(__x86_64__) || defined(_M_X64)) && defined(__AVX2__))
+    #include <immintrin.h>
+    #define WIDE_INTEGER_X86_64_AVX2_KERNELS_ARE_ACTIVE 1 /* NOLINT(cppcoreguidelines-macro-usage) */
+    #if defined(__AVX512F__)
+    #define WIDE_INTEGER_X86_64_AVX512_KERNELS_ARE_ACTIVE 1 /* NOLINT(cppcoreguidelines-macro-usage) */
+    #if defined(__AVX512IFMA__)
+    #define WIDE_INTEGER_X86_64_AVX512_IFMA_KERNELS_ARE_ACTIVE 1 /* NOLINT(cppcoreguidelines-macro-usage) */
+    #endif
+    #endif
+  #endif
+
+  #if !defined(WIDE_INTEGER_X86_64_AVX2_KERNELS_ARE_ACTIVE)
+  #define WIDE_INTEGER_X86_64_AVX2_KERNELS_ARE_ACTIVE 0 /* NOLINT(cppcoreguidelines-macro-usage) */
+  #endif
+
+  #if !defined(WIDE_INTEGER_X86_64_AVX512_KERNELS_ARE_ACTIVE)
+  #define WIDE_INTEGER_X86_64_AVX512_KERNELS_ARE_ACTIVE 0 /* NOLINT(cppcoreguidelines-macro-usage) */
+  #endif
+
+  #if !defined(WIDE_INTEGER_X86_64_AVX512_IFMA_KERNELS_ARE_ACTIVE)
+  #define WIDE_INTEGER_X86_64_AVX512_IFMA_KERNELS_ARE_ACTIVE 0 /* NOLINT(cppcoreguidelines-macro-usage) */
+  #endif
+
   #if defined(WIDE_INTEGER_NAMESPACE_BEGIN) || defined(WIDE_INTEGER_NAMESPACE_END)
     #error internal pre-processor macro already defined
   #endif
@@ -515,6 +587,34 @@
   using detail::unsinged_fast_type;
   using detail::singed_fast_type;
 
+  // Multiplication thresholds, given in limbs, which select among the
+  // schoolbook, Karatsuba, Toom-3 and NTT multiplication algorithms.
+  // The defaults have been measured on x86_64 with 32-bit limbs.
+  // This template can be specialized for a given limb type (and,
+  // if needed, allocator type) in order to tune the thresholds
+  // for a particular host. The example example009d_mul_thresholds
+  // measures the crossovers and prints such specializations
+  // in a form suitable for WIDE_INTEGER_MULTIPLICATION_THRESHOLDS_HEADER.
+  template<typename LimbType,
+           typename AllocatorType = void>
+  struct multiplication_thresholds
+  {
+    static constexpr size_t karatsuba_threshold = size_t(128U + 1U);
+    static constexpr size_t toom3_threshold     = size_t(512U + 1U);
+    static constexpr size_t ntt_threshold       = size_t(6144U + 1U);
+
+    // The largest number of limbs multiplied with the schoolbook
+    // algorithm at the base of the Karatsuba recursion.
+    static constexpr size_t karatsuba_base      = size_t(48U);
+  };
+
+  #if defined(WIDE_INTEGER_MULTIPLICATION_THRESHOLDS_HEADER)
+  // Specializations of multiplication_thresholds must be seen before the
+  // first instantiation of uintwide_t. They are, therefore, included here,
+  // within namespace math::wide_integer.
+  #include WIDE_INTEGER_MULTIPLICATION_THRESHOLDS_HEADER
+  #endif
+
   // Forward declaration of the uintwide_t template class.
   template<const size_t Width2,
            typename LimbType = std::uint32_t,
@@ -659,6 +759,43 @@
 
   #endif
 
+  #if !defined(WIDE_INTEGER_DISABLE_TO_CHARS)
+
+  // Result types of the character conversion functions,
+  // in the manner of std::to_chars_result and std::from_chars_result.
+  struct to_chars_result // NOLINT(altera-struct-pack-align)
+  {
+    char*     ptr;
+    std::errc ec;
+  };
+
+  struct from_chars_result // NOLINT(altera-struct-pack-align)
+  {
+    const char* ptr;
+    std::errc   ec;
+  };
+
+  // Forward declarations of the character conversion functions.
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto to_chars(char* first,
+                                       char* last,
+                                       const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
+                                       const int base = 10) -> to_chars_result;
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto from_chars(const char* first,
+                                         const char* last,
+                                         uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
+                                         const int base = 10) -> from_chars_result;
+
+  #endif
+
   // Forward declarations of various number-theoretical tools.
   template<const size_t Width2,
            typename LimbType,
@@ -720,6 +857,58 @@
                                    const OtherUnsignedIntegralTypeP&    p,
                                    const OtherUnsignedIntegralTypeM&    m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
+  template<typename LimbType>
+  class limb_divisor;
+
+  template<const size_t Width2,
+           typename LimbType>
+  class uintwide_view;
+
+  template<const size_t Width2,
+           typename LimbType = std::uint32_t,
+           typename AllocatorType = void>
+  class montgomery_context;
+
+  template<typename UnsignedWideIntegerType>
+  class barrett_reducer;
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto divmod(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                     const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> std::pair<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>;
+
+  template<typename UnsignedShortType,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto divmod(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                     const UnsignedShortType& b) -> typename std::enable_if<(   (std::is_integral<UnsignedShortType>::value)
+                                                                                             && (std::is_unsigned<UnsignedShortType>::value)
+                                                                                             && (std::numeric_limits<UnsignedShortType>::digits <= std::numeric_limits<LimbType>::digits)),
+                                                                                             std::pair<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>, LimbType>>::type;
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto export_bytes(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
+                                                 std::uint8_t* first,
+                                                 std::uint8_t* last,
+                                           const bool          msv_first   = true,
+                                           const bool          fixed_width = false) -> std::uint8_t*;
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto import_bytes(      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
+                                           const std::uint8_t* first,
+                                           const std::uint8_t* last,
+                                           const bool          msv_first = true) -> bool;
+
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
@@ -742,6 +931,48 @@
   WIDE_INTEGER_CONSTEXPR auto lcm(const UnsignedShortType& a, const UnsignedShortType& b) -> typename std::enable_if<(   (std::is_integral<UnsignedShortType>::value)
                                                                                                                       && (std::is_unsigned<UnsignedShortType>::value)), UnsignedShortType>::type;
 
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto xgcd(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                   const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> std::tuple<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>;
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto invmod(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                     const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto invmod_ct(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                        const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto powm_ct(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b,
+                                      const OtherIntegralTypeP&                                    p,
+                                      const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  namespace const_time {
+
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> WIDE_INTEGER_CONSTEXPR auto is_zero(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> bool;
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> WIDE_INTEGER_CONSTEXPR auto equal  (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> bool;
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> WIDE_INTEGER_CONSTEXPR auto less   (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> bool;
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> WIDE_INTEGER_CONSTEXPR auto compare(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> std::int_fast8_t;
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> WIDE_INTEGER_CONSTEXPR auto select (const bool condition, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> WIDE_INTEGER_CONSTEXPR void cswap  (const bool condition, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b);
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> WIDE_INTEGER_CONSTEXPR auto mod    (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  } // namespace const_time
+
   template<const size_t Width2,
            typename LimbType = std::uint32_t,
            typename AllocatorType = void,
@@ -779,6 +1010,54 @@
                     DistributionType&                                            distribution,
                     GeneratorType&                                               generator) -> bool;
 
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto baillie_psw(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& n) -> bool;
+
+  template<const size_t PrimeCount = static_cast<size_t>(UINT16_C(2048))>
+  class small_prime_table;
+
+  template<typename DistributionType,
+           typename GeneratorType,
+           const size_t PrimeCount,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto find_next_prime(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& n,
+                       const unsinged_fast_type                                     number_of_trials,
+                       DistributionType&                                            distribution,
+                       GeneratorType&                                               generator,
+                       const small_prime_table<PrimeCount>&                         table,
+                       const unsigned                                               thread_count = 0U) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  template<typename RandomAccessInputIteratorType,
+           typename RandomAccessOutputIteratorType,
+           typename DistributionType,
+           typename GeneratorType,
+           const size_t PrimeCount>
+  auto miller_rabin_batch(RandomAccessInputIteratorType        first,
+                          RandomAccessInputIteratorType        last,
+                          RandomAccessOutputIteratorType       result,
+                          const unsinged_fast_type             number_of_trials,
+                          DistributionType&                    distribution,
+                          GeneratorType&                       generator,
+                          const small_prime_table<PrimeCount>& table,
+                          const unsigned                       thread_count = 0U) -> RandomAccessOutputIteratorType;
+
+  template<const size_t Width2,
+           typename LimbType = std::uint32_t,
+           const size_t LaneCount = static_cast<size_t>(UINT8_C(16))>
+  class uintwide_batch;
+
+  namespace parallel {
+
+  class thread_pool;
+
+  } // namespace parallel
+
   } // namespace wide_integer
   } // namespace math
 
@@ -912,6 +1191,230 @@
     WIDE_INTEGER_CONSTEXPR auto operator[](const size_type i) const -> typename base_class_type::const_reference { return base_class_type::operator[](static_cast<typename base_class_type::size_type>(i)); }
   };
 
+  #if !defined(WIDE_INTEGER_DISABLE_SCRATCH_ARENA)
+  // A thread-local, stack-like arena for the scratch memory of the internal
+  // algorithms (multiplication, division and string conversion) when
+  // uintwide_t uses an allocator. There is one arena per allocator type,
+  // and its blocks are obtained from a default-constructed instance of the
+  // allocator (rebound to std::max_align_t), in the same way as the limbs
+  // of uintwide_t. Memory is handed out from a bump pointer and handed
+  // back by rewinding to a previously taken mark. Blocks are retained,
+  // so that after a first use of a given size, scratch memory
+  // no longer involves the allocator.
+  template<typename AllocatorType>
+  class scratch_arena final
+  {
+  public:
+    struct mark_type
+    {
+      std::size_t index;
+      std::size_t offset;
+    };
+
+    static auto instance() -> scratch_arena&
+    {
+      static thread_local scratch_arena arena;
+
+      return arena;
+    }
+
+    scratch_arena(const scratch_arena&) = delete;
+    scratch_arena(scratch_arena&&) = delete;
+
+    ~scratch_arena()
+    {
+      for(auto& block : my_blocks)
+      {
+        if(block.data != nullptr)
+        {
+          allocator_traits_type::deallocate(my_allocator, block.data, block.size / sizeof(std::max_align_t));
+        }
+      }
+    }
+
+    auto operator=(const scratch_arena&) -> scratch_arena& = delete;
+    auto operator=(scratch_arena&&) -> scratch_arena& = delete;
+
+    auto mark() const -> mark_type { return { my_index, my_offset }; }
+
+    auto rewind(const mark_type& m) -> void
+    {
+      my_index  = m.index;
+      my_offset = m.offset;
+    }
+
+    auto allocate(const std::size_t count) -> void*
+    {
+      constexpr std::size_t alignment = alignof(std::max_align_t);
+
+      // Each request takes at least one unit of alignment, so that
+      // the empty block 0 is never handed out.
+      const std::size_t size = (std::max)(alignment, std::size_t(((count + (alignment - 1U)) / alignment) * alignment));
+
+      if((my_blocks[my_index].size - my_offset) < size)
+      {
+        // Move on to the next block. Any block beyond the current one
+        // is unused and is replaced if it is too small. The new block
+        // is allocated before anything is changed, so that the arena
+        // remains intact if the allocation throws.
+        block_type& next = my_blocks[my_index + 1U];
+
+        if(next.size < size)
+        {
+          const std::size_t next_units =
+            (   (std::max)(size, (std::max)(std::size_t(my_blocks[my_index].size * 2U), std::size_t(UINT32_C(0x10000))))
+             + (sizeof(std::max_align_t) - 1U)) / sizeof(std::max_align_t);
+
+          block_pointer next_data = allocator_traits_type::allocate(my_allocator, next_units);
+
+          const std::size_t next_size = next_units * sizeof(std::max_align_t);
+
+          if(next.data != nullptr)
+          {
+            allocator_traits_type::deallocate(my_allocator, next.data, next.size / sizeof(std::max_align_t));
+          }
+
+          next.data = next_data;
+          next.size = next_size;
+        }
+
+        ++my_index;
+        my_offset = 0U;
+      }
+
+      void* p = reinterpret_cast<unsigned char*>(&(*my_blocks[my_index].data)) + my_offset; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      my_offset += size;
+
+      return p;
+    }
+
+  private:
+    using allocator_type        = typename std::allocator_traits<AllocatorType>::template rebind_alloc<std::max_align_t>;
+    using allocator_traits_type = std::allocator_traits<allocator_type>;
+    using block_pointer         = typename allocator_traits_type::pointer;
+
+    struct block_type
+    {
+      block_pointer data;
+      std::size_t   size;
+    };
+
+    // Block 0 is empty, and each following block is at least twice
+    // as large as its predecessor, which limits the number of blocks.
+    allocator_type              my_allocator { };
+    std::array<block_type, 64U> my_blocks    { };
+    std::size_t                 my_index     { };
+    std::size_t                 my_offset    { };
+
+    scratch_arena() = default;
+  };
+
+  template<typename MyType,
+           const size_t MySize,
+           typename AllocatorType>
+  class fixed_scratch_array final
+  {
+  public:
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using value_type             = MyType;
+    using pointer                = value_type*;
+    using const_pointer          = const value_type*;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+    using iterator               = pointer;
+    using const_iterator         = const_pointer;
+
+    static_assert(std::is_trivial<value_type>::value, "Error: The scratch arena holds trivial types only");
+
+    static constexpr auto static_size() -> size_type { return MySize; }
+
+    fixed_scratch_array()
+      : my_mark(arena_type::instance().mark()),
+        my_data(static_cast<pointer>(arena_type::instance().allocate(sizeof(value_type) * std::size_t(MySize))))
+    {
+      std::fill(begin(), end(), value_type());
+    }
+
+    fixed_scratch_array(const fixed_scratch_array&) = delete;
+    fixed_scratch_array(fixed_scratch_array&&) = delete;
+
+    ~fixed_scratch_array() { arena_type::instance().rewind(my_mark); }
+
+    auto operator=(const fixed_scratch_array&) -> fixed_scratch_array& = delete;
+    auto operator=(fixed_scratch_array&&) -> fixed_scratch_array& = delete;
+
+    static constexpr auto size() -> size_type { return MySize; }
+
+    auto data()       -> pointer       { return my_data; }
+    auto data() const -> const_pointer { return my_data; }
+
+    auto begin ()       -> iterator       { return my_data; }
+    auto begin () const -> const_iterator { return my_data; }
+    auto cbegin() const -> const_iterator { return my_data; }
+    auto end   ()       -> iterator       { return my_data + MySize; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto end   () const -> const_iterator { return my_data + MySize; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto cend  () const -> const_iterator { return my_data + MySize; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    auto operator[](const size_type i)       -> reference       { return my_data[i]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto operator[](const size_type i) const -> const_reference { return my_data[i]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  private:
+    using arena_type = scratch_arena<AllocatorType>;
+
+    const typename arena_type::mark_type my_mark;
+    const pointer                        my_data;
+  };
+  #endif
+
+  // The type of temporary arrays used by the internal algorithms.
+  // These reside on the stack without an allocator, or else in the
+  // scratch arena (unless disabled, in which case the allocator is used).
+  template<typename MyType,
+           const size_t MySize,
+           typename AllocatorType>
+  using scratch_array =
+    typename std::conditional<std::is_same<AllocatorType, void>::value,
+                              fixed_static_array<MyType, MySize>,
+                              #if !defined(WIDE_INTEGER_DISABLE_SCRATCH_ARENA)
+                              fixed_scratch_array<MyType, MySize, AllocatorType>
+                              #else
+                              fixed_dynamic_array<MyType,
+                                                  MySize,
+                                                  typename std::allocator_traits<typename std::conditional<std::is_same<AllocatorType, void>::value,
+                                                                                                           std::allocator<void>,
+                                                                                                           AllocatorType>::type>::template rebind_alloc<MyType>>
+                              #endif
+                              >::type;
+
+  // The type of the character buffers used in string conversion.
+  template<const size_t MySize,
+           typename AllocatorType>
+  using string_buffer =
+    typename std::conditional<std::is_same<AllocatorType, void>::value,
+                              std::array<char, std::size_t(MySize)>,
+                              #if !defined(WIDE_INTEGER_DISABLE_SCRATCH_ARENA)
+                              fixed_scratch_array<char, MySize, AllocatorType>
+                              #else
+                              std::array<char, std::size_t(MySize)>
+                              #endif
+                              >::type;
+
+  // The type of the large temporary arrays (such as the buffers of the
+  // number-theoretic transform), which never reside on the stack. Without
+  // an allocator, these are taken from the scratch arena of std::allocator
+  // (or directly from std::allocator if the arena is disabled).
+  template<typename MyType,
+           const size_t MySize,
+           typename AllocatorType>
+  using large_scratch_array =
+    scratch_array<MyType,
+                  MySize,
+                  typename std::conditional<std::is_same<AllocatorType, void>::value,
+                                            std::allocator<void>,
+                                            AllocatorType>::type>;
+
   template<const size_t Width2> struct verify_power_of_two_times_granularity_one_sixty_fourth // NOLINT(altera-struct-pack-align)
   {
     // List of numbers used to identify the form 2^n times 1...63.
@@ -1048,6 +1551,73 @@
     return local_ularge_type(local_ularge_type(static_cast<local_ularge_type>(hi) << unsigned(std::numeric_limits<UnsignedShortType>::digits)) | lo);
   }
 
+  // Store and load the bytes of a limb, either most or least
+  // significant byte first. The byte-wise accesses are unrolled
+  // such that compilers can merge them into accesses of the whole
+  // limb, byte-swapped as needed for the byte order of the host.
+  template<typename LimbType,
+           const unsigned ByteCount = static_cast<unsigned>(sizeof(LimbType))>
+  struct limb_bytes
+  {
+    static constexpr auto byte_index = static_cast<unsigned>(ByteCount - 1U);
+
+    static WIDE_INTEGER_CONSTEXPR auto byte_of(const LimbType limb) -> std::uint8_t
+    {
+      return static_cast<std::uint8_t>(static_cast<std::uintmax_t>(limb) >> static_cast<unsigned>(byte_index * 8U));
+    }
+
+    static WIDE_INTEGER_CONSTEXPR auto limb_of(const std::uint8_t byte_value) -> LimbType
+    {
+      return static_cast<LimbType>(static_cast<std::uintmax_t>(byte_value) << static_cast<unsigned>(byte_index * 8U));
+    }
+
+    static WIDE_INTEGER_CONSTEXPR void store_lsv_first(std::uint8_t* p, const LimbType limb)
+    {
+      *(p + byte_index) = byte_of(limb); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      limb_bytes<LimbType, byte_index>::store_lsv_first(p, limb);
+    }
+
+    static WIDE_INTEGER_CONSTEXPR void store_msv_first(std::uint8_t* p, const LimbType limb)
+    {
+      *(p + static_cast<unsigned>(sizeof(LimbType) - ByteCount)) = byte_of(limb); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      limb_bytes<LimbType, byte_index>::store_msv_first(p, limb);
+    }
+
+    static WIDE_INTEGER_CONSTEXPR auto load_lsv_first(const std::uint8_t* p) -> LimbType
+    {
+      return static_cast<LimbType>(limb_of(*(p + byte_index)) | limb_bytes<LimbType, byte_index>::load_lsv_first(p)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    static WIDE_INTEGER_CONSTEXPR auto load_msv_first(const std::uint8_t* p) -> LimbType
+    {
+      return static_cast<LimbType>(limb_of(*(p + static_cast<unsigned>(sizeof(LimbType) - ByteCount))) | limb_bytes<LimbType, byte_index>::load_msv_first(p)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  };
+
+  template<typename LimbType>
+  struct limb_bytes<LimbType, 0U>
+  {
+    static WIDE_INTEGER_CONSTEXPR void store_lsv_first(std::uint8_t*, const LimbType) { }
+    static WIDE_INTEGER_CONSTEXPR void store_msv_first(std::uint8_t*, const LimbType) { }
+
+    static WIDE_INTEGER_CONSTEXPR auto load_lsv_first(const std::uint8_t*) -> LimbType { return static_cast<LimbType>(0U); }
+    static WIDE_INTEGER_CONSTEXPR auto load_msv_first(const std::uint8_t*) -> LimbType { return static_cast<LimbType>(0U); }
+  };
+
+  template<typename LimbType>
+  WIDE_INTEGER_CONSTEXPR void limb_store_lsv_first(std::uint8_t* p, const LimbType limb) { limb_bytes<LimbType>::store_lsv_first(p, limb); }
+
+  template<typename LimbType>
+  WIDE_INTEGER_CONSTEXPR void limb_store_msv_first(std::uint8_t* p, const LimbType limb) { limb_bytes<LimbType>::store_msv_first(p, limb); }
+
+  template<typename LimbType>
+  WIDE_INTEGER_CONSTEXPR auto limb_load_lsv_first(const std::uint8_t* p) -> LimbType { return limb_bytes<LimbType>::load_lsv_first(p); }
+
+  template<typename LimbType>
+  WIDE_INTEGER_CONSTEXPR auto limb_load_msv_first(const std::uint8_t* p) -> LimbType { return limb_bytes<LimbType>::load_msv_first(p); }
+
   template<typename UnsignedIntegralType>
   constexpr auto negate(UnsignedIntegralType u) -> typename std::enable_if<   (std::is_integral<UnsignedIntegralType>::value)
                                                                            && (std::is_unsigned<UnsignedIntegralType>::value), UnsignedIntegralType>::type
@@ -1159,4298 +1729,11967 @@
   };
   #endif
 
-  } // namespace detail
-  } // namespace wide_integer
-  } // namespace math
-
-  namespace math { namespace wide_integer {
-
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  class uintwide_t // NOLINT(cppcoreguidelines-special-member-functions,hicpp-special-member-functions)
+  // Number-theoretic transform (NTT) over the prime field Z/pZ, used for
+  // multiplication at very large widths. The primes are of the form
+  // c * 2^m + 1 and fit in 32 bits, so that all of the field arithmetic
+  // can be carried out portably with 64-bit products.
+  template<const std::uint32_t Modulus,
+           const std::uint32_t Generator>
+  struct ntt_prime
   {
-  public:
-    template<const size_t OtherWidth2,
-             typename OtherLimbType,
-             typename OtherAllocatorType,
-             const bool OtherIsSigned>
-    friend class uintwide_t;
+    static_assert(Modulus < UINT32_C(0x80000000), "Error: The sum of two residues must not overflow 32 bits");
 
-    // Class-local type definitions.
-    using limb_type = LimbType;
+    static WIDE_INTEGER_CONSTEXPR auto add(const std::uint32_t a, const std::uint32_t b) -> std::uint32_t
+    {
+      const auto s = std::uint32_t(a + b);
 
-    using double_limb_type =
-      typename detail::uint_type_helper<size_t(std::numeric_limits<limb_type>::digits * 2)>::exact_unsigned_type;
+      return std::uint32_t(s - ((s >= Modulus) ? Modulus : 0U));
+    }
 
-    // Legacy ularge and ushort types. These are no longer used
-    // in the class, but provided for legacy compatibility.
-    using ushort_type = limb_type;
-    using ularge_type = double_limb_type;
-
-    // More compile-time checks.
-    #if defined(WIDE_INTEGER_HAS_LIMB_TYPE_UINT64)
-    static_assert(((sizeof(limb_type) * 2U) == sizeof(double_limb_type)),
-                   "Error: Please check the characteristics of the template parameters UnsignedShortType and UnsignedLargeType");
-    #else
-    static_assert((    ( std::numeric_limits<limb_type>::is_integer)
-                   &&  ( std::numeric_limits<double_limb_type>::is_integer)
-                   &&  (!std::numeric_limits<limb_type>::is_signed)
-                   &&  (!std::numeric_limits<double_limb_type>::is_signed)
-                   &&  ((sizeof(limb_type) * 2U)                          == sizeof(double_limb_type))),
-                   "Error: Please check the characteristics of the template parameters UnsignedShortType and UnsignedLargeType");
-    #endif
-
-    // Helper constants for the digit characteristics.
-    static constexpr size_t my_width2 = Width2;
-
-    // The number of limbs.
-    static constexpr size_t number_of_limbs =
-      size_t(my_width2 / size_t(std::numeric_limits<limb_type>::digits));
-
-    static constexpr size_t number_of_limbs_karatsuba_threshold = size_t(128U + 1U);
-
-    // Verify that the Width2 template parameter (mirrored with my_width2):
-    //   * Is equal to 2^n times 1...63.
-    //   * And that there are at least 16, 24 or 32 binary digits, or more.
-    //   * And that the number of binary digits is an exact multiple of the number of limbs.
-    static_assert(   (detail::verify_power_of_two_times_granularity_one_sixty_fourth<my_width2>::conditional_value)
-                  && (my_width2 >= 16U)
-                  && (my_width2 == (number_of_limbs * size_t(std::numeric_limits<limb_type>::digits))),
-                  "Error: Width2 must be 2^n times 1...63 (with n >= 3), while being 16, 24, 32 or larger, and exactly divisible by limb count");
-
-    // The type of the internal data representation.
-    using representation_type =
-      typename std::conditional
-        <std::is_same<AllocatorType, void>::value,
-         detail::fixed_static_array <limb_type,
-                                     number_of_limbs>,
-         detail::fixed_dynamic_array<limb_type,
-                                     number_of_limbs,
-                                     typename std::allocator_traits<typename std::conditional<std::is_same<AllocatorType, void>::value,
-                                                                                              std::allocator<void>,
-                                                                                              AllocatorType>::type>::template rebind_alloc<limb_type>>
-        >::type;
-
-    // The iterator types of the internal data representation.
-    using iterator               = typename representation_type::iterator;
-    using const_iterator         = typename representation_type::const_iterator;
-    using reverse_iterator       = typename representation_type::reverse_iterator;
-    using const_reverse_iterator = typename representation_type::const_reverse_iterator;
-
-    // Define a class-local type that has double the width of *this.
-    using double_width_type = uintwide_t<size_t(Width2 * 2U), limb_type, AllocatorType, IsSigned>;
-
-    // Default constructor.
-    constexpr uintwide_t() = default;
+    static WIDE_INTEGER_CONSTEXPR auto sub(const std::uint32_t a, const std::uint32_t b) -> std::uint32_t
+    {
+      return std::uint32_t(std::uint32_t(a - b) + ((a < b) ? Modulus : 0U));
+    }
 
-    // Constructors from built-in unsigned integral types that
-    // are less wide than limb_type or exactly as wide as limb_type.
-    template<typename UnsignedIntegralType>
-    constexpr uintwide_t(const UnsignedIntegralType v, // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-                         typename std::enable_if<(   (std::is_integral   <UnsignedIntegralType>::value)
-                                                  && (std::is_unsigned   <UnsignedIntegralType>::value)
-                                                  && (std::numeric_limits<UnsignedIntegralType>::digits <= std::numeric_limits<limb_type>::digits))>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
-      : values(1U, v) { }
+    static WIDE_INTEGER_CONSTEXPR auto mul(const std::uint32_t a, const std::uint32_t b) -> std::uint32_t
+    {
+      return std::uint32_t(std::uint64_t(std::uint64_t(a) * b) % Modulus);
+    }
 
-    // Constructors from built-in unsigned integral types that
-    // are wider than limb_type, and do not have exactly the
-    // same width as limb_type.
-    template<typename UnsignedIntegralType>
-    WIDE_INTEGER_CONSTEXPR uintwide_t(const UnsignedIntegralType v, // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-                                      typename std::enable_if<(   (std::is_integral   <UnsignedIntegralType>::value)
-                                                               && (std::is_unsigned   <UnsignedIntegralType>::value)
-                                                               && (std::numeric_limits<UnsignedIntegralType>::digits > std::numeric_limits<limb_type>::digits))>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
+    static WIDE_INTEGER_CONSTEXPR auto pow(const std::uint32_t b, const std::uint32_t p) -> std::uint32_t
     {
-      unsinged_fast_type right_shift_amount_v = 0U;
-      std::uint_fast8_t  index_u              = 0U;
+      std::uint32_t result = 1U;
+      std::uint32_t y      = b;
 
-      for( ; (   (index_u < values.size())
-              && (right_shift_amount_v < unsinged_fast_type(std::numeric_limits<UnsignedIntegralType>::digits)));
-             ++index_u)
+      for(std::uint32_t p_local = p; p_local != 0U; p_local >>= 1U)
       {
-        *(values.begin() + size_t(index_u)) = limb_type(v >> unsigned(right_shift_amount_v));
+        if((p_local & 1U) != 0U) { result = mul(result, y); }
 
-        right_shift_amount_v += unsinged_fast_type(std::numeric_limits<limb_type>::digits);
+        y = mul(y, y);
       }
 
-      std::fill(values.begin() + index_u, values.end(), limb_type(0U));
+      return result;
     }
 
-    // Constructors from built-in signed integral types.
-    template<typename SignedIntegralType>
-    WIDE_INTEGER_CONSTEXPR uintwide_t(const SignedIntegralType v, // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-                                      typename std::enable_if<(   (std::is_integral   <SignedIntegralType>::value)
-                                                               && (std::is_signed     <SignedIntegralType>::value))>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
+    template<typename ValueIterator>
+    static WIDE_INTEGER_CONSTEXPR void twiddles(ValueIterator w, const size_t len)
     {
-      using local_signed_integral_type   = SignedIntegralType;
-      using local_unsigned_integral_type =
-        typename detail::uint_type_helper<size_t(std::numeric_limits<local_signed_integral_type>::digits + 1)>::exact_unsigned_type;
+      // The powers w[j] = r^j, j < len/2, of a primitive len-th root of unity r.
 
-      const bool v_is_neg = (v < local_signed_integral_type(0));
+      using value_difference_type = typename std::iterator_traits<ValueIterator>::difference_type;
 
-      const local_unsigned_integral_type u =
-        ((!v_is_neg) ? local_unsigned_integral_type(v) : local_unsigned_integral_type(detail::negate(v)));
+      const std::uint32_t r = pow(Generator, std::uint32_t((Modulus - 1U) / std::uint32_t(len)));
 
-      operator=(uintwide_t(u));
+      std::uint32_t w_j = 1U;
 
-      if(v_is_neg) { negate(); }
+      for(size_t j = 0U; j < size_t(len / 2U); ++j)
+      {
+        *(w + value_difference_type(j)) = w_j;
+
+        w_j = mul(w_j, r);
+      }
     }
 
-    #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-    template<typename FloatingPointType,
-             typename std::enable_if<(std::is_floating_point<FloatingPointType>::value)>::type const* = nullptr>
-    WIDE_INTEGER_CONSTEXPR uintwide_t(const FloatingPointType f) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    template<typename ValueIterator,
+             typename TwiddleIterator>
+    static WIDE_INTEGER_CONSTEXPR void transform(ValueIterator f, TwiddleIterator w, const size_t len, const bool is_inverse)
     {
-      using local_builtin_float_type = FloatingPointType;
+      // Iterative radix-2 decimation-in-time transform of length len
+      // (a power of 2), using the twiddle factors w of that length.
+      // The inverse transform is obtained from the forward transform
+      // by reversing the order of the outputs 1...len-1 and scaling.
 
-      using detail::my_own::isfinite;
+      using value_difference_type   = typename std::iterator_traits<ValueIterator>::difference_type;
+      using twiddle_difference_type = typename std::iterator_traits<TwiddleIterator>::difference_type;
 
-      if(isfinite(f) == false)
-      {
-        operator=(0U);
-      }
-      else
+      for(size_t i = 1U, j = 0U; i < len; ++i)
       {
-        const bool f_is_neg = (f < local_builtin_float_type(0.0F));
+        size_t bit = size_t(len >> 1U);
 
-        const local_builtin_float_type a = ((!f_is_neg) ? f : -f);
+        for( ; (j & bit) != 0U; bit = size_t(bit >> 1U))
+        {
+          j = size_t(j ^ bit);
+        }
 
-        const bool a_is_zero = (a < local_builtin_float_type(1.0F));
+        j = size_t(j ^ bit);
 
-        if(!a_is_zero)
+        if(i < j)
         {
-          const detail::native_float_parts<local_builtin_float_type> ld_parts(a);
-
-          // Create a decwide_t from the fractional part of the
-          // mantissa expressed as an unsigned long long.
-          *this = uintwide_t(ld_parts.get_mantissa());
+          const std::uint32_t tmp = *(f + value_difference_type(i));
 
-          // Scale the unsigned long long representation to the fractional
-          // part of the long double and multiply with the base-2 exponent.
-          const int p2 = ld_parts.get_exponent() - (std::numeric_limits<FloatingPointType>::digits - 1);
+          *(f + value_difference_type(i)) = *(f + value_difference_type(j));
+          *(f + value_difference_type(j)) = tmp;
+        }
+      }
 
-          if     (p2 <   0) { *this >>= static_cast<unsigned>(-p2); }
-          else if(p2 ==  0) { ; }
-          else              { *this <<= static_cast<unsigned>( p2); }
+      for(size_t m = 2U; m <= len; m = size_t(m * 2U))
+      {
+        const size_t half = size_t(m / 2U);
+        const size_t step = size_t(len / m);
 
-          if(f_is_neg)
+        for(size_t k = 0U; k < len; k = size_t(k + m))
+        {
+          for(size_t j = 0U; j < half; ++j)
           {
-            negate();
+            const std::uint32_t u = *(f + value_difference_type(k + j));
+            const std::uint32_t v = mul(*(f + value_difference_type(k + j + half)), *(w + twiddle_difference_type(j * step)));
+
+            *(f + value_difference_type(k + j))        = add(u, v);
+            *(f + value_difference_type(k + j + half)) = sub(u, v);
           }
         }
-        else
+      }
+
+      if(is_inverse)
+      {
+        for(size_t i = 1U, j = size_t(len - 1U); i < j; ++i, --j)
         {
-          operator=(0U);
+          const std::uint32_t tmp = *(f + value_difference_type(i));
+
+          *(f + value_difference_type(i)) = *(f + value_difference_type(j));
+          *(f + value_difference_type(j)) = tmp;
+        }
+
+        const std::uint32_t len_inv = pow(std::uint32_t(len % Modulus), std::uint32_t(Modulus - 2U));
+
+        for(size_t i = 0U; i < len; ++i)
+        {
+          *(f + value_difference_type(i)) = mul(*(f + value_difference_type(i)), len_inv);
         }
       }
     }
-    #endif
+  };
 
-    // Copy constructor.
-    constexpr uintwide_t(const uintwide_t& other) = default;
+  // The primes 7 * 2^26 + 1 and 5 * 2^25 + 1, both having the primitive root 3.
+  // The product of the two primes exceeds 2^56, which bounds the convolution
+  // of up to 2^24 16-bit digits. The transform length is limited to 2^25.
+  using ntt_prime_0 = ntt_prime<UINT32_C(469762049), UINT32_C(3)>;
+  using ntt_prime_1 = ntt_prime<UINT32_C(167772161), UINT32_C(3)>;
 
-    // Copy-like constructor from the other signed-ness type.
-    template<const bool OtherIsSigned,
-             typename std::enable_if<(OtherIsSigned != IsSigned)>::type const* = nullptr>
-    constexpr uintwide_t(const uintwide_t<Width2, LimbType, AllocatorType, OtherIsSigned>& other) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-      : values(other.values) { }
+  constexpr auto ntt_length(const size_t digit_count, const size_t len = size_t(1U)) -> size_t // NOLINT(misc-no-recursion)
+  {
+    // The smallest power of 2 which is at least digit_count.
+    return (len >= digit_count) ? len : ntt_length(digit_count, size_t(len * 2U));
+  }
 
-    // Constructor from the another type having a different width but the same limb type.
-    // This constructor is explicit because it is a non-trivial conversion.
+  #if (WIDE_INTEGER_LIMB_KERNELS_ARE_ACTIVE == 1)
+  constexpr auto is_constant_evaluated() noexcept -> bool
+  {
+    #if (WIDE_INTEGER_CONSTEXPR_IS_COMPILE_TIME_CONST == 0)
+    return false;
+    #elif (defined(__cpp_lib_is_constant_evaluated) && (__cpp_lib_is_constant_evaluated >= 201811L))
+    return std::is_constant_evaluated();
+    #else
+    return __builtin_is_constant_evaluated();
+    #endif
+  }
 
-    // TBD: The keyword "explicit" is missing and the code at the moment does not agree with the comment.
-    // TBD: Figure out if the keyword "explicit" is needed/wanted or not and correct code/comment to agree
-    // with each other.
-    template<const size_t OtherWidth2>
-    WIDE_INTEGER_CONSTEXPR uintwide_t(const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+  template<typename IteratorType>
+  struct is_limb_kernel_pointer
+    : std::integral_constant<bool, (   std::is_pointer<IteratorType>::value
+                                    && std::is_same<std::uint64_t, typename std::remove_cv<typename std::remove_pointer<IteratorType>::type>::type>::value)> { };
+
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename InputIteratorRight = InputIteratorLeft>
+  struct limb_kernels_apply
+    : std::integral_constant<bool, (   is_limb_kernel_pointer<ResultIterator>::value
+                                    && is_limb_kernel_pointer<InputIteratorLeft>::value
+                                    && is_limb_kernel_pointer<InputIteratorRight>::value)> { };
+
+  #if (WIDE_INTEGER_X86_64_ADX_KERNELS_ARE_ACTIVE == 1)
+  // Limb kernels for x86-64 having ADX and BMI2. These carry the
+  // carries in the flags rather than in a 128-bit intermediate.
+  // The loop control uses lea, dec and jrcxz, none of which
+  // touch the carry flag (and lea and jrcxz not the overflow flag).
+
+  inline auto limb_kernel_add_n(      std::uint64_t* r,
+                                const std::uint64_t* u,
+                                const std::uint64_t* v,
+                                      std::uint64_t  count,
+                                      std::uint64_t  carry) -> std::uint64_t
+  {
+    // Set r = u + v + carry and return the carry out.
+    if(count != 0U)
     {
-      using other_wide_integer_type = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>;
-
-      const bool v_is_neg = (other_wide_integer_type::is_neg(v));
+      std::uint64_t t { };
 
-      const size_t sz =
-        (std::min)(size_t(v.crepresentation().size()),
-                   size_t(number_of_limbs));
+      __asm__ __volatile__
+      (
+        "negq %[c]\n\t"
+        "1:\n\t"
+        "movq (%[u]), %[t]\n\t"
+        "adcq (%[v]), %[t]\n\t"
+        "movq %[t], (%[r])\n\t"
+        "leaq 8(%[u]), %[u]\n\t"
+        "leaq 8(%[v]), %[v]\n\t"
+        "leaq 8(%[r]), %[r]\n\t"
+        "decq %[n]\n\t"
+        "jnz 1b\n\t"
+        "setc %b[c]\n\t"
+        "movzbl %b[c], %k[c]\n\t"
+        : [c] "+&r" (carry), [t] "=&r" (t), [n] "+&r" (count), [r] "+&r" (r), [u] "+&r" (u), [v] "+&r" (v)
+        :
+        : "cc", "memory"
+      );
+    }
 
-      if(!v_is_neg)
-      {
-        std::copy(v.crepresentation().cbegin(),
-                  v.crepresentation().cbegin() + sz,
-                  values.begin());
+    return carry;
+  }
 
-        std::fill(values.begin() + sz, values.end(), limb_type(0U));
-      }
-      else
-      {
-        const other_wide_integer_type uv(-v);
+  inline auto limb_kernel_sub_n(      std::uint64_t* r,
+                                const std::uint64_t* u,
+                                const std::uint64_t* v,
+                                      std::uint64_t  count,
+                                      std::uint64_t  borrow) -> std::uint64_t
+  {
+    // Set r = u - v - borrow and return the borrow out.
+    if(count != 0U)
+    {
+      std::uint64_t t { };
 
-        std::copy(uv.crepresentation().cbegin(),
-                  uv.crepresentation().cbegin() + sz,
-                  values.begin());
+      __asm__ __volatile__
+      (
+        "negq %[c]\n\t"
+        "1:\n\t"
+        "movq (%[u]), %[t]\n\t"
+        "sbbq (%[v]), %[t]\n\t"
+        "movq %[t], (%[r])\n\t"
+        "leaq 8(%[u]), %[u]\n\t"
+        "leaq 8(%[v]), %[v]\n\t"
+        "leaq 8(%[r]), %[r]\n\t"
+        "decq %[n]\n\t"
+        "jnz 1b\n\t"
+        "setc %b[c]\n\t"
+        "movzbl %b[c], %k[c]\n\t"
+        : [c] "+&r" (borrow), [t] "=&r" (t), [n] "+&r" (count), [r] "+&r" (r), [u] "+&r" (u), [v] "+&r" (v)
+        :
+        : "cc", "memory"
+      );
+    }
 
-        std::fill(values.begin() + sz, values.end(), limb_type(0U));
+    return borrow;
+  }
 
-        negate();
-      }
-    }
+  inline auto limb_kernel_mul_1(      std::uint64_t* r,
+                                const std::uint64_t* a,
+                                      std::uint64_t  b,
+                                      std::uint64_t  count) -> std::uint64_t
+  {
+    // Set r = a * b and return the high limb.
+    std::uint64_t carry { };
 
-    // Constructor from a constant character string.
-    WIDE_INTEGER_CONSTEXPR uintwide_t(const char* str_input) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    if(count != 0U)
     {
-      if(rd_string(str_input) == false)
-      {
-        std::fill(values.begin(), values.end(), (std::numeric_limits<limb_type>::max)());
-      }
+      std::uint64_t lo { };
+      std::uint64_t hi { };
+
+      __asm__ __volatile__
+      (
+        "xorl %k[lo], %k[lo]\n\t"
+        "1:\n\t"
+        "mulxq (%[a]), %[lo], %[hi]\n\t"
+        "adcxq %[c], %[lo]\n\t"
+        "movq %[lo], (%[r])\n\t"
+        "movq %[hi], %[c]\n\t"
+        "leaq 8(%[a]), %[a]\n\t"
+        "leaq 8(%[r]), %[r]\n\t"
+        "decq %[n]\n\t"
+        "jnz 1b\n\t"
+        "adcq $0, %[c]\n\t"
+        : [c] "+&r" (carry), [lo] "=&r" (lo), [hi] "=&r" (hi), [n] "+&r" (count), [r] "+&r" (r), [a] "+&r" (a)
+        : "d" (b)
+        : "cc", "memory"
+      );
     }
 
-    // Move constructor.
-    constexpr uintwide_t(uintwide_t&& other) noexcept = default;
+    return carry;
+  }
 
-    // Move-like constructor from the other signed-ness type.
-    template<const bool OtherIsSigned,
-             typename std::enable_if<(OtherIsSigned != IsSigned)>::type const* = nullptr>
-    constexpr uintwide_t(uintwide_t<Width2, LimbType, AllocatorType, OtherIsSigned>&& other) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-      : values(static_cast<representation_type&&>(other.values)) { }
+  inline auto limb_kernel_addmul_1(      std::uint64_t* r,
+                                   const std::uint64_t* a,
+                                         std::uint64_t  b,
+                                         std::uint64_t  count) -> std::uint64_t
+  {
+    // Set r = r + (a * b) and return the high limb. The low parts
+    // of the products and the high parts of their neighbors are added
+    // in the carry chain (adcx), the old values of r in the overflow
+    // chain (adox). The two chains run through blocks of four limbs.
+    std::uint64_t carry { };
 
-    // Assignment operator.
-    WIDE_INTEGER_CONSTEXPR auto operator=(const uintwide_t& other) -> uintwide_t& = default;
+    std::uint64_t blocks = count / 4U;
 
-    // Assignment operator from the other signed-ness type.
-    template<const bool OtherIsSigned,
-             typename std::enable_if<(OtherIsSigned != IsSigned)>::type const* = nullptr>
-    WIDE_INTEGER_CONSTEXPR auto operator=(const uintwide_t<Width2, LimbType, AllocatorType, OtherIsSigned>& other) -> uintwide_t&
+    if(blocks != 0U)
     {
-      values = other.values;
+      std::uint64_t lo { };
+      std::uint64_t hi { };
+      std::uint64_t zero { };
 
-      return *this;
+      __asm__ __volatile__
+      (
+        "xorl %k[z], %k[z]\n\t"
+        "1:\n\t"
+        "mulxq   (%[a]), %[lo], %[hi]\n\t"
+        "adcxq %[c], %[lo]\n\t"
+        "adoxq   (%[r]), %[lo]\n\t"
+        "movq %[lo],   (%[r])\n\t"
+        "mulxq  8(%[a]), %[lo], %[c]\n\t"
+        "adcxq %[hi], %[lo]\n\t"
+        "adoxq  8(%[r]), %[lo]\n\t"
+        "movq %[lo],  8(%[r])\n\t"
+        "mulxq 16(%[a]), %[lo], %[hi]\n\t"
+        "adcxq %[c], %[lo]\n\t"
+        "adoxq 16(%[r]), %[lo]\n\t"
+        "movq %[lo], 16(%[r])\n\t"
+        "mulxq 24(%[a]), %[lo], %[c]\n\t"
+        "adcxq %[hi], %[lo]\n\t"
+        "adoxq 24(%[r]), %[lo]\n\t"
+        "movq %[lo], 24(%[r])\n\t"
+        "leaq 32(%[a]), %[a]\n\t"
+        "leaq 32(%[r]), %[r]\n\t"
+        "leaq -1(%[n]), %[n]\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n\t"
+        "2:\n\t"
+        "adcxq %[z], %[c]\n\t"
+        "adoxq %[z], %[c]\n\t"
+        : [c] "+&r" (carry), [lo] "=&r" (lo), [hi] "=&r" (hi), [z] "=&r" (zero), [n] "+&c" (blocks), [r] "+&r" (r), [a] "+&r" (a)
+        : "d" (b)
+        : "cc", "memory"
+      );
     }
 
-    // Trivial move assignment operator.
-    WIDE_INTEGER_CONSTEXPR auto operator=(uintwide_t&& other) noexcept -> uintwide_t& = default;
-
-    // Trivial move assignment operator from the other signed-ness type.
-    template<const bool OtherIsSigned,
-             typename std::enable_if<(OtherIsSigned != IsSigned)>::type const* = nullptr>
-    WIDE_INTEGER_CONSTEXPR auto operator=(uintwide_t<Width2, LimbType, AllocatorType, OtherIsSigned>&& other) -> uintwide_t&
+    for(auto i = static_cast<std::uint64_t>(count % 4U); i != 0U; --i)
     {
-      values = static_cast<representation_type&&>(other.values);
+      const auto t =
+        static_cast<unsigned __int128>(static_cast<unsigned __int128>(static_cast<unsigned __int128>(*a) * b) + *r) + carry;
 
-      return *this;
+      *r    = static_cast<std::uint64_t>(t);
+      carry = static_cast<std::uint64_t>(t >> 64U);
+
+      ++a; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      ++r; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     }
 
-    #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-    explicit constexpr operator long double() const { return extract_builtin_floating_point_type<long double>(); }
-    explicit constexpr operator double     () const { return extract_builtin_floating_point_type<double>     (); }
-    explicit constexpr operator float      () const { return extract_builtin_floating_point_type<float>      (); }
-    #endif
+    return carry;
+  }
 
-    template<typename Integer, typename = typename std::enable_if<std::is_integral<Integer>::value>::type>
-    explicit constexpr operator Integer() const { return ((is_neg(*this) == false) ? extract_builtin_integral_type<Integer>() : detail::negate(uintwide_t(-*this).extract_builtin_integral_type<Integer>())); }
+  #endif
 
-    explicit constexpr operator bool() const { return !is_zero(); }
+  // The following dispatchers return false (and do nothing) unless
+  // all of their iterators are pointers to 64-bit limbs.
 
-    // Implement the cast operator that casts to the double-width type.
-    template<typename UnknownUnsignedWideIntegralType,
-             typename = typename std::enable_if<(std::is_same<UnknownUnsignedWideIntegralType, double_width_type>::value)>::type>
-    WIDE_INTEGER_CONSTEXPR operator double_width_type() const // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-    {
-      double_width_type local_double_width_instance;
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename InputIteratorRight,
+           typename LimbType>
+  inline auto limb_kernel_try_add_n(ResultIterator r, InputIteratorLeft u, InputIteratorRight v, unsinged_fast_type count, LimbType& carry) -> typename std::enable_if<limb_kernels_apply<ResultIterator, InputIteratorLeft, InputIteratorRight>::value, bool>::type
+  {
+    carry = static_cast<LimbType>(limb_kernel_add_n(r, u, v, static_cast<std::uint64_t>(count), static_cast<std::uint64_t>(carry)));
 
-      std::copy(values.cbegin(),
-                values.cend(),
-                local_double_width_instance.representation().begin());
+    return true;
+  }
 
-      std::fill(local_double_width_instance.representation().begin() + number_of_limbs,
-                local_double_width_instance.representation().end(),
-                limb_type(0U));
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename InputIteratorRight,
+           typename LimbType>
+  inline auto limb_kernel_try_add_n(ResultIterator, InputIteratorLeft, InputIteratorRight, unsinged_fast_type, LimbType&) -> typename std::enable_if<(!limb_kernels_apply<ResultIterator, InputIteratorLeft, InputIteratorRight>::value), bool>::type // NOLINT(hicpp-named-parameter,readability-named-parameter)
+  {
+    return false;
+  }
 
-      return local_double_width_instance;
-    }
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename InputIteratorRight>
+  inline auto limb_kernel_try_subtract_n(ResultIterator r, InputIteratorLeft u, InputIteratorRight v, unsinged_fast_type count, bool& has_borrow) -> typename std::enable_if<limb_kernels_apply<ResultIterator, InputIteratorLeft, InputIteratorRight>::value, bool>::type
+  {
+    has_borrow = (limb_kernel_sub_n(r, u, v, static_cast<std::uint64_t>(count), (has_borrow ? 1U : 0U)) != 0U);
 
-    // Implement a cast operator that casts to a uintwide_t having the other signed-ness type.
-    template<const bool OtherIsSigned,
-             typename std::enable_if<(OtherIsSigned != IsSigned)>::type const* = nullptr>
-    explicit WIDE_INTEGER_CONSTEXPR operator uintwide_t<Width2, LimbType, AllocatorType, OtherIsSigned>() const
-    {
-      return uintwide_t<Width2, LimbType, AllocatorType, OtherIsSigned>(values);
-    }
+    return true;
+  }
 
-    // Provide a user interface to the internal data representation.
-    WIDE_INTEGER_CONSTEXPR auto  representation()       ->       representation_type& { return values; }
-    WIDE_INTEGER_CONSTEXPR auto  representation() const -> const representation_type& { return values; }
-    WIDE_INTEGER_CONSTEXPR auto crepresentation() const -> const representation_type& { return values; }
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename InputIteratorRight>
+  inline auto limb_kernel_try_subtract_n(ResultIterator, InputIteratorLeft, InputIteratorRight, unsinged_fast_type, bool&) -> typename std::enable_if<(!limb_kernels_apply<ResultIterator, InputIteratorLeft, InputIteratorRight>::value), bool>::type // NOLINT(hicpp-named-parameter,readability-named-parameter)
+  {
+    return false;
+  }
 
-    // Unary operators: not, plus and minus.
-    WIDE_INTEGER_CONSTEXPR auto operator+() const -> const uintwide_t& { return *this; }
-    WIDE_INTEGER_CONSTEXPR auto operator-() const ->       uintwide_t  { uintwide_t tmp(*this); tmp.negate(); return tmp; }
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename LimbType>
+  inline auto limb_kernel_try_multiply_1d(ResultIterator r, InputIteratorLeft a, LimbType b, unsinged_fast_type count, LimbType& carry) -> typename std::enable_if<limb_kernels_apply<ResultIterator, InputIteratorLeft>::value, bool>::type
+  {
+    carry = static_cast<LimbType>(limb_kernel_mul_1(r, a, static_cast<std::uint64_t>(b), static_cast<std::uint64_t>(count)));
 
-    WIDE_INTEGER_CONSTEXPR auto operator+=(const uintwide_t& other) -> uintwide_t&
-    {
-      if(this == &other)
-      {
-        const uintwide_t self(other);
+    return true;
+  }
 
-        // Unary addition function.
-        const limb_type carry = eval_add_n(values.data(),
-                                           values.data(),
-                                           self.values.data(),
-                                           unsinged_fast_type(number_of_limbs),
-                                           limb_type(0U));
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename LimbType>
+  inline auto limb_kernel_try_multiply_1d(ResultIterator, InputIteratorLeft, LimbType, unsinged_fast_type, LimbType&) -> typename std::enable_if<(!limb_kernels_apply<ResultIterator, InputIteratorLeft>::value), bool>::type // NOLINT(hicpp-named-parameter,readability-named-parameter)
+  {
+    return false;
+  }
 
-        static_cast<void>(carry);
-      }
-      else
-      {
-        // Unary addition function.
-        const limb_type carry = eval_add_n(values.data(),
-                                           values.data(),
-                                           other.values.data(),
-                                           unsinged_fast_type(number_of_limbs),
-                                           limb_type(0U));
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename InputIteratorRight>
+  inline auto limb_kernel_try_multiply_n_by_n(ResultIterator r, InputIteratorLeft a, InputIteratorRight b, unsinged_fast_type count, bool to_2n) -> typename std::enable_if<limb_kernels_apply<ResultIterator, InputIteratorLeft, InputIteratorRight>::value, bool>::type
+  {
+    // Schoolbook multiplication by rows. Retain either
+    // the low count limbs or all 2 * count limbs of the product.
+    if(count != 0U)
+    {
+      const auto n = static_cast<std::uint64_t>(count);
 
-        static_cast<void>(carry);
-      }
+      const std::uint64_t carry = limb_kernel_mul_1(r, b, *a, n);
 
-      return *this;
-    }
+      if(to_2n) { *(r + n) = carry; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-    WIDE_INTEGER_CONSTEXPR auto operator-=(const uintwide_t& other) -> uintwide_t&
-    {
-      if(this == &other)
-      {
-        values.fill(0U);
-      }
-      else
+      for(auto i = static_cast<std::uint64_t>(1U); i < n; ++i)
       {
-        // Unary subtraction function.
-        const limb_type has_borrow = eval_subtract_n(values.data(),
-                                                     values.data(),
-                                                     other.values.data(),
-                                                     number_of_limbs,
-                                                     false);
+        const std::uint64_t ai = *(a + i); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-        static_cast<void>(has_borrow);
+        if(to_2n)
+        {
+          *(r + (n + i)) = limb_kernel_addmul_1(r + i, b, ai, n); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        else
+        {
+          static_cast<void>(limb_kernel_addmul_1(r + i, b, ai, n - i)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
       }
-
-      return *this;
     }
 
-    WIDE_INTEGER_CONSTEXPR auto operator*=(const uintwide_t& other) -> uintwide_t&
-    {
-      if(this == &other)
-      {
-        const uintwide_t self(other); // NOLINT(performance-unnecessary-copy-initialization)
+    return true;
+  }
 
-        eval_mul_unary(*this, self);
-      }
-      else
-      {
-        eval_mul_unary(*this, other);
-      }
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename InputIteratorRight>
+  inline auto limb_kernel_try_multiply_n_by_n(ResultIterator, InputIteratorLeft, InputIteratorRight, unsinged_fast_type, bool) -> typename std::enable_if<(!limb_kernels_apply<ResultIterator, InputIteratorLeft, InputIteratorRight>::value), bool>::type // NOLINT(hicpp-named-parameter,readability-named-parameter)
+  {
+    return false;
+  }
 
-      return *this;
-    }
+  template<typename ResultIterator,
+           typename InputIteratorLeft>
+  inline auto limb_kernel_try_square_n_cross_products(ResultIterator r, InputIteratorLeft a, unsinged_fast_type count, bool to_2n) -> typename std::enable_if<limb_kernels_apply<ResultIterator, InputIteratorLeft>::value, bool>::type
+  {
+    // Sum the cross products a_i * a_j with i < j into r. Retain either
+    // the low count limbs or all 2 * count limbs of the sum.
+    const auto n = static_cast<std::uint64_t>(count);
 
-    WIDE_INTEGER_CONSTEXPR auto mul_by_limb(const limb_type v) -> uintwide_t&
+    std::fill(r, r + (to_2n ? (n * 2U) : n), std::uint64_t(0U)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for(auto i = static_cast<std::uint64_t>(0U); ((i + 1U) < n) && (to_2n || (((i * 2U) + 1U) < n)); ++i)
     {
-      if(v == limb_type(0U))
+      const std::uint64_t ai = *(a + i); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      if(to_2n)
       {
-        values.fill(0U);
+        *(r + (n + i)) = limb_kernel_addmul_1(r + ((i * 2U) + 1U), a + (i + 1U), ai, n - (i + 1U)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       }
-      else if(v > limb_type(1U))
+      else
       {
-        static_cast<void>(eval_multiply_1d(values.data(),
-                                           values.data(),
-                                           v,
-                                           number_of_limbs));
+        static_cast<void>(limb_kernel_addmul_1(r + ((i * 2U) + 1U), a + (i + 1U), ai, n - ((i * 2U) + 1U))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       }
-
-      return *this;
     }
 
-    WIDE_INTEGER_CONSTEXPR auto operator/=(const uintwide_t& other) -> uintwide_t&
-    {
-      if(this == &other)
-      {
-        values.front() = 1U;
+    return true;
+  }
 
-        std::fill(values.begin() + 1U, values.end(), limb_type(0U));
-      }
-      else if(other.is_zero())
-      {
-        *this = limits_helper_max(IsSigned);
-      }
-      else
-      {
-        // Unary division function.
+  template<typename ResultIterator,
+           typename InputIteratorLeft>
+  inline auto limb_kernel_try_square_n_cross_products(ResultIterator, InputIteratorLeft, unsinged_fast_type, bool) -> typename std::enable_if<(!limb_kernels_apply<ResultIterator, InputIteratorLeft>::value), bool>::type // NOLINT(hicpp-named-parameter,readability-named-parameter)
+  {
+    return false;
+  }
 
-        const bool numererator_was_neg = is_neg(*this);
-        const bool denominator_was_neg = is_neg(other);
+  #endif
 
-        if(numererator_was_neg || denominator_was_neg)
-        {
-          using local_unsigned_wide_type = uintwide_t<Width2, limb_type, AllocatorType, false>;
+  } // namespace detail
+  } // namespace wide_integer
+  } // namespace math
 
-          local_unsigned_wide_type a(*this);
-          local_unsigned_wide_type b(other);
+  namespace math { namespace wide_integer {
 
-          if(numererator_was_neg) { a.negate(); }
-          if(denominator_was_neg) { b.negate(); }
+  template<typename LimbType>
+  class limb_divisor
+  {
+    // A single-limb divisor d together with the precomputed reciprocal
+    // of its normalized value. Dividing a long number by d then needs
+    // only multiplications, since each 2-by-1 quotient limb is obtained
+    // from the reciprocal. Construct the divisor once and reuse it
+    // for repeated divisions by one and the same (invariant) limb.
+    // See N. Moeller and T. Granlund, "Improved division by invariant
+    // integers", IEEE Transactions on Computers 60 (2011), Algorithm 4.
 
-          a.eval_divide_knuth(b, nullptr);
+  public:
+    using limb_type = LimbType;
 
-          if(numererator_was_neg != denominator_was_neg) { a.negate(); }
+    using double_limb_type =
+      typename detail::uint_type_helper<size_t(std::numeric_limits<limb_type>::digits * 2)>::exact_unsigned_type;
 
-          values = a.values;
-        }
-        else
-        {
-          eval_divide_knuth(other, nullptr);
-        }
-      }
+    static_assert((    ( std::numeric_limits<limb_type>::is_integer)
+                   &&  (!std::numeric_limits<limb_type>::is_signed)),
+                   "Error: The limb type of limb_divisor must be an unsigned integral type");
+
+    explicit WIDE_INTEGER_CONSTEXPR limb_divisor(const limb_type d)
+      : my_divisor   (d),
+        my_shift     ((d == limb_type(0U)) ? unsinged_fast_type(0U) : unsinged_fast_type(unsinged_fast_type(std::numeric_limits<limb_type>::digits - 1) - detail::msb_helper(d))),
+        my_normalized(static_cast<limb_type>(d << unsigned(my_shift))),
+        my_reciprocal(reciprocal_of_normalized(my_normalized)) { }
+
+    constexpr auto divisor   () const -> limb_type          { return my_divisor; }
+    constexpr auto shift     () const -> unsinged_fast_type { return my_shift; }
+    constexpr auto normalized() const -> limb_type          { return my_normalized; }
+    constexpr auto reciprocal() const -> limb_type          { return my_reciprocal; }
+
+    // Divide the two-limb numerator (u_hi, u_lo) by the normalized
+    // divisor, where u_hi must be less than the normalized divisor.
+    // Return the quotient limb and store the remainder limb in r.
+    WIDE_INTEGER_CONSTEXPR auto divide_2_by_1(const limb_type u_hi, const limb_type u_lo, limb_type& r) const -> limb_type
+    {
+      const auto q =
+        static_cast<double_limb_type>
+        (
+            static_cast<double_limb_type>(static_cast<double_limb_type>(my_reciprocal) * u_hi)
+          + static_cast<double_limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(u_hi) + 1U) << unsigned(std::numeric_limits<limb_type>::digits))
+          + u_lo
+        );
 
-      return *this;
-    }
+      auto       q1 = detail::make_hi<limb_type>(q);
+      const auto q0 = detail::make_lo<limb_type>(q);
 
-    WIDE_INTEGER_CONSTEXPR auto operator%=(const uintwide_t& other) -> uintwide_t&
-    {
-      if(this == &other)
+      r = static_cast<limb_type>(u_lo - static_cast<limb_type>(static_cast<double_limb_type>(q1) * my_normalized));
+
+      if(r > q0)
       {
-        std::fill(values.begin(), values.end(), limb_type(0U));
+        --q1;
+
+        r = static_cast<limb_type>(r + my_normalized);
       }
-      else
-      {
-        // Unary modulus function.
-        const bool numererator_was_neg = is_neg(*this);
-        const bool denominator_was_neg = is_neg(other);
 
-        if(numererator_was_neg || denominator_was_neg)
-        {
-          using local_unsigned_wide_type = uintwide_t<Width2, limb_type, AllocatorType, false>;
+      if(r >= my_normalized)
+      {
+        ++q1;
 
-          local_unsigned_wide_type a(*this);
-          local_unsigned_wide_type b(other);
+        r = static_cast<limb_type>(r - my_normalized);
+      }
 
-          if(numererator_was_neg) { a.negate(); }
-          if(denominator_was_neg) { b.negate(); }
+      return q1;
+    }
 
-          local_unsigned_wide_type remainder;
+    // Divide the count limbs (least significant limb first) at u
+    // in place by the divisor and return the remainder.
+    template<typename ForwardIterator>
+    WIDE_INTEGER_CONSTEXPR auto divide(ForwardIterator u, const unsinged_fast_type count) const -> limb_type
+    {
+      constexpr auto limb_digits = static_cast<unsigned>(std::numeric_limits<limb_type>::digits);
 
-          a.eval_divide_knuth(b, &remainder);
+      const auto left_shift  = static_cast<unsigned>(my_shift);
+      const auto right_shift = static_cast<unsigned>(limb_digits - left_shift);
 
-          // The sign of the remainder follows the sign of the denominator.
-          // TBD: Verify if this is always the correct sign of the remainder.
-          if(numererator_was_neg) { remainder.negate(); }
+      auto rem = limb_type(0U);
 
-          values = remainder.values;
+      if(count != 0U)
+      {
+        // The bits shifted out of the most significant limb by the
+        // normalization start the running remainder.
+        if(left_shift != 0U)
+        {
+          rem = static_cast<limb_type>(*(u + size_t(count - 1U)) >> right_shift);
         }
-        else
+
+        for(auto i = count; i != 0U; --i)
         {
-          uintwide_t remainder;
+          auto u_lo = static_cast<limb_type>(*(u + size_t(i - 1U)) << left_shift);
 
-          eval_divide_knuth(other, &remainder);
+          if((left_shift != 0U) && (i > 1U))
+          {
+            u_lo = static_cast<limb_type>(u_lo | static_cast<limb_type>(*(u + size_t(i - 2U)) >> right_shift));
+          }
 
-          values = remainder.values;
+          *(u + size_t(i - 1U)) = divide_2_by_1(rem, u_lo, rem);
         }
       }
 
-      return *this;
+      return static_cast<limb_type>(rem >> left_shift);
     }
 
-    // Operators pre-increment and pre-decrement.
-    WIDE_INTEGER_CONSTEXPR auto operator++()  -> uintwide_t& { preincrement(); return *this; }
-    WIDE_INTEGER_CONSTEXPR auto operator--()  -> uintwide_t& { predecrement(); return *this; }
-
-    // Operators post-increment and post-decrement.
-    WIDE_INTEGER_CONSTEXPR auto operator++(int) -> uintwide_t { const uintwide_t w(*this); preincrement(); return w; }
-    WIDE_INTEGER_CONSTEXPR auto operator--(int) -> uintwide_t { const uintwide_t w(*this); predecrement(); return w; }
-
-    WIDE_INTEGER_CONSTEXPR auto operator~() -> uintwide_t&
+    // Return the remainder of the count limbs (least significant limb
+    // first) at u divided by the divisor. The limbs are left unchanged.
+    // The remainder of division by zero is zero.
+    template<typename InputIterator>
+    WIDE_INTEGER_CONSTEXPR auto remainder(InputIterator u, const unsinged_fast_type count) const -> limb_type
     {
-      // Bitwise NOT.
-      bitwise_not();
+      constexpr auto limb_digits = static_cast<unsigned>(std::numeric_limits<limb_type>::digits);
 
-      return *this;
-    }
+      const auto left_shift  = static_cast<unsigned>(my_shift);
+      const auto right_shift = static_cast<unsigned>(limb_digits - left_shift);
 
-    WIDE_INTEGER_CONSTEXPR auto operator|=(const uintwide_t& other) -> uintwide_t&
-    {
-      if(this != &other)
+      auto rem = limb_type(0U);
+
+      if((count != 0U) && (my_divisor != limb_type(0U)))
       {
-        // Bitwise OR.
-        for(unsinged_fast_type i = 0U; i < number_of_limbs; ++i)
+        if(left_shift != 0U)
         {
-          *(values.begin() + size_t(i)) = limb_type(*(values.cbegin() + size_t(i)) | *(other.values.cbegin() + size_t(i)));
+          rem = static_cast<limb_type>(*(u + size_t(count - 1U)) >> right_shift);
         }
-      }
-
-      return *this;
-    }
 
-    WIDE_INTEGER_CONSTEXPR auto operator^=(const uintwide_t& other) -> uintwide_t&
-    {
-      if(this == &other)
-      {
-        values.fill(0U);
-      }
-      else
-      {
-        // Bitwise XOR.
-        for(unsinged_fast_type i = 0U; i < number_of_limbs; ++i)
+        for(auto i = count; i != 0U; --i)
         {
-          *(values.begin() + size_t(i)) = limb_type(*(values.cbegin() + size_t(i)) ^ *(other.values.cbegin() + size_t(i)));
-        }
-      }
+          auto u_lo = static_cast<limb_type>(*(u + size_t(i - 1U)) << left_shift);
 
-      return *this;
-    }
+          if((left_shift != 0U) && (i > 1U))
+          {
+            u_lo = static_cast<limb_type>(u_lo | static_cast<limb_type>(*(u + size_t(i - 2U)) >> right_shift));
+          }
 
-    WIDE_INTEGER_CONSTEXPR auto operator&=(const uintwide_t& other) -> uintwide_t&
-    {
-      if(this != &other)
-      {
-        // Bitwise AND.
-        for(unsinged_fast_type i = 0U; i < number_of_limbs; ++i)
-        {
-          *(values.begin() + size_t(i)) = limb_type(*(values.cbegin() + size_t(i)) & *(other.values.cbegin() + size_t(i)));
+          static_cast<void>(divide_2_by_1(rem, u_lo, rem));
         }
       }
 
-      return *this;
+      return static_cast<limb_type>(rem >> left_shift);
     }
 
-    template<typename SignedIntegralType>
-    WIDE_INTEGER_CONSTEXPR auto operator<<=(const SignedIntegralType n) -> typename std::enable_if<(   (std::is_integral   <SignedIntegralType>::value) // NOLINT(misc-no-recursion)
-                                                                                                    && (std::is_signed     <SignedIntegralType>::value)), uintwide_t>::type&
+  private:
+    limb_type          my_divisor;
+    unsinged_fast_type my_shift;
+    limb_type          my_normalized;
+    limb_type          my_reciprocal;
+
+    static WIDE_INTEGER_CONSTEXPR auto reciprocal_of_normalized(const limb_type dn) -> limb_type
     {
-      // Left-shift operator.
-      if(n < 0)
-      {
-        operator>>=(-n); // NOLINT(misc-no-recursion)
-      }
-      else if(n == 0)
-      {
-        ;
-      }
-      else if(unsinged_fast_type(n) >= my_width2)
-      {
-        std::fill(values.begin(), values.end(), limb_type(0U));
-      }
-      else
-      {
-        const auto offset            = unsinged_fast_type(unsinged_fast_type(n) / unsinged_fast_type(std::numeric_limits<limb_type>::digits));
-        const auto left_shift_amount = std::uint_fast16_t(unsinged_fast_type(n) % unsinged_fast_type(std::numeric_limits<limb_type>::digits));
+      // Compute v = floor((b^2 - 1) / dn) - b, with b = 2^limb_digits.
+      // This fits in one limb for normalized dn.
+      return
+        (dn == limb_type(0U))
+          ? limb_type(0U)
+          : detail::make_lo<limb_type>
+            (
+              static_cast<double_limb_type>
+              (
+                  detail::make_large<limb_type>(static_cast<limb_type>((std::numeric_limits<limb_type>::max)()),
+                                                static_cast<limb_type>(~dn))
+                / dn
+              )
+            );
+    }
+  };
 
-        shl(offset, left_shift_amount);
-      }
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  class uintwide_t // NOLINT(cppcoreguidelines-special-member-functions,hicpp-special-member-functions)
+  {
+  public:
+    template<const size_t OtherWidth2,
+             typename OtherLimbType,
+             typename OtherAllocatorType,
+             const bool OtherIsSigned>
+    friend class uintwide_t;
 
-      return *this;
-    }
+    template<const size_t OtherWidth2,
+             typename OtherLimbType>
+    friend class uintwide_view;
+
+    // Class-local type definitions.
+    using limb_type = LimbType;
+
+    using double_limb_type =
+      typename detail::uint_type_helper<size_t(std::numeric_limits<limb_type>::digits * 2)>::exact_unsigned_type;
+
+    // Legacy ularge and ushort types. These are no longer used
+    // in the class, but provided for legacy compatibility.
+    using ushort_type = limb_type;
+    using ularge_type = double_limb_type;
+
+    // More compile-time checks.
+    #if defined(WIDE_INTEGER_HAS_LIMB_TYPE_UINT64)
+    static_assert(((sizeof(limb_type) * 2U) == sizeof(double_limb_type)),
+                   "Error: Please check the characteristics of the template parameters UnsignedShortType and UnsignedLargeType");
+    #else
+    static_assert((    ( std::numeric_limits<limb_type>::is_integer)
+                   &&  ( std::numeric_limits<double_limb_type>::is_integer)
+                   &&  (!std::numeric_limits<limb_type>::is_signed)
+                   &&  (!std::numeric_limits<double_limb_type>::is_signed)
+                   &&  ((sizeof(limb_type) * 2U)                          == sizeof(double_limb_type))),
+                   "Error: Please check the characteristics of the template parameters UnsignedShortType and UnsignedLargeType");
+    #endif
+
+    // Helper constants for the digit characteristics.
+    static constexpr size_t my_width2 = Width2;
+
+    // The number of limbs.
+    static constexpr size_t number_of_limbs =
+      size_t(my_width2 / size_t(std::numeric_limits<limb_type>::digits));
+
+    using multiplication_thresholds_type = multiplication_thresholds<LimbType, AllocatorType>;
+
+    static constexpr size_t number_of_limbs_karatsuba_threshold = multiplication_thresholds_type::karatsuba_threshold;
+    static constexpr size_t number_of_limbs_toom3_threshold     = multiplication_thresholds_type::toom3_threshold;
+    static constexpr size_t number_of_limbs_ntt_threshold       = multiplication_thresholds_type::ntt_threshold;
+    static constexpr size_t number_of_limbs_karatsuba_base      = multiplication_thresholds_type::karatsuba_base;
+
+    static_assert(   (number_of_limbs_karatsuba_threshold <= number_of_limbs_toom3_threshold)
+                  && (number_of_limbs_toom3_threshold     <= number_of_limbs_ntt_threshold)
+                  && (number_of_limbs_toom3_threshold     >= size_t(5U))
+                  && (number_of_limbs_karatsuba_base      >= size_t(1U)),
+                  "Error: The multiplication thresholds must be ordered and the base case must be at least one limb");
+
+    // Verify that the Width2 template parameter (mirrored with my_width2):
+    //   * Is equal to 2^n times 1...63.
+    //   * And that there are at least 16, 24 or 32 binary digits, or more.
+    //   * And that the number of binary digits is an exact multiple of the number of limbs.
+    static_assert(   (detail::verify_power_of_two_times_granularity_one_sixty_fourth<my_width2>::conditional_value)
+                  && (my_width2 >= 16U)
+                  && (my_width2 == (number_of_limbs * size_t(std::numeric_limits<limb_type>::digits))),
+                  "Error: Width2 must be 2^n times 1...63 (with n >= 3), while being 16, 24, 32 or larger, and exactly divisible by limb count");
+
+    // The type of the internal data representation.
+    using representation_type =
+      typename std::conditional
+        <std::is_same<AllocatorType, void>::value,
+         detail::fixed_static_array <limb_type,
+                                     number_of_limbs>,
+         detail::fixed_dynamic_array<limb_type,
+                                     number_of_limbs,
+                                     typename std::allocator_traits<typename std::conditional<std::is_same<AllocatorType, void>::value,
+                                                                                              std::allocator<void>,
+                                                                                              AllocatorType>::type>::template rebind_alloc<limb_type>>
+        >::type;
+
+    // The iterator types of the internal data representation.
+    using iterator               = typename representation_type::iterator;
+    using const_iterator         = typename representation_type::const_iterator;
+    using reverse_iterator       = typename representation_type::reverse_iterator;
+    using const_reverse_iterator = typename representation_type::const_reverse_iterator;
+
+    // Define a class-local type that has double the width of *this.
+    using double_width_type = uintwide_t<size_t(Width2 * 2U), limb_type, AllocatorType, IsSigned>;
+
+    // Default constructor.
+    constexpr uintwide_t() = default;
+
+    // Constructors from built-in unsigned integral types that
+    // are less wide than limb_type or exactly as wide as limb_type.
+    template<typename UnsignedIntegralType>
+    constexpr uintwide_t(const UnsignedIntegralType v, // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+                         typename std::enable_if<(   (std::is_integral   <UnsignedIntegralType>::value)
+                                                  && (std::is_unsigned   <UnsignedIntegralType>::value)
+                                                  && (std::numeric_limits<UnsignedIntegralType>::digits <= std::numeric_limits<limb_type>::digits))>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
+      : values(1U, v) { }
 
+    // Constructors from built-in unsigned integral types that
+    // are wider than limb_type, and do not have exactly the
+    // same width as limb_type.
     template<typename UnsignedIntegralType>
-    WIDE_INTEGER_CONSTEXPR auto operator<<=(const UnsignedIntegralType n) -> typename std::enable_if<(   ( std::is_integral   <UnsignedIntegralType>::value)
-                                                                                                      && (!std::is_signed     <UnsignedIntegralType>::value)), uintwide_t>::type&
+    WIDE_INTEGER_CONSTEXPR uintwide_t(const UnsignedIntegralType v, // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+                                      typename std::enable_if<(   (std::is_integral   <UnsignedIntegralType>::value)
+                                                               && (std::is_unsigned   <UnsignedIntegralType>::value)
+                                                               && (std::numeric_limits<UnsignedIntegralType>::digits > std::numeric_limits<limb_type>::digits))>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
     {
-      // Left-shift operator.
-      if(n == 0)
-      {
-        ;
-      }
-      else if(unsinged_fast_type(n) >= my_width2)
-      {
-        std::fill(values.begin(), values.end(), limb_type(0U));
-      }
-      else
+      unsinged_fast_type right_shift_amount_v = 0U;
+      std::uint_fast8_t  index_u              = 0U;
+
+      for( ; (   (index_u < values.size())
+              && (right_shift_amount_v < unsinged_fast_type(std::numeric_limits<UnsignedIntegralType>::digits)));
+             ++index_u)
       {
-        const auto offset            = unsinged_fast_type(unsinged_fast_type(n) / unsinged_fast_type(std::numeric_limits<limb_type>::digits));
-        const auto left_shift_amount = std::uint_fast16_t(unsinged_fast_type(n) % unsinged_fast_type(std::numeric_limits<limb_type>::digits));
+        *(values.begin() + size_t(index_u)) = limb_type(v >> unsigned(right_shift_amount_v));
 
-        shl(offset, left_shift_amount);
+        right_shift_amount_v += unsinged_fast_type(std::numeric_limits<limb_type>::digits);
       }
 
-      return *this;
+      std::fill(values.begin() + index_u, values.end(), limb_type(0U));
     }
 
+    // Constructors from built-in signed integral types.
     template<typename SignedIntegralType>
-    WIDE_INTEGER_CONSTEXPR auto operator>>=(const SignedIntegralType n) -> typename std::enable_if<(   (std::is_integral   <SignedIntegralType>::value) // NOLINT(misc-no-recursion)
-                                                                                                    && (std::is_signed     <SignedIntegralType>::value)), uintwide_t>::type&
+    WIDE_INTEGER_CONSTEXPR uintwide_t(const SignedIntegralType v, // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+                                      typename std::enable_if<(   (std::is_integral   <SignedIntegralType>::value)
+                                                               && (std::is_signed     <SignedIntegralType>::value))>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
     {
-      // Right-shift operator.
-      if(n < 0)
-      {
-        operator<<=(-n);
-      }
-      else if(n == 0)
+      using local_signed_integral_type   = SignedIntegralType;
+      using local_unsigned_integral_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_signed_integral_type>::digits + 1)>::exact_unsigned_type;
+
+      const bool v_is_neg = (v < local_signed_integral_type(0));
+
+      const local_unsigned_integral_type u =
+        ((!v_is_neg) ? local_unsigned_integral_type(v) : local_unsigned_integral_type(detail::negate(v)));
+
+      operator=(uintwide_t(u));
+
+      if(v_is_neg) { negate(); }
+    }
+
+    #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+    template<typename FloatingPointType,
+             typename std::enable_if<(std::is_floating_point<FloatingPointType>::value)>::type const* = nullptr>
+    WIDE_INTEGER_CONSTEXPR uintwide_t(const FloatingPointType f) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    {
+      using local_builtin_float_type = FloatingPointType;
+
+      using detail::my_own::isfinite;
+
+      if(isfinite(f) == false)
       {
-        ;
+        operator=(0U);
       }
-      else if(unsinged_fast_type(n) >= my_width2)
+      else
       {
-        // Fill with either 0's or 1's. Note also the implementation-defined
-        // behavior of excessive right-shift of negative value.
-        if(is_neg(*this) == false)
+        const bool f_is_neg = (f < local_builtin_float_type(0.0F));
+
+        const local_builtin_float_type a = ((!f_is_neg) ? f : -f);
+
+        const bool a_is_zero = (a < local_builtin_float_type(1.0F));
+
+        if(!a_is_zero)
         {
-          std::fill(values.begin(), values.end(), limb_type(0U));
+          const detail::native_float_parts<local_builtin_float_type> ld_parts(a);
+
+          // Create a decwide_t from the fractional part of the
+          // mantissa expressed as an unsigned long long.
+          *this = uintwide_t(ld_parts.get_mantissa());
+
+          // Scale the unsigned long long representation to the fractional
+          // part of the long double and multiply with the base-2 exponent.
+          const int p2 = ld_parts.get_exponent() - (std::numeric_limits<FloatingPointType>::digits - 1);
+
+          if     (p2 <   0) { *this >>= static_cast<unsigned>(-p2); }
+          else if(p2 ==  0) { ; }
+          else              { *this <<= static_cast<unsigned>( p2); }
+
+          if(f_is_neg)
+          {
+            negate();
+          }
         }
         else
         {
-          std::fill(values.begin(), values.end(), (std::numeric_limits<limb_type>::max)());
+          operator=(0U);
         }
       }
-      else
-      {
-        const auto offset             = unsinged_fast_type(unsinged_fast_type(n) / unsinged_fast_type(std::numeric_limits<limb_type>::digits));
-        const auto right_shift_amount = std::uint_fast16_t(unsinged_fast_type(n) % unsinged_fast_type(std::numeric_limits<limb_type>::digits));
+    }
+    #endif
 
-        shr(offset, right_shift_amount);
-      }
+    // Copy constructor.
+    constexpr uintwide_t(const uintwide_t& other) = default;
 
-      return *this;
-    }
+    // Copy-like constructor from the other signed-ness type.
+    template<const bool OtherIsSigned,
+             typename std::enable_if<(OtherIsSigned != IsSigned)>::type const* = nullptr>
+    constexpr uintwide_t(const uintwide_t<Width2, LimbType, AllocatorType, OtherIsSigned>& other) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : values(other.values) { }
 
-    template<typename UnsignedIntegralType>
-    WIDE_INTEGER_CONSTEXPR auto operator>>=(const UnsignedIntegralType n) -> typename std::enable_if<(   ( std::is_integral   <UnsignedIntegralType>::value)
-                                                                                                      && (!std::is_signed     <UnsignedIntegralType>::value)), uintwide_t>::type&
+    // Constructor from the another type having a different width but the same limb type.
+    // This constructor is explicit because it is a non-trivial conversion.
+
+    // TBD: The keyword "explicit" is missing and the code at the moment does not agree with the comment.
+    // TBD: Figure out if the keyword "explicit" is needed/wanted or not and correct code/comment to agree
+    // with each other.
+    template<const size_t OtherWidth2>
+    WIDE_INTEGER_CONSTEXPR uintwide_t(const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
     {
-      // Right-shift operator.
-      if(n == 0)
-      {
-        ;
-      }
-      else if(unsinged_fast_type(n) >= my_width2)
+      using other_wide_integer_type = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>;
+
+      const bool v_is_neg = (other_wide_integer_type::is_neg(v));
+
+      const size_t sz =
+        (std::min)(size_t(v.crepresentation().size()),
+                   size_t(number_of_limbs));
+
+      if(!v_is_neg)
       {
-        std::fill(values.begin(), values.end(), limb_type(0U));
+        std::copy(v.crepresentation().cbegin(),
+                  v.crepresentation().cbegin() + sz,
+                  values.begin());
+
+        std::fill(values.begin() + sz, values.end(), limb_type(0U));
       }
       else
       {
-        const auto offset             = unsinged_fast_type(unsinged_fast_type(n) / unsinged_fast_type(std::numeric_limits<limb_type>::digits));
-        const auto right_shift_amount = std::uint_fast16_t(unsinged_fast_type(n) % unsinged_fast_type(std::numeric_limits<limb_type>::digits));
-
-        shr(offset, right_shift_amount);
-      }
+        const other_wide_integer_type uv(-v);
 
-      return *this;
-    }
+        std::copy(uv.crepresentation().cbegin(),
+                  uv.crepresentation().cbegin() + sz,
+                  values.begin());
 
-    // Implement comparison operators.
-    constexpr auto operator==(const uintwide_t& other) const -> bool { return (compare(other) == std::int_fast8_t( 0)); }
-    constexpr auto operator< (const uintwide_t& other) const -> bool { return (compare(other) == std::int_fast8_t(-1)); }
-    constexpr auto operator> (const uintwide_t& other) const -> bool { return (compare(other) == std::int_fast8_t( 1)); }
-    constexpr auto operator!=(const uintwide_t& other) const -> bool { return (compare(other) != std::int_fast8_t( 0)); }
-    constexpr auto operator<=(const uintwide_t& other) const -> bool { return (compare(other) <= std::int_fast8_t( 0)); }
-    constexpr auto operator>=(const uintwide_t& other) const -> bool { return (compare(other) >= std::int_fast8_t( 0)); }
+        std::fill(values.begin() + sz, values.end(), limb_type(0U));
 
-    // Helper functions for supporting std::numeric_limits<>.
-    static constexpr auto limits_helper_max(bool is_signed) -> uintwide_t
-    {
-      return
-      (!is_signed)
-        ? from_rep
-          (
-            representation_type
-            (
-              number_of_limbs, (std::numeric_limits<limb_type>::max)()
-            )
-          )
-        : from_rep
-          (
-            representation_type
-            (
-              number_of_limbs, (std::numeric_limits<limb_type>::max)()
-            )
-          ) ^ (uintwide_t(1U) << (my_width2 - 1))
-        ;
+        negate();
+      }
     }
 
-    static constexpr auto limits_helper_min(bool is_signed) -> uintwide_t
+    // Constructor from a constant character string.
+    WIDE_INTEGER_CONSTEXPR uintwide_t(const char* str_input) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
     {
-      return
-      (!is_signed)
-        ? from_rep
-          (
-            representation_type
-            (
-              number_of_limbs, limb_type(0U)
-            )
-          )
-        : from_rep
-          (
-            representation_type
-            (
-              number_of_limbs, limb_type(0U)
-            )
-          ) | (uintwide_t(1U) << (my_width2 - 1))
-        ;
+      if(rd_string(str_input) == false)
+      {
+        std::fill(values.begin(), values.end(), (std::numeric_limits<limb_type>::max)());
+      }
     }
 
-    static constexpr auto limits_helper_min() -> uintwide_t
-    {
-      return uintwide_t(representation_type(number_of_limbs, limb_type(0U)));
-    }
+    // Move constructor.
+    constexpr uintwide_t(uintwide_t&& other) noexcept = default;
 
-    static constexpr auto limits_helper_lowest(bool is_signed) -> uintwide_t
-    {
-      return
-      (!is_signed)
-        ? from_rep
-          (
-            representation_type
-            (
-              number_of_limbs, limb_type(0U)
-            )
-          )
-        : from_rep
-          (
-            representation_type
-            (
-              number_of_limbs, limb_type(0U)
-            )
-          ) | (uintwide_t(1U) << (my_width2 - 1))
-        ;
-    }
+    // Move-like constructor from the other signed-ness type.
+    template<const bool OtherIsSigned,
+             typename std::enable_if<(OtherIsSigned != IsSigned)>::type const* = nullptr>
+    constexpr uintwide_t(uintwide_t<Width2, LimbType, AllocatorType, OtherIsSigned>&& other) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : values(static_cast<representation_type&&>(other.values)) { }
 
-    // Define the maximum buffer sizes for extracting
-    // octal, decimal and hexadecimal string representations.
-    static constexpr size_t wr_string_max_buffer_size_oct = (16U + (my_width2 / 3U)) + size_t(((my_width2 % 3U) != 0U) ? 1U : 0U) + 1U;
-    static constexpr size_t wr_string_max_buffer_size_hex = (32U + (my_width2 / 4U)) + 1U;
-    static constexpr size_t wr_string_max_buffer_size_dec = (20U + size_t((std::uintmax_t(my_width2) * UINTMAX_C(301)) / UINTMAX_C(1000))) + 1U;
+    // Assignment operator.
+    WIDE_INTEGER_CONSTEXPR auto operator=(const uintwide_t& other) -> uintwide_t& = default;
 
-    // Write string function.
-    WIDE_INTEGER_CONSTEXPR auto wr_string(      char*              str_result, // NOLINT(readability-function-cognitive-complexity)
-                                          const std::uint_fast8_t  base_rep     = 0x10U,
-                                          const bool               show_base    = true,
-                                          const bool               show_pos     = false,
-                                          const bool               is_uppercase = true,
-                                                unsinged_fast_type field_width  = 0U,
-                                          const char               fill_char    = char('0')) const -> bool
+    // Assignment operator from the other signed-ness type.
+    template<const bool OtherIsSigned,
+             typename std::enable_if<(OtherIsSigned != IsSigned)>::type const* = nullptr>
+    WIDE_INTEGER_CONSTEXPR auto operator=(const uintwide_t<Width2, LimbType, AllocatorType, OtherIsSigned>& other) -> uintwide_t&
     {
-      bool wr_string_is_ok = true;
-
-      if(base_rep == UINT8_C(8))
-      {
-        uintwide_t t(*this);
-
-        const auto mask = static_cast<limb_type>(std::uint8_t(0x7U));
-
-        std::array<char, std::size_t(wr_string_max_buffer_size_oct)> str_temp { };
-
-        unsinged_fast_type pos = (sizeof(str_temp) - 1U);
-
-        if(t.is_zero())
-        {
-          --pos;
-
-          str_temp[static_cast<std::size_t>(pos)] = char('0'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-        }
-        else
-        {
-          if(is_neg(t) == false)
-          {
-            while(!t.is_zero())
-            {
-              char c = char(*t.values.cbegin() & mask);
-
-              if(c <= char(INT8_C(8))) { c = char(c + char(INT8_C(0x30))); }
+      values = other.values;
 
-              --pos;
+      return *this;
+    }
 
-              str_temp[static_cast<std::size_t>(pos)] = c; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    // Trivial move assignment operator.
+    WIDE_INTEGER_CONSTEXPR auto operator=(uintwide_t&& other) noexcept -> uintwide_t& = default;
 
-              t >>= 3;
-            }
-          }
-          else
-          {
-            uintwide_t<my_width2, limb_type, AllocatorType, false> tu(t);
+    // Trivial move assignment operator from the other signed-ness type.
+    template<const bool OtherIsSigned,
+             typename std::enable_if<(OtherIsSigned != IsSigned)>::type const* = nullptr>
+    WIDE_INTEGER_CONSTEXPR auto operator=(uintwide_t<Width2, LimbType, AllocatorType, OtherIsSigned>&& other) -> uintwide_t&
+    {
+      values = static_cast<representation_type&&>(other.values);
 
-            while(!tu.is_zero())
-            {
-              char c = char(*tu.values.cbegin() & mask);
+      return *this;
+    }
 
-              if(c <= char(INT8_C(8))) { c = char(c + char(INT8_C(0x30))); }
+    #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+    explicit constexpr operator long double() const { return extract_builtin_floating_point_type<long double>(); }
+    explicit constexpr operator double     () const { return extract_builtin_floating_point_type<double>     (); }
+    explicit constexpr operator float      () const { return extract_builtin_floating_point_type<float>      (); }
+    #endif
 
-              --pos;
+    template<typename Integer, typename = typename std::enable_if<std::is_integral<Integer>::value>::type>
+    explicit constexpr operator Integer() const { return ((is_neg(*this) == false) ? extract_builtin_integral_type<Integer>() : detail::negate(uintwide_t(-*this).extract_builtin_integral_type<Integer>())); }
 
-              str_temp[static_cast<std::size_t>(pos)] = c; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    explicit constexpr operator bool() const { return !is_zero(); }
 
-              tu >>= 3;
-            }
-          }
-        }
+    // Implement the cast operator that casts to the double-width type.
+    template<typename UnknownUnsignedWideIntegralType,
+             typename = typename std::enable_if<(std::is_same<UnknownUnsignedWideIntegralType, double_width_type>::value)>::type>
+    WIDE_INTEGER_CONSTEXPR operator double_width_type() const // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+    {
+      double_width_type local_double_width_instance;
 
-        if(show_base)
-        {
-          --pos;
+      std::copy(values.cbegin(),
+                values.cend(),
+                local_double_width_instance.representation().begin());
 
-          str_temp[static_cast<std::size_t>(pos)] = char('0'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-        }
+      std::fill(local_double_width_instance.representation().begin() + number_of_limbs,
+                local_double_width_instance.representation().end(),
+                limb_type(0U));
 
-        if(show_pos)
-        {
-          --pos;
+      return local_double_width_instance;
+    }
 
-          str_temp[static_cast<std::size_t>(pos)] = char('+'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-        }
+    // Implement a cast operator that casts to a uintwide_t having the other signed-ness type.
+    template<const bool OtherIsSigned,
+             typename std::enable_if<(OtherIsSigned != IsSigned)>::type const* = nullptr>
+    explicit WIDE_INTEGER_CONSTEXPR operator uintwide_t<Width2, LimbType, AllocatorType, OtherIsSigned>() const
+    {
+      return uintwide_t<Width2, LimbType, AllocatorType, OtherIsSigned>(values);
+    }
 
-        if(field_width != 0U)
-        {
-          field_width = (std::min)(field_width, unsinged_fast_type(sizeof(str_temp) - 1U));
+    // Provide a user interface to the internal data representation.
+    WIDE_INTEGER_CONSTEXPR auto  representation()       ->       representation_type& { return values; }
+    WIDE_INTEGER_CONSTEXPR auto  representation() const -> const representation_type& { return values; }
+    WIDE_INTEGER_CONSTEXPR auto crepresentation() const -> const representation_type& { return values; }
 
-          while(singed_fast_type(pos) > singed_fast_type((sizeof(str_temp) - 1U) - field_width))
-          {
-            --pos;
+    // Unary operators: not, plus and minus.
+    WIDE_INTEGER_CONSTEXPR auto operator+() const -> const uintwide_t& { return *this; }
+    WIDE_INTEGER_CONSTEXPR auto operator-() const ->       uintwide_t  { uintwide_t tmp(*this); tmp.negate(); return tmp; }
 
-            str_temp[static_cast<std::size_t>(pos)] = fill_char; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-          }
-        }
+    WIDE_INTEGER_CONSTEXPR auto operator+=(const uintwide_t& other) -> uintwide_t&
+    {
+      if(this == &other)
+      {
+        const uintwide_t self(other);
 
-        str_temp[(sizeof(str_temp) - 1U)] = char('\0');
+        // Unary addition function.
+        const limb_type carry = eval_add_n(values.data(),
+                                           values.data(),
+                                           self.values.data(),
+                                           unsinged_fast_type(number_of_limbs),
+                                           limb_type(0U));
 
-        detail::strcpy_unsafe(str_result, str_temp.data() + pos);
+        static_cast<void>(carry);
       }
-      else if(base_rep == UINT8_C(10))
+      else
       {
-        uintwide_t t(*this);
-
-        const bool str_has_neg_sign = is_neg(t);
-
-        if(str_has_neg_sign)
-        {
-          t.negate();
-        }
+        // Unary addition function.
+        const limb_type carry = eval_add_n(values.data(),
+                                           values.data(),
+                                           other.values.data(),
+                                           unsinged_fast_type(number_of_limbs),
+                                           limb_type(0U));
 
-        std::array<char, std::size_t(wr_string_max_buffer_size_dec)> str_temp { };
+        static_cast<void>(carry);
+      }
 
-        unsinged_fast_type pos = (sizeof(str_temp) - 1U);
+      return *this;
+    }
 
-        if(t.is_zero())
-        {
-          --pos;
-
-          str_temp[static_cast<std::size_t>(pos)] = char('0'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-        }
-        else
-        {
-          while(!t.is_zero())
-          {
-            const uintwide_t tmp(t);
-
-            t.eval_divide_by_single_limb(limb_type(UINT8_C(10)), 0U, nullptr);
-
-            --pos;
-
-            str_temp[static_cast<std::size_t>(pos)] = // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-              static_cast<char>(static_cast<limb_type>(tmp - (uintwide_t(t).mul_by_limb(limb_type(UINT8_C(10))))) + UINT8_C(0x30));
-          }
-        }
-
-        if(show_pos && (!str_has_neg_sign))
-        {
-          --pos;
-
-          str_temp[static_cast<std::size_t>(pos)] = char('+'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-        }
-        else if(str_has_neg_sign)
-        {
-          --pos;
-
-          str_temp[static_cast<std::size_t>(pos)] = char('-'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-        }
-
-        if(field_width != 0U)
-        {
-          field_width = (std::min)(field_width, unsinged_fast_type(sizeof(str_temp) - 1U));
-
-          while(singed_fast_type(pos) > singed_fast_type((sizeof(str_temp) - 1U) - field_width))
-          {
-            --pos;
+    WIDE_INTEGER_CONSTEXPR auto operator-=(const uintwide_t& other) -> uintwide_t&
+    {
+      if(this == &other)
+      {
+        values.fill(0U);
+      }
+      else
+      {
+        // Unary subtraction function.
+        const limb_type has_borrow = eval_subtract_n(values.data(),
+                                                     values.data(),
+                                                     other.values.data(),
+                                                     number_of_limbs,
+                                                     false);
 
-            str_temp[static_cast<std::size_t>(pos)] = fill_char; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-          }
-        }
+        static_cast<void>(has_borrow);
+      }
 
-        str_temp[static_cast<std::size_t>(sizeof(str_temp) - 1U)] = char('\0');
+      return *this;
+    }
 
-        detail::strcpy_unsafe(str_result, str_temp.data() + pos);
+    WIDE_INTEGER_CONSTEXPR auto operator*=(const uintwide_t& other) -> uintwide_t&
+    {
+      if(this == &other)
+      {
+        eval_sqr_unary(*this);
       }
-      else if(base_rep == UINT8_C(16))
+      else
       {
-        uintwide_t t(*this);
+        eval_mul_unary(*this, other);
+      }
 
-        const auto mask = static_cast<limb_type>(std::uint8_t(0xFU));
+      return *this;
+    }
 
-        std::array<char, std::size_t(wr_string_max_buffer_size_hex)> str_temp { };
+    WIDE_INTEGER_CONSTEXPR auto mul_by_limb(const limb_type v) -> uintwide_t&
+    {
+      if(v == limb_type(0U))
+      {
+        values.fill(0U);
+      }
+      else if(v > limb_type(1U))
+      {
+        static_cast<void>(eval_multiply_1d(values.data(),
+                                           values.data(),
+                                           v,
+                                           number_of_limbs));
+      }
 
-        unsinged_fast_type pos = (sizeof(str_temp) - 1U);
+      return *this;
+    }
 
-        if(t.is_zero())
-        {
-          --pos;
+    WIDE_INTEGER_CONSTEXPR auto operator/=(const uintwide_t& other) -> uintwide_t&
+    {
+      if(this == &other)
+      {
+        values.front() = 1U;
 
-          str_temp[static_cast<std::size_t>(pos)] = char('0'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-        }
-        else
-        {
-          if(!is_neg(t))
-          {
-            while(!t.is_zero())
-            {
-              char c(*t.values.cbegin() & mask);
+        std::fill(values.begin() + 1U, values.end(), limb_type(0U));
+      }
+      else
+      {
+        // Unary division function.
+        eval_divmod(other, nullptr);
+      }
 
-              if      (c <= char(INT8_C(  9)))                              { c = char(c + char(INT8_C(0x30))); }
-              else if((c >= char(INT8_C(0xA))) && (c <= char(INT8_C(0xF)))) { c = char(c + (is_uppercase ? char(INT8_C(55)) : char(INT8_C(87)))); }
+      return *this;
+    }
 
-              --pos;
+    WIDE_INTEGER_CONSTEXPR auto operator%=(const uintwide_t& other) -> uintwide_t&
+    {
+      if(this == &other)
+      {
+        std::fill(values.begin(), values.end(), limb_type(0U));
+      }
+      else
+      {
+        // Unary modulus function.
+        uintwide_t remainder;
 
-              str_temp[static_cast<std::size_t>(pos)] = c; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        eval_divmod(other, &remainder);
 
-              t >>= 4;
-            }
-          }
-          else
-          {
-            uintwide_t<my_width2, limb_type, AllocatorType, false> tu(t);
+        values = remainder.values;
+      }
 
-            while(!tu.is_zero())
-            {
-              char c(*tu.values.cbegin() & mask);
+      return *this;
+    }
 
-              if      (c <= char(INT8_C(  9)))                              { c = char(c + char(INT8_C(0x30))); }
-              else if((c >= char(INT8_C(0xA))) && (c <= char(INT8_C(0xF)))) { c = char(c + (is_uppercase ? char(INT8_C(55)) : char(INT8_C(87)))); }
+    // Operators pre-increment and pre-decrement.
+    WIDE_INTEGER_CONSTEXPR auto operator++()  -> uintwide_t& { preincrement(); return *this; }
+    WIDE_INTEGER_CONSTEXPR auto operator--()  -> uintwide_t& { predecrement(); return *this; }
 
-              --pos;
+    // Operators post-increment and post-decrement.
+    WIDE_INTEGER_CONSTEXPR auto operator++(int) -> uintwide_t { const uintwide_t w(*this); preincrement(); return w; }
+    WIDE_INTEGER_CONSTEXPR auto operator--(int) -> uintwide_t { const uintwide_t w(*this); predecrement(); return w; }
 
-              str_temp[static_cast<std::size_t>(pos)] = c; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    WIDE_INTEGER_CONSTEXPR auto operator~() -> uintwide_t&
+    {
+      // Bitwise NOT.
+      bitwise_not();
 
-              tu >>= 4;
-            }
-          }
-        }
+      return *this;
+    }
 
-        if(show_base)
+    WIDE_INTEGER_CONSTEXPR auto operator|=(const uintwide_t& other) -> uintwide_t&
+    {
+      if(this != &other)
+      {
+        // Bitwise OR.
+        for(unsinged_fast_type i = 0U; i < number_of_limbs; ++i)
         {
-          --pos;
-
-          str_temp[static_cast<std::size_t>(pos)] = (is_uppercase ? char('X') : char('x')); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-
-          --pos;
-
-          str_temp[static_cast<std::size_t>(pos)] = char('0'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+          *(values.begin() + size_t(i)) = limb_type(*(values.cbegin() + size_t(i)) | *(other.values.cbegin() + size_t(i)));
         }
+      }
 
-        if(show_pos)
-        {
-          --pos;
-
-          str_temp[static_cast<std::size_t>(pos)] = char('+'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-        }
+      return *this;
+    }
 
-        if(field_width != 0U)
+    WIDE_INTEGER_CONSTEXPR auto operator^=(const uintwide_t& other) -> uintwide_t&
+    {
+      if(this == &other)
+      {
+        values.fill(0U);
+      }
+      else
+      {
+        // Bitwise XOR.
+        for(unsinged_fast_type i = 0U; i < number_of_limbs; ++i)
         {
-          field_width = (std::min)(field_width, unsinged_fast_type(sizeof(str_temp) - 1U));
+          *(values.begin() + size_t(i)) = limb_type(*(values.cbegin() + size_t(i)) ^ *(other.values.cbegin() + size_t(i)));
+        }
+      }
 
-          while(singed_fast_type(pos) > singed_fast_type((sizeof(str_temp) - 1U) - field_width))
-          {
-            --pos;
+      return *this;
+    }
 
-            str_temp[static_cast<std::size_t>(pos)] = fill_char; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
-          }
+    WIDE_INTEGER_CONSTEXPR auto operator&=(const uintwide_t& other) -> uintwide_t&
+    {
+      if(this != &other)
+      {
+        // Bitwise AND.
+        for(unsinged_fast_type i = 0U; i < number_of_limbs; ++i)
+        {
+          *(values.begin() + size_t(i)) = limb_type(*(values.cbegin() + size_t(i)) & *(other.values.cbegin() + size_t(i)));
         }
+      }
 
-        str_temp[(sizeof(str_temp) - 1U)] = char('\0');
+      return *this;
+    }
 
-        detail::strcpy_unsafe(str_result, str_temp.data() + pos);
+    template<typename SignedIntegralType>
+    WIDE_INTEGER_CONSTEXPR auto operator<<=(const SignedIntegralType n) -> typename std::enable_if<(   (std::is_integral   <SignedIntegralType>::value) // NOLINT(misc-no-recursion)
+                                                                                                    && (std::is_signed     <SignedIntegralType>::value)), uintwide_t>::type&
+    {
+      // Left-shift operator.
+      if(n < 0)
+      {
+        operator>>=(-n); // NOLINT(misc-no-recursion)
+      }
+      else if(n == 0)
+      {
+        ;
+      }
+      else if(unsinged_fast_type(n) >= my_width2)
+      {
+        std::fill(values.begin(), values.end(), limb_type(0U));
       }
       else
       {
-        wr_string_is_ok = false;
+        const auto offset            = unsinged_fast_type(unsinged_fast_type(n) / unsinged_fast_type(std::numeric_limits<limb_type>::digits));
+        const auto left_shift_amount = std::uint_fast16_t(unsinged_fast_type(n) % unsinged_fast_type(std::numeric_limits<limb_type>::digits));
+
+        shl(offset, left_shift_amount);
       }
 
-      return wr_string_is_ok;
+      return *this;
     }
 
-    template<const bool RePhraseIsSigned = IsSigned,
-             typename std::enable_if<(!RePhraseIsSigned)>::type const* = nullptr>
-    WIDE_INTEGER_CONSTEXPR auto compare(const uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& other) const -> std::int_fast8_t
+    template<typename UnsignedIntegralType>
+    WIDE_INTEGER_CONSTEXPR auto operator<<=(const UnsignedIntegralType n) -> typename std::enable_if<(   ( std::is_integral   <UnsignedIntegralType>::value)
+                                                                                                      && (!std::is_signed     <UnsignedIntegralType>::value)), uintwide_t>::type&
     {
-      return compare_ranges(values.data(),
-                            other.values.data(),
-                            uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>::number_of_limbs);
-    }
+      // Left-shift operator.
+      if(n == 0)
+      {
+        ;
+      }
+      else if(unsinged_fast_type(n) >= my_width2)
+      {
+        std::fill(values.begin(), values.end(), limb_type(0U));
+      }
+      else
+      {
+        const auto offset            = unsinged_fast_type(unsinged_fast_type(n) / unsinged_fast_type(std::numeric_limits<limb_type>::digits));
+        const auto left_shift_amount = std::uint_fast16_t(unsinged_fast_type(n) % unsinged_fast_type(std::numeric_limits<limb_type>::digits));
 
-    template<const bool RePhraseIsSigned = IsSigned,
-             typename std::enable_if<(RePhraseIsSigned)>::type const* = nullptr>
-    WIDE_INTEGER_CONSTEXPR auto compare(const uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& other) const -> std::int_fast8_t
-    {
-      const bool other_is_neg = is_neg(other);
+        shl(offset, left_shift_amount);
+      }
 
-      return
-      is_neg(*this)
-        ? (other_is_neg ? compare_ranges(values.data(), other.values.data(), uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>::number_of_limbs)
-                        : INT8_C(-1))
-        : (other_is_neg ? INT8_C(1)
-                        : compare_ranges(values.data(), other.values.data(), uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>::number_of_limbs))
-      ;
+      return *this;
     }
 
-    WIDE_INTEGER_CONSTEXPR void negate()
+    template<typename SignedIntegralType>
+    WIDE_INTEGER_CONSTEXPR auto operator>>=(const SignedIntegralType n) -> typename std::enable_if<(   (std::is_integral   <SignedIntegralType>::value) // NOLINT(misc-no-recursion)
+                                                                                                    && (std::is_signed     <SignedIntegralType>::value)), uintwide_t>::type&
     {
-      bitwise_not();
+      // Right-shift operator.
+      if(n < 0)
+      {
+        operator<<=(-n);
+      }
+      else if(n == 0)
+      {
+        ;
+      }
+      else if(unsinged_fast_type(n) >= my_width2)
+      {
+        // Fill with either 0's or 1's. Note also the implementation-defined
+        // behavior of excessive right-shift of negative value.
+        if(is_neg(*this) == false)
+        {
+          std::fill(values.begin(), values.end(), limb_type(0U));
+        }
+        else
+        {
+          std::fill(values.begin(), values.end(), (std::numeric_limits<limb_type>::max)());
+        }
+      }
+      else
+      {
+        const auto offset             = unsinged_fast_type(unsinged_fast_type(n) / unsinged_fast_type(std::numeric_limits<limb_type>::digits));
+        const auto right_shift_amount = std::uint_fast16_t(unsinged_fast_type(n) % unsinged_fast_type(std::numeric_limits<limb_type>::digits));
 
-      preincrement();
+        shr(offset, right_shift_amount);
+      }
+
+      return *this;
     }
 
-    WIDE_INTEGER_CONSTEXPR void eval_divide_by_single_limb(const limb_type          short_denominator,
-                                                           const unsinged_fast_type u_offset,
-                                                                 uintwide_t*        remainder)
+    template<typename UnsignedIntegralType>
+    WIDE_INTEGER_CONSTEXPR auto operator>>=(const UnsignedIntegralType n) -> typename std::enable_if<(   ( std::is_integral   <UnsignedIntegralType>::value)
+                                                                                                      && (!std::is_signed     <UnsignedIntegralType>::value)), uintwide_t>::type&
     {
-      // The denominator has one single limb.
-      // Use a one-dimensional division algorithm.
-
-      auto long_numerator = double_limb_type(0U);
-
-      auto hi_part = limb_type(0U);
-
-      for(auto i = singed_fast_type(unsinged_fast_type(number_of_limbs - 1U) - u_offset); singed_fast_type(i) >= 0; --i)
+      // Right-shift operator.
+      if(n == 0)
       {
-        long_numerator =
-          double_limb_type
-          (
-             double_limb_type(*(values.cbegin() + size_t(i)))
-           + double_limb_type(double_limb_type(long_numerator - double_limb_type(double_limb_type(short_denominator) * hi_part)) << unsigned(std::numeric_limits<limb_type>::digits))
-          );
-
-        *(values.begin() + size_t(i)) =
-          detail::make_lo<limb_type>(double_limb_type(long_numerator / short_denominator));
-
-        hi_part = *(values.cbegin() + size_t(i));
+        ;
       }
-
-      if(remainder != nullptr)
+      else if(unsinged_fast_type(n) >= my_width2)
       {
-        long_numerator =
-          double_limb_type
-          (
-             double_limb_type(*values.cbegin())
-           + double_limb_type(double_limb_type(long_numerator - double_limb_type(double_limb_type(short_denominator) * hi_part)) << unsigned(std::numeric_limits<limb_type>::digits))
-          );
+        std::fill(values.begin(), values.end(), limb_type(0U));
+      }
+      else
+      {
+        const auto offset             = unsinged_fast_type(unsinged_fast_type(n) / unsinged_fast_type(std::numeric_limits<limb_type>::digits));
+        const auto right_shift_amount = std::uint_fast16_t(unsinged_fast_type(n) % unsinged_fast_type(std::numeric_limits<limb_type>::digits));
 
-        *remainder = limb_type(long_numerator >> unsigned(std::numeric_limits<limb_type>::digits));
+        shr(offset, right_shift_amount);
       }
+
+      return *this;
     }
 
-    WIDE_INTEGER_CONSTEXPR auto is_zero() const -> bool
-    {
-      auto it = values.cbegin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+    // Implement comparison operators.
+    constexpr auto operator==(const uintwide_t& other) const -> bool { return (compare(other) == std::int_fast8_t( 0)); }
+    constexpr auto operator< (const uintwide_t& other) const -> bool { return (compare(other) == std::int_fast8_t(-1)); }
+    constexpr auto operator> (const uintwide_t& other) const -> bool { return (compare(other) == std::int_fast8_t( 1)); }
+    constexpr auto operator!=(const uintwide_t& other) const -> bool { return (compare(other) != std::int_fast8_t( 0)); }
+    constexpr auto operator<=(const uintwide_t& other) const -> bool { return (compare(other) <= std::int_fast8_t( 0)); }
+    constexpr auto operator>=(const uintwide_t& other) const -> bool { return (compare(other) >= std::int_fast8_t( 0)); }
 
-      while((it != values.cend()) && (*it == limb_type(0U)))
-      {
-        ++it;
-      }
+    // Helper functions for supporting std::numeric_limits<>.
+    static constexpr auto limits_helper_max(bool is_signed) -> uintwide_t
+    {
+      return
+      (!is_signed)
+        ? from_rep
+          (
+            representation_type
+            (
+              number_of_limbs, (std::numeric_limits<limb_type>::max)()
+            )
+          )
+        : from_rep
+          (
+            representation_type
+            (
+              number_of_limbs, (std::numeric_limits<limb_type>::max)()
+            )
+          ) ^ (uintwide_t(1U) << (my_width2 - 1))
+        ;
+    }
 
-      return (it == values.cend());
+    static constexpr auto limits_helper_min(bool is_signed) -> uintwide_t
+    {
+      return
+      (!is_signed)
+        ? from_rep
+          (
+            representation_type
+            (
+              number_of_limbs, limb_type(0U)
+            )
+          )
+        : from_rep
+          (
+            representation_type
+            (
+              number_of_limbs, limb_type(0U)
+            )
+          ) | (uintwide_t(1U) << (my_width2 - 1))
+        ;
     }
 
-    template<const bool RePhraseIsSigned = IsSigned,
-             typename std::enable_if<(!RePhraseIsSigned)>::type const* = nullptr>
-    static constexpr auto is_neg(uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>) -> bool // NOLINT(hicpp-named-parameter,readability-named-parameter)
+    static constexpr auto limits_helper_min() -> uintwide_t
     {
-      return false;
+      return uintwide_t(representation_type(number_of_limbs, limb_type(0U)));
     }
 
-    template<const bool RePhraseIsSigned = IsSigned,
-             typename std::enable_if<(RePhraseIsSigned)>::type const* = nullptr>
-    static constexpr auto is_neg(uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned> a) -> bool
+    static constexpr auto limits_helper_lowest(bool is_signed) -> uintwide_t
     {
-      return (std::uint_fast8_t(std::uint_fast8_t(a.values.back() >> size_t(std::numeric_limits<typename uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>::limb_type>::digits - 1)) & 1U) != 0U);
+      return
+      (!is_signed)
+        ? from_rep
+          (
+            representation_type
+            (
+              number_of_limbs, limb_type(0U)
+            )
+          )
+        : from_rep
+          (
+            representation_type
+            (
+              number_of_limbs, limb_type(0U)
+            )
+          ) | (uintwide_t(1U) << (my_width2 - 1))
+        ;
     }
 
-  private:
-    representation_type values { };
+    // Define the maximum buffer sizes for extracting
+    // octal, decimal and hexadecimal string representations.
+    // The decimal size rounds up with log10(2) < 0.30103.
+    static constexpr size_t wr_string_max_buffer_size_oct = (16U + (my_width2 / 3U)) + size_t(((my_width2 % 3U) != 0U) ? 1U : 0U) + 1U;
+    static constexpr size_t wr_string_max_buffer_size_hex = (32U + (my_width2 / 4U)) + 1U;
+    static constexpr size_t wr_string_max_buffer_size_dec = (20U + size_t(((std::uintmax_t(my_width2) * UINTMAX_C(30103)) + UINTMAX_C(99999)) / UINTMAX_C(100000))) + 1U;
+
+    // Decimal output emits one chunk of digits10 decimal digits per division
+    // by the largest power of ten fitting in a limb. At and above
+    // wr_string_dec_dc_threshold limbs, the conversion uses divide and conquer
+    // with powers of ten 10^(digits10 * 2^k), down to parts having at most
+    // wr_string_dec_dc_leaf_limbs limbs that are converted chunk by chunk.
+    static constexpr size_t wr_string_dec_dc_threshold  = size_t(UINT8_C(128));
+    static constexpr size_t wr_string_dec_dc_leaf_limbs = size_t(UINT8_C(64));
+
+    // Decimal input accumulates digits10 decimal digits per limb multiply-add.
+    // At and above rd_string_dec_dc_threshold limbs, long strings of digits
+    // are converted by divide and conquer, multiplying the high parts with
+    // powers of ten 10^(digits10 * 2^k), down to parts having at most
+    // rd_string_dec_dc_leaf_limbs limbs that are converted chunk by chunk.
+    static constexpr size_t rd_string_dec_dc_threshold  = size_t(UINT16_C(1024));
+    static constexpr size_t rd_string_dec_dc_leaf_limbs = size_t(UINT16_C(256));
 
-    static constexpr auto from_rep(const representation_type& other_rep) -> uintwide_t
+    // Write string function.
+    WIDE_INTEGER_CONSTEXPR auto wr_string(      char*              str_result, // NOLINT(readability-function-cognitive-complexity)
+                                          const std::uint_fast8_t  base_rep     = 0x10U,
+                                          const bool               show_base    = true,
+                                          const bool               show_pos     = false,
+                                          const bool               is_uppercase = true,
+                                                unsinged_fast_type field_width  = 0U,
+                                          const char               fill_char    = char('0')) const -> bool
     {
-      // Factory-like creator from the internal data representation.
+      bool wr_string_is_ok = true;
 
-      return [&other_rep]() -> uintwide_t
+      if(base_rep == UINT8_C(8))
       {
-        uintwide_t a;
-
-        a.values = other_rep;
+        uintwide_t t(*this);
 
-        return a;
-      }();
-    }
+        const auto mask = static_cast<limb_type>(std::uint8_t(0x7U));
 
-    template<typename InputIteratorLeftType,
-             typename InputIteratorRightType>
-    static WIDE_INTEGER_CONSTEXPR auto compare_ranges(      InputIteratorLeftType  a,
-                                                            InputIteratorRightType b,
-                                                      const unsinged_fast_type     count) -> std::int_fast8_t
-    {
-      std::int_fast8_t n_return = 0;
+        detail::string_buffer<wr_string_max_buffer_size_oct, AllocatorType> str_temp { };
 
-      std::reverse_iterator<InputIteratorLeftType>  pa(a + count);
-      std::reverse_iterator<InputIteratorRightType> pb(b + count);
+        unsinged_fast_type pos = (str_temp.size() - 1U);
 
-      for( ; pa != std::reverse_iterator<InputIteratorLeftType>(a); ++pa, ++pb)
-      {
-        using value_left_type =
-          typename std::iterator_traits<InputIteratorLeftType>::value_type;
+        if(t.is_zero())
+        {
+          --pos;
 
-        if(*pa > value_left_type(*pb)) { n_return =  1; break; }
-        if(*pa < value_left_type(*pb)) { n_return = -1; break; }
-      }
+          str_temp[static_cast<std::size_t>(pos)] = char('0'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+        else
+        {
+          if(is_neg(t) == false)
+          {
+            while(!t.is_zero())
+            {
+              char c = char(*t.values.cbegin() & mask);
 
-      return n_return;
-    }
+              if(c <= char(INT8_C(8))) { c = char(c + char(INT8_C(0x30))); }
 
-    template<typename UnknownBuiltInIntegralType>
-    struct digits_ratio
-    {
-      using local_unknown_integral_type  = UnknownBuiltInIntegralType;
+              --pos;
 
-      using local_unsigned_conversion_type =
-        typename detail::uint_type_helper<
-          std::numeric_limits<local_unknown_integral_type>::is_signed
-            ? size_t(std::numeric_limits<local_unknown_integral_type>::digits + 1)
-            : size_t(std::numeric_limits<local_unknown_integral_type>::digits + 0)>::exact_unsigned_type;
+              str_temp[static_cast<std::size_t>(pos)] = c; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-      static constexpr unsinged_fast_type value = 
-        unsinged_fast_type(  std::numeric_limits<local_unsigned_conversion_type>::digits
-                           / std::numeric_limits<limb_type>::digits);
+              t >>= 3;
+            }
+          }
+          else
+          {
+            uintwide_t<my_width2, limb_type, AllocatorType, false> tu(t);
 
-      template<typename InputIteratorLeft>
-      static WIDE_INTEGER_CONSTEXPR auto extract(InputIteratorLeft  p_limb, unsinged_fast_type limb_count) -> local_unknown_integral_type
-      {
-        using local_limb_type      = typename std::iterator_traits<InputIteratorLeft>::value_type;
-        using left_difference_type = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+            while(!tu.is_zero())
+            {
+              char c = char(*tu.values.cbegin() & mask);
 
-        local_unsigned_conversion_type u = 0U;
+              if(c <= char(INT8_C(8))) { c = char(c + char(INT8_C(0x30))); }
 
-        for(unsinged_fast_type i = 0U; i < limb_count; ++i)
+              --pos;
+
+              str_temp[static_cast<std::size_t>(pos)] = c; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+              tu >>= 3;
+            }
+          }
+        }
+
+        if(show_base)
         {
-          u =
-            local_unsigned_conversion_type
-            (
-                u
-              | local_unsigned_conversion_type(local_unsigned_conversion_type(*(p_limb + left_difference_type(i))) << unsigned(std::numeric_limits<local_limb_type>::digits * int(i)))
-            );
+          --pos;
+
+          str_temp[static_cast<std::size_t>(pos)] = char('0'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
         }
 
-        return local_unknown_integral_type(u);
-      }
-    };
+        if(show_pos)
+        {
+          --pos;
 
-    // Implement a function that extracts any built-in signed or unsigned integral type.
-    template<typename UnknownBuiltInIntegralType,
-             typename = typename std::enable_if<std::is_integral<UnknownBuiltInIntegralType>::value>::type>
-    WIDE_INTEGER_CONSTEXPR auto extract_builtin_integral_type() const -> UnknownBuiltInIntegralType
-    {
-      using local_unknown_integral_type = UnknownBuiltInIntegralType;
-      using digits_ratio_type           = digits_ratio<local_unknown_integral_type>;
+          str_temp[static_cast<std::size_t>(pos)] = char('+'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
 
-      const unsinged_fast_type ilim = (std::min)(unsinged_fast_type(digits_ratio_type::value),
-                                                 unsinged_fast_type(values.size()));
+        if(field_width != 0U)
+        {
+          field_width = (std::min)(field_width, unsinged_fast_type(str_temp.size() - 1U));
 
-      // Handle cases for which the input parameter is less wide
-      // or equally as wide as the limb width or wider than the limb width.
-      return ((digits_ratio_type::value < 2U)
-               ? static_cast<local_unknown_integral_type>(*values.cbegin())
-               : digits_ratio_type::extract(values.data(), ilim));
-    }
+          while(singed_fast_type(pos) > singed_fast_type((str_temp.size() - 1U) - field_width))
+          {
+            --pos;
 
-    #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-    // Implement a function that extracts any built-in floating-point type.
-    template<typename FloatingPointType,
-             typename = typename std::enable_if<std::is_floating_point<FloatingPointType>::value>::type>
-    WIDE_INTEGER_CONSTEXPR auto extract_builtin_floating_point_type() const -> FloatingPointType
-    {
-      using local_unsigned_wide_integer_type = uintwide_t<Width2, limb_type, AllocatorType, false>;
-      using local_builtin_float_type         = FloatingPointType;
+            str_temp[static_cast<std::size_t>(pos)] = fill_char; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+          }
+        }
 
-      const bool u_is_neg = is_neg(*this);
+        str_temp[(str_temp.size() - 1U)] = char('\0');
 
-      const local_unsigned_wide_integer_type u((!u_is_neg) ? *this : -*this);
+        detail::strcpy_unsafe(str_result, str_temp.data() + pos);
+      }
+      else if(base_rep == UINT8_C(10))
+      {
+        uintwide_t t(*this);
 
-      const auto my_msb = static_cast<size_t>(msb(u));
-      const auto ilim   = size_t
-                          (
-                             size_t(  size_t(my_msb + 1U) / size_t(std::numeric_limits<limb_type>::digits))
-                           + size_t(((size_t(my_msb + 1U) % size_t(std::numeric_limits<limb_type>::digits)) != 0U) ? size_t(1U) : size_t(0U))
-                          );
+        const bool str_has_neg_sign = is_neg(t);
 
-      auto a = local_builtin_float_type(0.0F);
+        if(str_has_neg_sign)
+        {
+          t.negate();
+        }
 
-      constexpr long double one_ldbl(1.0L);
+        detail::string_buffer<wr_string_max_buffer_size_dec, AllocatorType> str_temp { };
 
-      long double ldexp_runner(one_ldbl);
+        unsinged_fast_type pos = (str_temp.size() - 1U);
 
-      for(auto i = size_t(0U); i < ilim; ++i)
-      {
-        auto ld      = static_cast<long double>(0.0L);
-        auto lm_mask = limb_type(1ULL);
+        if(t.is_zero())
+        {
+          --pos;
 
-        for(auto j = size_t(0U); j < size_t(std::numeric_limits<limb_type>::digits); ++j)
+          str_temp[static_cast<std::size_t>(pos)] = char('0'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+        else
         {
-          if(limb_type(*(u.values.cbegin() + size_t(i)) & lm_mask) != limb_type(0U))
-          {
-            ld = static_cast<long double>(ld + ldexp_runner);
-          }
+          wr_string_unsigned_type tu(t);
 
-          constexpr long double two_ldbl(2.0L);
+          pos = static_cast<unsinged_fast_type>(pos - wr_string_dec(tu, str_temp.data() + pos)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
 
-          lm_mask      = limb_type(lm_mask << 1U);
-          ldexp_runner = static_cast<long double>(ldexp_runner * two_ldbl);
+        if(show_pos && (!str_has_neg_sign))
+        {
+          --pos;
+
+          str_temp[static_cast<std::size_t>(pos)] = char('+'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
         }
+        else if(str_has_neg_sign)
+        {
+          --pos;
 
-        a += static_cast<local_builtin_float_type>(ld);
-      }
+          str_temp[static_cast<std::size_t>(pos)] = char('-'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
 
-      return local_builtin_float_type((!u_is_neg) ? a : -a);
-    }
-    #endif
+        if(field_width != 0U)
+        {
+          field_width = (std::min)(field_width, unsinged_fast_type(str_temp.size() - 1U));
 
-    template<const size_t OtherWidth2>
-    static WIDE_INTEGER_CONSTEXPR void eval_mul_unary(      uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
-                                                      const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
-                                                      typename std::enable_if<((OtherWidth2 / std::numeric_limits<LimbType>::digits) < number_of_limbs_karatsuba_threshold)>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
-    {
-      // Unary multiplication function using schoolbook multiplication,
-      // but we only need to retain the low half of the n*n algorithm.
-      // In other words, this is an n*n->n bit multiplication.
+          while(singed_fast_type(pos) > singed_fast_type((str_temp.size() - 1U) - field_width))
+          {
+            --pos;
 
-      constexpr size_t local_number_of_limbs =
-        uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+            str_temp[static_cast<std::size_t>(pos)] = fill_char; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+          }
+        }
 
-      representation_type result { };
+        str_temp[static_cast<std::size_t>(str_temp.size() - 1U)] = char('\0');
 
-      eval_multiply_n_by_n_to_lo_part(result.data(),
-                                      u.values.data(),
-                                      v.values.data(),
-                                      local_number_of_limbs);
+        detail::strcpy_unsafe(str_result, str_temp.data() + pos);
+      }
+      else if(base_rep == UINT8_C(16))
+      {
+        uintwide_t t(*this);
 
-      std::copy(result.cbegin(),
-                result.cbegin() + local_number_of_limbs,
-                u.values.begin());
-    }
+        const auto mask = static_cast<limb_type>(std::uint8_t(0xFU));
 
-    template<const size_t OtherWidth2>
-    static WIDE_INTEGER_CONSTEXPR void eval_mul_unary(      uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
-                                                      const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
-                                                      typename std::enable_if<((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_karatsuba_threshold)>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
-    {
-      // Unary multiplication function using Karatsuba multiplication.
+        detail::string_buffer<wr_string_max_buffer_size_hex, AllocatorType> str_temp { };
 
-      constexpr size_t local_number_of_limbs =
-        uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+        unsinged_fast_type pos = (str_temp.size() - 1U);
 
-      // TBD: Can use specialized allocator or memory pool for these arrays.
-      // Good examples for this (both threaded as well as non-threaded)
-      // can be found in the wide_decimal project.
-      using result_array_type =
-        typename std::conditional<std::is_same<AllocatorType, void>::value,
-                                  detail::fixed_static_array <limb_type, number_of_limbs * 2U>,
-                                  detail::fixed_dynamic_array<limb_type,
-                                                              number_of_limbs * 2U,
-                                                              typename std::allocator_traits<typename std::conditional<std::is_same<AllocatorType, void>::value,
-                                                                                                                       std::allocator<void>,
-                                                                                                                       AllocatorType>::type>::template rebind_alloc<limb_type>>>::type;
+        if(t.is_zero())
+        {
+          --pos;
 
-      using storage_array_type =
-        typename std::conditional<std::is_same<AllocatorType, void>::value,
-                                  detail::fixed_static_array <limb_type, number_of_limbs * 4U>,
-                                  detail::fixed_dynamic_array<limb_type,
-                                                              number_of_limbs * 4U,
-                                                              typename std::allocator_traits<typename std::conditional<std::is_same<AllocatorType, void>::value,
-                                                                                                                       std::allocator<void>,
-                                                                                                                       AllocatorType>::type>::template rebind_alloc<limb_type>>>::type;
+          str_temp[static_cast<std::size_t>(pos)] = char('0'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+        else
+        {
+          if(!is_neg(t))
+          {
+            while(!t.is_zero())
+            {
+              char c(*t.values.cbegin() & mask);
 
-      result_array_type  result;
-      storage_array_type t;
+              if      (c <= char(INT8_C(  9)))                              { c = char(c + char(INT8_C(0x30))); }
+              else if((c >= char(INT8_C(0xA))) && (c <= char(INT8_C(0xF)))) { c = char(c + (is_uppercase ? char(INT8_C(55)) : char(INT8_C(87)))); }
 
-      eval_multiply_kara_n_by_n_to_2n(result.data(),
-                                      u.values.data(),
-                                      v.values.data(),
-                                      local_number_of_limbs,
-                                      t.data());
+              --pos;
 
-      std::copy(result.cbegin(),
-                result.cbegin() + local_number_of_limbs,
-                u.values.begin());
-    }
+              str_temp[static_cast<std::size_t>(pos)] = c; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-    template<typename ResultIterator,
-             typename InputIteratorLeft,
-             typename InputIteratorRight>
-    static WIDE_INTEGER_CONSTEXPR auto eval_add_n(      ResultIterator     r,
-                                                        InputIteratorLeft  u,
-                                                        InputIteratorRight v,
-                                                  const unsinged_fast_type count,
-                                                  const limb_type          carry_in = limb_type(0U)) -> limb_type
-    {
-      auto carry_out = static_cast<std::uint_fast8_t>(carry_in);
+              t >>= 4;
+            }
+          }
+          else
+          {
+            uintwide_t<my_width2, limb_type, AllocatorType, false> tu(t);
 
-      static_assert
-      (
-           (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
-        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits),
-        "Error: Internals require same widths for left-right-result limb_types at the moment"
-      );
+            while(!tu.is_zero())
+            {
+              char c(*tu.values.cbegin() & mask);
 
-      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+              if      (c <= char(INT8_C(  9)))                              { c = char(c + char(INT8_C(0x30))); }
+              else if((c >= char(INT8_C(0xA))) && (c <= char(INT8_C(0xF)))) { c = char(c + (is_uppercase ? char(INT8_C(55)) : char(INT8_C(87)))); }
 
-      using local_double_limb_type =
-        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+              --pos;
 
-      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
-      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
-      using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+              str_temp[static_cast<std::size_t>(pos)] = c; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-      for(unsinged_fast_type i = 0U; i < count; ++i)
-      {
-        const auto uv_as_ularge =
-          local_double_limb_type(local_double_limb_type(local_double_limb_type(*(u + left_difference_type(i))) + *(v + right_difference_type(i))) + carry_out);
+              tu >>= 4;
+            }
+          }
+        }
 
-        carry_out = static_cast<std::uint_fast8_t>(detail::make_hi<local_limb_type>(uv_as_ularge));
+        if(show_base)
+        {
+          --pos;
 
-        *(r + result_difference_type(i)) = static_cast<local_limb_type>(uv_as_ularge);
-      }
+          str_temp[static_cast<std::size_t>(pos)] = (is_uppercase ? char('X') : char('x')); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-      return static_cast<limb_type>(carry_out);
-    }
+          --pos;
 
-    template<typename ResultIterator,
-             typename InputIteratorLeft,
-             typename InputIteratorRight>
-    static WIDE_INTEGER_CONSTEXPR auto eval_subtract_n(      ResultIterator     r,
-                                                             InputIteratorLeft  u,
-                                                             InputIteratorRight v,
-                                                       const unsinged_fast_type count,
-                                                       const bool               has_borrow_in = false) -> bool
-    {
-      std::uint_fast8_t has_borrow_out = (has_borrow_in ? 1U : 0U);
+          str_temp[static_cast<std::size_t>(pos)] = char('0'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
 
-      static_assert
-      (
-           (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
-        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits),
-        "Error: Internals require same widths for left-right-result limb_types at the moment"
-      );
+        if(show_pos)
+        {
+          --pos;
 
-      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+          str_temp[static_cast<std::size_t>(pos)] = char('+'); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
 
-      using local_double_limb_type =
-        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+        if(field_width != 0U)
+        {
+          field_width = (std::min)(field_width, unsinged_fast_type(str_temp.size() - 1U));
 
-      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
-      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
-      using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+          while(singed_fast_type(pos) > singed_fast_type((str_temp.size() - 1U) - field_width))
+          {
+            --pos;
 
-      for(unsinged_fast_type i = 0U; i < count; ++i)
-      {
-        const auto uv_as_ularge = local_double_limb_type(local_double_limb_type(local_double_limb_type(*(u + left_difference_type(i))) - *(v + right_difference_type(i))) - has_borrow_out);
+            str_temp[static_cast<std::size_t>(pos)] = fill_char; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+          }
+        }
 
-        has_borrow_out = (detail::make_hi<local_limb_type>(uv_as_ularge) != local_limb_type(0U)) ? 1U : 0U;
+        str_temp[(str_temp.size() - 1U)] = char('\0');
 
-        *(r + result_difference_type(i)) = local_limb_type(uv_as_ularge);
+        detail::strcpy_unsafe(str_result, str_temp.data() + pos);
+      }
+      else
+      {
+        wr_string_is_ok = false;
       }
 
-      return (has_borrow_out != 0U);
+      return wr_string_is_ok;
     }
 
-    template<typename ResultIterator,
-             typename InputIteratorLeft,
-             typename InputIteratorRight,
-             const size_t RePhraseWidth2 = Width2,
-             typename std::enable_if<(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs == 4U)>::type const* = nullptr>
-    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_lo_part(      ResultIterator     r,
-                                                                             InputIteratorLeft  a,
-                                                                             InputIteratorRight b,
-                                                                       const unsinged_fast_type count)
+    #if !defined(WIDE_INTEGER_DISABLE_TO_CHARS)
+    // Write the digits in the base 2...36 to [first, last), in the manner
+    // of std::to_chars: lowercase letters, no prefix and a minus sign
+    // for negative values. No null terminator is written.
+    WIDE_INTEGER_CONSTEXPR auto wr_chars(char* first, char* last, const int base) const -> to_chars_result
     {
-      static_cast<void>(count);
+      if((base < 2) || (base > 36))
+      {
+        return { first, std::errc::invalid_argument };
+      }
 
-      static_assert
-      (
-           (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
-        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits),
-        "Error: Internals require same widths for left-right-result limb_types at the moment"
-      );
+      wr_string_unsigned_type t(*this);
 
-      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+      const bool value_is_neg = is_neg(*this);
 
-      using local_double_limb_type =
-        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+      if(value_is_neg)
+      {
+        t.negate();
+      }
 
-      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
-      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
-      using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+      const auto size_sign = static_cast<std::ptrdiff_t>(value_is_neg ? 1 : 0);
 
-      using result_value_type = typename std::iterator_traits<ResultIterator>::value_type;
+      unsinged_fast_type count { };
 
-      // The algorithm has been derived from the polynomial multiplication.
-      // After the multiplication terms of equal order are grouped
-      // together and retained up to order(3). The carries from the
-      // multiplications are included when adding up the terms.
-      // The results of the intermediate multiplications are stored
-      // in local variables in memory.
+      if(t.is_zero())
+      {
+        if((last - first) < static_cast<std::ptrdiff_t>(size_sign + 1))
+        {
+          return { last, std::errc::value_too_large };
+        }
 
-      //   Column[CoefficientList[Expand[(a0 + a1 x + a2 x^2 + a3 x^3) (b0 + b1 x + b2 x^2 + b3 x^3)], x]]
-      //   a0b0
-      //   a1b0 + a0b1
-      //   a2b0 + a1b1 + a0b2
-      //   a3b0 + a2b1 + a1b2 + a0b3
+        count = 1U;
 
-      // See also Wolfram Alpha at:
-      // https://www.wolframalpha.com/input/?i=Column%5BCoefficientList%5B+++Expand%5B%28a0+%2B+a1+x+%2B+a2+x%5E2+%2B+a3+x%5E3%29+%28b0+%2B+b1+x+%2B+b2+x%5E2+%2B+b3+x%5E3%29%5D%2C++++x%5D%5D
-      // ... and take the upper half of the pyramid.
+        *(first + size_sign) = char('0'); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+      else if((unsigned(base) & unsigned(unsigned(base) - 1U)) == 0U)
+      {
+        // Bases that are powers of two take their digits straight from the limbs.
+        const auto digit_bits = static_cast<unsinged_fast_type>(detail::msb_helper(static_cast<std::uint8_t>(base)));
 
-      // Performance improvement:
-      //   (old) kops_per_sec: 33173.50
-      //   (new) kops_per_sec: 95069.43
+        count = static_cast<unsinged_fast_type>(static_cast<unsinged_fast_type>(msb(t) + digit_bits) / digit_bits);
 
-      local_double_limb_type r1;
-      local_double_limb_type r2;
+        if((last - first) < static_cast<std::ptrdiff_t>(size_sign + static_cast<std::ptrdiff_t>(count)))
+        {
+          return { last, std::errc::value_too_large };
+        }
 
-      const auto a0b0 = local_double_limb_type(*(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(0))));
-      const auto a0b1 = local_double_limb_type(*(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(1))));
-      const auto a1b0 = local_double_limb_type(*(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(0))));
-      const auto a1b1 = local_double_limb_type(*(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(1))));
+        for(auto i = static_cast<unsinged_fast_type>(0U); i < count; ++i)
+        {
+          const auto digit = t.wr_chars_bits(static_cast<unsinged_fast_type>(static_cast<unsinged_fast_type>(count - 1U) - i) * digit_bits, digit_bits);
 
-      // One special case is considered, the case of multiplication
-      // of the form BITS/2 * BITS/2 = BITS. In this case, the algorithm
-      // can be significantly simplified by using only the 'lower-halves'
-      // of the data.
-      if(    (*(a + left_difference_type(2)) == 0U) && (*(b + right_difference_type(2)) == 0U)
-          && (*(a + left_difference_type(3)) == 0U) && (*(b + right_difference_type(3)) == 0U))
+          *(first + static_cast<std::ptrdiff_t>(size_sign + static_cast<std::ptrdiff_t>(i))) = wr_chars_digit(digit); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+      else if(base == 10)
       {
-        r1    = local_double_limb_type
-                (
-                  local_double_limb_type
-                  (
-                    detail::make_hi<local_limb_type>(a0b0)
-                  )
-                  + detail::make_lo<local_limb_type>(a1b0)
-                  + detail::make_lo<local_limb_type>(a0b1)
-                )
-                ;
-        r2    = local_double_limb_type
-                (
-                  local_double_limb_type
-                  (
-                    detail::make_hi<local_limb_type>(r1)
-                  )
-                  + detail::make_lo<local_limb_type>(a1b1)
-                  + detail::make_hi<local_limb_type>(a0b1)
-                  + detail::make_hi<local_limb_type>(a1b0)
-                )
-                ;
-        *(r + result_difference_type(3))
-              = result_value_type
-                (
-                    detail::make_hi<local_limb_type>(r2)
-                  + detail::make_hi<local_limb_type>(a1b1)
-                )
-                ;
+        detail::string_buffer<wr_string_max_buffer_size_dec, AllocatorType> str_temp { };
+
+        count = wr_string_dec(t, str_temp.data() + str_temp.size()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        if((last - first) < static_cast<std::ptrdiff_t>(size_sign + static_cast<std::ptrdiff_t>(count)))
+        {
+          return { last, std::errc::value_too_large };
+        }
+
+        std::copy(str_temp.data() + static_cast<std::size_t>(str_temp.size() - count), str_temp.data() + str_temp.size(), first + size_sign); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       }
       else
       {
-        const auto a0b2 = local_double_limb_type(*(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(2))));
-        const auto a2b0 = local_double_limb_type(*(a + left_difference_type(2)) * local_double_limb_type(*(b + right_difference_type(0))));
+        // Base three needs the most digits of the remaining bases.
+        detail::string_buffer<size_t(size_t(size_t(my_width2 * 2U) / 3U) + 2U), AllocatorType> str_temp { };
 
-        r1    = local_double_limb_type
-                (
-                  local_double_limb_type
-                  (
-                    detail::make_hi<local_limb_type>(a0b0)
-                  )
-                  + detail::make_lo<local_limb_type>(a1b0)
-                  + detail::make_lo<local_limb_type>(a0b1)
-                )
-                ;
-        r2    = local_double_limb_type
-                (
-                  local_double_limb_type
-                  (
-                    detail::make_hi<local_limb_type>(r1)
-                  )
-                  + detail::make_lo<local_limb_type>(a2b0)
-                  + detail::make_lo<local_limb_type>(a1b1)
-                  + detail::make_lo<local_limb_type>(a0b2)
-                  + detail::make_hi<local_limb_type>(a1b0)
-                  + detail::make_hi<local_limb_type>(a0b1)
-                )
-                ;
-        *(r + result_difference_type(3))
-              = result_value_type
-                (
-                    detail::make_hi<local_limb_type>(r2)
-                  + static_cast<local_limb_type>    (*(a + left_difference_type(3)) * local_double_limb_type(*(b + right_difference_type(0))))
-                  + static_cast<local_limb_type>    (*(a + left_difference_type(2)) * local_double_limb_type(*(b + right_difference_type(1))))
-                  + static_cast<local_limb_type>    (*(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(2))))
-                  + static_cast<local_limb_type>    (*(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(3))))
-                  + detail::make_hi<local_limb_type>(a2b0)
-                  + detail::make_hi<local_limb_type>(a1b1)
-                  + detail::make_hi<local_limb_type>(a0b2)
-                )
-                ;
+        count = wr_chars_chunked(t, str_temp.data() + str_temp.size(), static_cast<limb_type>(base)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        if((last - first) < static_cast<std::ptrdiff_t>(size_sign + static_cast<std::ptrdiff_t>(count)))
+        {
+          return { last, std::errc::value_too_large };
+        }
+
+        std::copy(str_temp.data() + static_cast<std::size_t>(str_temp.size() - count), str_temp.data() + str_temp.size(), first + size_sign); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       }
 
-      *(r + result_difference_type(0)) = local_limb_type(a0b0);
-      *(r + result_difference_type(1)) = local_limb_type(r1);
-      *(r + result_difference_type(2)) = local_limb_type(r2);
+      if(value_is_neg)
+      {
+        *first = char('-');
+      }
+
+      return { first + static_cast<std::ptrdiff_t>(size_sign + static_cast<std::ptrdiff_t>(count)), std::errc() }; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     }
 
-    #if defined(WIDE_INTEGER_HAS_MUL_8_BY_8_UNROLL)
-    template<typename ResultIterator,
-             typename InputIteratorLeft,
-             typename InputIteratorRight,
-             const size_t RePhraseWidth2 = Width2,
-             typename std::enable_if<(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs == size_t(UINT32_C(8)))>::type const* = nullptr>
-    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_lo_part(      ResultIterator     r,
-                                                                             InputIteratorLeft  a,
-                                                                             InputIteratorRight b,
-                                                                       const unsinged_fast_type count)
+    // Read the digits in the base 2...36 from [first, last), in the manner
+    // of std::from_chars: no prefix, no plus sign and a minus sign only
+    // for signed types. On error, the value is left unchanged.
+    WIDE_INTEGER_CONSTEXPR auto rd_chars(const char* first, const char* last, const int base) -> from_chars_result
     {
-      static_cast<void>(count);
-
-      static_assert
-      (
-           (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
-        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits),
-        "Error: Internals require same widths for left-right-result limb_types at the moment"
-      );
-
-      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+      if((base < 2) || (base > 36))
+      {
+        return { first, std::errc::invalid_argument };
+      }
 
-      using local_double_limb_type =
-        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+      const char* p = first;
 
-      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
-      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
-      using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+      const bool value_is_neg = (IsSigned && (p != last) && (*p == char('-')));
 
-      // The algorithm has been derived from the polynomial multiplication.
-      // After the multiplication terms of equal order are grouped
-      // together and retained up to order(3). The carries from the
-      // multiplications are included when adding up the terms.
-      // The results of the intermediate multiplications are stored
-      // in local variables in memory.
+      if(value_is_neg)
+      {
+        ++p;
+      }
 
-      //   Column[CoefficientList[Expand[(a0 + a1 x + a2 x^2 + a3 x^3 + a4 x^4 + a5 x^5 + a6 x^6 + a7 x^7) (b0 + b1 x + b2 x^2 + b3 x^3 + b4 x^4 + b5 x^5 + b6 x^6 + b7 x^7)], x]]
-      //   a0b0
-      //   a1b0 + a0b1
-      //   a2b0 + a1b1 + a0b2
-      //   a3b0 + a2b1 + a1b2 + a0b3
-      //   a4b0 + a3b1 + a2b2 + a1b3 + a0b4
-      //   a5b0 + a4b1 + a3b2 + a2b3 + a1b4 + a0b5
-      //   a6b0 + a5b1 + a4b2 + a3b3 + a2b4 + a1b5 + a0b6
-      //   a7b0 + a6b1 + a5b2 + a4b3 + a3b4 + a2b5 + a1b6 + a0b7
+      const char* p_digits = p;
 
-      // See also Wolfram Alpha at:
-      // https://www.wolframalpha.com/input/?i=Column%5BCoefficientList%5B+++Expand%5B%28a0+%2B+a1+x+%2B+a2+x%5E2+%2B+a3+x%5E3%29+%28b0+%2B+b1+x+%2B+b2+x%5E2+%2B+b3+x%5E3%29%5D%2C++++x%5D%5D
-      // ... and take the upper half of the pyramid.
+      while((p != last) && (rd_chars_digit(*p) < base))
+      {
+        ++p;
+      }
 
-      const local_double_limb_type a0b0 = *(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(0)));
+      if(p == p_digits)
+      {
+        return { first, std::errc::invalid_argument };
+      }
 
-      const local_double_limb_type a1b0 = *(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(0)));
-      const local_double_limb_type a0b1 = *(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(1)));
+      // Skip leading zeros, so that the overflow can be detected
+      // for the fast paths from the number of significant digits.
+      while((p_digits != p) && (*p_digits == char('0')))
+      {
+        ++p_digits;
+      }
 
-      const local_double_limb_type a2b0 = *(a + left_difference_type(2)) * local_double_limb_type(*(b + right_difference_type(0)));
-      const local_double_limb_type a1b1 = *(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(1)));
-      const local_double_limb_type a0b2 = *(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(2)));
+      const auto n = static_cast<unsinged_fast_type>(p - p_digits);
 
-      const local_double_limb_type a3b0 = *(a + left_difference_type(3)) * local_double_limb_type(*(b + right_difference_type(0)));
-      const local_double_limb_type a2b1 = *(a + left_difference_type(2)) * local_double_limb_type(*(b + right_difference_type(1)));
-      const local_double_limb_type a1b2 = *(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(2)));
-      const local_double_limb_type a0b3 = *(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(3)));
+      wr_string_unsigned_type u;
 
-      const local_double_limb_type a3b1 = *(a + left_difference_type(3)) * local_double_limb_type(*(b + right_difference_type(1)));
-      const local_double_limb_type a2b2 = *(a + left_difference_type(2)) * local_double_limb_type(*(b + right_difference_type(2)));
-      const local_double_limb_type a1b3 = *(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(3)));
+      bool is_out_of_range = false;
 
-      const local_double_limb_type a3b2 = *(a + left_difference_type(3)) * local_double_limb_type(*(b + right_difference_type(2)));
-      const local_double_limb_type a2b3 = *(a + left_difference_type(2)) * local_double_limb_type(*(b + right_difference_type(3)));
+      if((base == 10) && (n <= unsinged_fast_type(std::numeric_limits<wr_string_unsigned_type>::digits10)))
+      {
+        static_cast<void>(u.rd_string_dec(p_digits, n));
+      }
+      else if(base == 16)
+      {
+        is_out_of_range = (n > unsinged_fast_type(my_width2 / 4U));
 
-      const local_double_limb_type a3b3 = *(a + left_difference_type(3)) * local_double_limb_type(*(b + right_difference_type(3)));
+        if(!is_out_of_range)
+        {
+          static_cast<void>(u.rd_string_hex(p_digits, n));
+        }
+      }
+      else
+      {
+        is_out_of_range = (!u.rd_chars_chunked(p_digits, n, static_cast<limb_type>(base)));
+      }
+
+      if(   (!is_out_of_range)
+         && IsSigned
+         && (static_cast<limb_type>(*(u.values.cbegin() + size_t(number_of_limbs - 1U)) >> unsigned(std::numeric_limits<limb_type>::digits - 1)) != 0U))
+      {
+        // The magnitude of a signed value is at most 2^(my_width2 - 1),
+        // and it can only be reached by negative values.
+        is_out_of_range = ((!value_is_neg) || ((u << 1U) != 0U));
+      }
+
+      if(is_out_of_range)
+      {
+        return { p, std::errc::result_out_of_range };
+      }
+
+      operator=(uintwide_t(u));
+
+      if(value_is_neg)
+      {
+        negate();
+      }
+
+      return { p, std::errc() };
+    }
+    #endif
+
+    template<const bool RePhraseIsSigned = IsSigned,
+             typename std::enable_if<(!RePhraseIsSigned)>::type const* = nullptr>
+    WIDE_INTEGER_CONSTEXPR auto compare(const uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& other) const -> std::int_fast8_t
+    {
+      return compare_ranges(values.data(),
+                            other.values.data(),
+                            uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>::number_of_limbs);
+    }
+
+    template<const bool RePhraseIsSigned = IsSigned,
+             typename std::enable_if<(RePhraseIsSigned)>::type const* = nullptr>
+    WIDE_INTEGER_CONSTEXPR auto compare(const uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& other) const -> std::int_fast8_t
+    {
+      const bool other_is_neg = is_neg(other);
+
+      return
+      is_neg(*this)
+        ? (other_is_neg ? compare_ranges(values.data(), other.values.data(), uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>::number_of_limbs)
+                        : INT8_C(-1))
+        : (other_is_neg ? INT8_C(1)
+                        : compare_ranges(values.data(), other.values.data(), uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>::number_of_limbs))
+      ;
+    }
+
+    WIDE_INTEGER_CONSTEXPR void negate()
+    {
+      bitwise_not();
+
+      preincrement();
+    }
+
+    WIDE_INTEGER_CONSTEXPR void eval_divmod(const uintwide_t& other,
+                                                  uintwide_t* remainder)
+    {
+      // Divide *this by other and optionally store the remainder,
+      // both from one single pass of the long division. The signs
+      // follow operator/=() and operator%=(). The quotient truncates
+      // toward zero and the remainder takes the sign of the numerator.
+      // Division by zero yields the maximum value and zero remainder.
+
+      if(other.is_zero())
+      {
+        operator=(limits_helper_max(IsSigned));
+
+        if(remainder != nullptr)
+        {
+          *remainder = uintwide_t(std::uint8_t(0U));
+        }
+      }
+      else
+      {
+        const bool numererator_was_neg = is_neg(*this);
+        const bool denominator_was_neg = is_neg(other);
+
+        if(numererator_was_neg || denominator_was_neg)
+        {
+          using local_unsigned_wide_type = uintwide_t<Width2, limb_type, AllocatorType, false>;
+
+          local_unsigned_wide_type a(*this);
+          local_unsigned_wide_type b(other);
+
+          if(numererator_was_neg) { a.negate(); }
+          if(denominator_was_neg) { b.negate(); }
+
+          local_unsigned_wide_type remainder_unsigned;
+
+          a.eval_divide_knuth(b, ((remainder != nullptr) ? &remainder_unsigned : nullptr));
+
+          if(numererator_was_neg != denominator_was_neg) { a.negate(); }
+
+          values = a.values;
+
+          if(remainder != nullptr)
+          {
+            if(numererator_was_neg) { remainder_unsigned.negate(); }
+
+            remainder->values = remainder_unsigned.values;
+          }
+        }
+        else
+        {
+          eval_divide_knuth(other, remainder);
+        }
+      }
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto divide_by(const limb_divisor<limb_type>& d) -> limb_type
+    {
+      // Divide by the single-limb divisor d having a precomputed
+      // reciprocal and return the remainder. The quotient and the remainder
+      // are the same as for operator/() and operator%() with an unsigned
+      // built-in divisor. Division by zero yields the maximum value.
+
+      if(d.divisor() == limb_type(0U))
+      {
+        operator=(limits_helper_max(IsSigned));
+
+        return limb_type(0U);
+      }
+
+      const bool u_is_neg = is_neg(*this);
+
+      if(u_is_neg) { negate(); }
+
+      auto r = eval_divide_by_limb_divisor(d, leading_zero_limbs());
+
+      if(u_is_neg)
+      {
+        negate();
+
+        r = static_cast<limb_type>(static_cast<limb_type>(~r) + 1U);
+      }
+
+      return r;
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto eval_divide_by_limb_divisor(const limb_divisor<limb_type>& d,
+                                                            const unsinged_fast_type       u_offset) -> limb_type
+    {
+      // Divide the limbs below u_offset leading zero limbs by d
+      // and return the remainder. The sign is not considered.
+      return d.divide(values.begin(), unsinged_fast_type(number_of_limbs - u_offset));
+    }
+
+    WIDE_INTEGER_CONSTEXPR void eval_divide_by_single_limb(const limb_type          short_denominator,
+                                                           const unsinged_fast_type u_offset,
+                                                                 uintwide_t*        remainder)
+    {
+      // The denominator has one single limb.
+      // Use a one-dimensional division algorithm.
+
+      // The reciprocal of limb_divisor only pays off when the divisor
+      // is reused (see divide_by()). For a one-off divisor,
+      // the double-limb hardware division is faster.
+
+      auto long_numerator = double_limb_type(0U);
+
+      auto hi_part = limb_type(0U);
+
+      for(auto i = singed_fast_type(unsinged_fast_type(number_of_limbs - 1U) - u_offset); singed_fast_type(i) >= 0; --i)
+      {
+        long_numerator =
+          double_limb_type
+          (
+             double_limb_type(*(values.cbegin() + size_t(i)))
+           + double_limb_type(double_limb_type(long_numerator - double_limb_type(double_limb_type(short_denominator) * hi_part)) << unsigned(std::numeric_limits<limb_type>::digits))
+          );
+
+        *(values.begin() + size_t(i)) =
+          detail::make_lo<limb_type>(double_limb_type(long_numerator / short_denominator));
+
+        hi_part = *(values.cbegin() + size_t(i));
+      }
+
+      if(remainder != nullptr)
+      {
+        long_numerator =
+          double_limb_type
+          (
+             double_limb_type(*values.cbegin())
+           + double_limb_type(double_limb_type(long_numerator - double_limb_type(double_limb_type(short_denominator) * hi_part)) << unsigned(std::numeric_limits<limb_type>::digits))
+          );
+
+        *remainder = limb_type(long_numerator >> unsigned(std::numeric_limits<limb_type>::digits));
+      }
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto is_zero() const -> bool
+    {
+      auto it = values.cbegin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      while((it != values.cend()) && (*it == limb_type(0U)))
+      {
+        ++it;
+      }
+
+      return (it == values.cend());
+    }
+
+    template<const bool RePhraseIsSigned = IsSigned,
+             typename std::enable_if<(!RePhraseIsSigned)>::type const* = nullptr>
+    static constexpr auto is_neg(const uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>&) -> bool // NOLINT(hicpp-named-parameter,readability-named-parameter)
+    {
+      return false;
+    }
+
+    template<const bool RePhraseIsSigned = IsSigned,
+             typename std::enable_if<(RePhraseIsSigned)>::type const* = nullptr>
+    static constexpr auto is_neg(const uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& a) -> bool
+    {
+      return (std::uint_fast8_t(std::uint_fast8_t(a.values.back() >> size_t(std::numeric_limits<typename uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>::limb_type>::digits - 1)) & 1U) != 0U);
+    }
+
+  private:
+    representation_type values { };
+
+    static constexpr auto from_rep(const representation_type& other_rep) -> uintwide_t
+    {
+      // Factory-like creator from the internal data representation.
+
+      return [&other_rep]() -> uintwide_t
+      {
+        uintwide_t a;
+
+        a.values = other_rep;
+
+        return a;
+      }();
+    }
+
+    template<typename InputIteratorLeftType,
+             typename InputIteratorRightType>
+    static WIDE_INTEGER_CONSTEXPR auto compare_ranges(      InputIteratorLeftType  a,
+                                                            InputIteratorRightType b,
+                                                      const unsinged_fast_type     count) -> std::int_fast8_t
+    {
+      std::int_fast8_t n_return = 0;
+
+      std::reverse_iterator<InputIteratorLeftType>  pa(a + count);
+      std::reverse_iterator<InputIteratorRightType> pb(b + count);
+
+      for( ; pa != std::reverse_iterator<InputIteratorLeftType>(a); ++pa, ++pb)
+      {
+        using value_left_type =
+          typename std::iterator_traits<InputIteratorLeftType>::value_type;
+
+        if(*pa > value_left_type(*pb)) { n_return =  1; break; }
+        if(*pa < value_left_type(*pb)) { n_return = -1; break; }
+      }
+
+      return n_return;
+    }
+
+    template<typename UnknownBuiltInIntegralType>
+    struct digits_ratio
+    {
+      using local_unknown_integral_type  = UnknownBuiltInIntegralType;
+
+      using local_unsigned_conversion_type =
+        typename detail::uint_type_helper<
+          std::numeric_limits<local_unknown_integral_type>::is_signed
+            ? size_t(std::numeric_limits<local_unknown_integral_type>::digits + 1)
+            : size_t(std::numeric_limits<local_unknown_integral_type>::digits + 0)>::exact_unsigned_type;
+
+      static constexpr unsinged_fast_type value = 
+        unsinged_fast_type(  std::numeric_limits<local_unsigned_conversion_type>::digits
+                           / std::numeric_limits<limb_type>::digits);
+
+      template<typename InputIteratorLeft>
+      static WIDE_INTEGER_CONSTEXPR auto extract(InputIteratorLeft  p_limb, unsinged_fast_type limb_count) -> local_unknown_integral_type
+      {
+        using local_limb_type      = typename std::iterator_traits<InputIteratorLeft>::value_type;
+        using left_difference_type = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+
+        local_unsigned_conversion_type u = 0U;
+
+        for(unsinged_fast_type i = 0U; i < limb_count; ++i)
+        {
+          u =
+            local_unsigned_conversion_type
+            (
+                u
+              | local_unsigned_conversion_type(local_unsigned_conversion_type(*(p_limb + left_difference_type(i))) << unsigned(std::numeric_limits<local_limb_type>::digits * int(i)))
+            );
+        }
+
+        return local_unknown_integral_type(u);
+      }
+    };
+
+    // Implement a function that extracts any built-in signed or unsigned integral type.
+    template<typename UnknownBuiltInIntegralType,
+             typename = typename std::enable_if<std::is_integral<UnknownBuiltInIntegralType>::value>::type>
+    WIDE_INTEGER_CONSTEXPR auto extract_builtin_integral_type() const -> UnknownBuiltInIntegralType
+    {
+      using local_unknown_integral_type = UnknownBuiltInIntegralType;
+      using digits_ratio_type           = digits_ratio<local_unknown_integral_type>;
+
+      const unsinged_fast_type ilim = (std::min)(unsinged_fast_type(digits_ratio_type::value),
+                                                 unsinged_fast_type(values.size()));
+
+      // Handle cases for which the input parameter is less wide
+      // or equally as wide as the limb width or wider than the limb width.
+      return ((digits_ratio_type::value < 2U)
+               ? static_cast<local_unknown_integral_type>(*values.cbegin())
+               : digits_ratio_type::extract(values.data(), ilim));
+    }
+
+    #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+    // Implement a function that extracts any built-in floating-point type.
+    template<typename FloatingPointType,
+             typename = typename std::enable_if<std::is_floating_point<FloatingPointType>::value>::type>
+    WIDE_INTEGER_CONSTEXPR auto extract_builtin_floating_point_type() const -> FloatingPointType
+    {
+      using local_unsigned_wide_integer_type = uintwide_t<Width2, limb_type, AllocatorType, false>;
+      using local_builtin_float_type         = FloatingPointType;
+
+      const bool u_is_neg = is_neg(*this);
+
+      const local_unsigned_wide_integer_type u((!u_is_neg) ? *this : -*this);
+
+      const auto my_msb = static_cast<size_t>(msb(u));
+      const auto ilim   = size_t
+                          (
+                             size_t(  size_t(my_msb + 1U) / size_t(std::numeric_limits<limb_type>::digits))
+                           + size_t(((size_t(my_msb + 1U) % size_t(std::numeric_limits<limb_type>::digits)) != 0U) ? size_t(1U) : size_t(0U))
+                          );
+
+      auto a = local_builtin_float_type(0.0F);
+
+      constexpr long double one_ldbl(1.0L);
+
+      long double ldexp_runner(one_ldbl);
+
+      for(auto i = size_t(0U); i < ilim; ++i)
+      {
+        auto ld      = static_cast<long double>(0.0L);
+        auto lm_mask = limb_type(1ULL);
+
+        for(auto j = size_t(0U); j < size_t(std::numeric_limits<limb_type>::digits); ++j)
+        {
+          if(limb_type(*(u.values.cbegin() + size_t(i)) & lm_mask) != limb_type(0U))
+          {
+            ld = static_cast<long double>(ld + ldexp_runner);
+          }
+
+          constexpr long double two_ldbl(2.0L);
+
+          lm_mask      = limb_type(lm_mask << 1U);
+          ldexp_runner = static_cast<long double>(ldexp_runner * two_ldbl);
+        }
+
+        a += static_cast<local_builtin_float_type>(ld);
+      }
+
+      return local_builtin_float_type((!u_is_neg) ? a : -a);
+    }
+    #endif
+
+    template<const size_t OtherWidth2>
+    static WIDE_INTEGER_CONSTEXPR void eval_mul_unary(      uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                                      const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
+                                                      typename std::enable_if<((OtherWidth2 / std::numeric_limits<LimbType>::digits) < number_of_limbs_karatsuba_threshold)>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
+    {
+      // Unary multiplication function using schoolbook multiplication,
+      // but we only need to retain the low half of the n*n algorithm.
+      // In other words, this is an n*n->n bit multiplication.
+
+      constexpr size_t local_number_of_limbs =
+        uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      detail::scratch_array<limb_type, number_of_limbs, AllocatorType> result { };
+
+      eval_multiply_n_by_n_to_lo_part(result.data(),
+                                      u.values.data(),
+                                      v.values.data(),
+                                      local_number_of_limbs);
+
+      std::copy(result.cbegin(),
+                result.cbegin() + local_number_of_limbs,
+                u.values.begin());
+    }
+
+    template<const size_t OtherWidth2>
+    static WIDE_INTEGER_CONSTEXPR void eval_mul_unary(      uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                                      const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
+                                                      typename std::enable_if<(   ((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_karatsuba_threshold)
+                                                                               && ((OtherWidth2 / std::numeric_limits<LimbType>::digits) <  number_of_limbs_toom3_threshold))>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
+    {
+      // Unary multiplication function using Karatsuba multiplication.
+
+      constexpr size_t local_number_of_limbs =
+        uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      using result_array_type =
+        detail::scratch_array<limb_type, number_of_limbs * 2U, AllocatorType>;
+
+      using storage_array_type =
+        detail::scratch_array<limb_type, number_of_limbs * 4U, AllocatorType>;
+
+      result_array_type  result;
+      storage_array_type t;
+
+      eval_multiply_kara_n_by_n_to_2n(result.data(),
+                                      u.values.data(),
+                                      v.values.data(),
+                                      local_number_of_limbs,
+                                      t.data());
+
+      std::copy(result.cbegin(),
+                result.cbegin() + local_number_of_limbs,
+                u.values.begin());
+    }
+
+    template<const size_t OtherWidth2>
+    static WIDE_INTEGER_CONSTEXPR void eval_mul_unary(      uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                                      const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
+                                                      typename std::enable_if<(   ((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_toom3_threshold)
+                                                                               && ((OtherWidth2 / std::numeric_limits<LimbType>::digits) <  number_of_limbs_ntt_threshold))>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
+    {
+      // Unary multiplication function using Toom-3 multiplication.
+
+      constexpr size_t local_number_of_limbs =
+        uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      using result_array_type =
+        detail::scratch_array<limb_type, number_of_limbs * 2U, AllocatorType>;
+
+      using storage_array_type =
+        detail::scratch_array<limb_type, eval_toom3_storage(number_of_limbs), AllocatorType>;
+
+      result_array_type  result;
+      storage_array_type t;
+
+      eval_multiply_toom3_n_by_n_to_2n(result.data(),
+                                       u.values.data(),
+                                       v.values.data(),
+                                       local_number_of_limbs,
+                                       t.data());
+
+      std::copy(result.cbegin(),
+                result.cbegin() + local_number_of_limbs,
+                u.values.begin());
+    }
+
+    template<const size_t OtherWidth2>
+    static WIDE_INTEGER_CONSTEXPR void eval_mul_unary(      uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                                      const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
+                                                      typename std::enable_if<((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_ntt_threshold)>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
+    {
+      // Unary multiplication function using the number-theoretic transform.
+
+      static_assert(eval_ntt_storage(number_of_limbs) <= size_t(UINT32_C(7) << 24U),
+                    "Error: The width exceeds the maximum length of the number-theoretic transform");
+
+      constexpr size_t local_number_of_limbs =
+        uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      using storage_array_type =
+        detail::large_scratch_array<std::uint32_t, eval_ntt_storage(number_of_limbs), AllocatorType>;
+
+      detail::scratch_array<limb_type, number_of_limbs, AllocatorType> result { };
+      storage_array_type  t;
+
+      eval_multiply_ntt_n_by_n_to_lo_part(result.data(),
+                                          u.values.data(),
+                                          v.values.data(),
+                                          local_number_of_limbs,
+                                          t.data(),
+                                          false);
+
+      std::copy(result.cbegin(),
+                result.cbegin() + local_number_of_limbs,
+                u.values.begin());
+    }
+
+    template<const size_t OtherWidth2>
+    static WIDE_INTEGER_CONSTEXPR void eval_sqr_unary(uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                                      typename std::enable_if<((OtherWidth2 / std::numeric_limits<LimbType>::digits) < number_of_limbs_karatsuba_threshold)>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
+    {
+      // Unary squaring function using schoolbook squaring,
+      // retaining only the low half of the n*n algorithm.
+
+      constexpr size_t local_number_of_limbs =
+        uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      detail::scratch_array<limb_type, number_of_limbs, AllocatorType> result { };
+
+      eval_square_n_to_lo_part(result.data(),
+                               u.values.data(),
+                               local_number_of_limbs);
+
+      std::copy(result.cbegin(),
+                result.cbegin() + local_number_of_limbs,
+                u.values.begin());
+    }
+
+    template<const size_t OtherWidth2>
+    static WIDE_INTEGER_CONSTEXPR void eval_sqr_unary(uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                                      typename std::enable_if<(   ((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_karatsuba_threshold)
+                                                                               && ((OtherWidth2 / std::numeric_limits<LimbType>::digits) <  number_of_limbs_toom3_threshold))>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
+    {
+      // Unary squaring function using Karatsuba squaring.
+
+      constexpr size_t local_number_of_limbs =
+        uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      using result_array_type =
+        detail::scratch_array<limb_type, number_of_limbs * 2U, AllocatorType>;
+
+      using storage_array_type =
+        detail::scratch_array<limb_type, number_of_limbs * 4U, AllocatorType>;
+
+      result_array_type  result;
+      storage_array_type t;
+
+      eval_square_kara_n_to_2n(result.data(),
+                               u.values.data(),
+                               local_number_of_limbs,
+                               t.data());
+
+      std::copy(result.cbegin(),
+                result.cbegin() + local_number_of_limbs,
+                u.values.begin());
+    }
+
+    template<const size_t OtherWidth2>
+    static WIDE_INTEGER_CONSTEXPR void eval_sqr_unary(uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                                      typename std::enable_if<(   ((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_toom3_threshold)
+                                                                               && ((OtherWidth2 / std::numeric_limits<LimbType>::digits) <  number_of_limbs_ntt_threshold))>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
+    {
+      // Unary squaring function using Toom-3 squaring.
+
+      constexpr size_t local_number_of_limbs =
+        uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      using result_array_type =
+        detail::scratch_array<limb_type, number_of_limbs * 2U, AllocatorType>;
+
+      using storage_array_type =
+        detail::scratch_array<limb_type, eval_toom3_storage(number_of_limbs), AllocatorType>;
+
+      result_array_type  result;
+      storage_array_type t;
+
+      eval_square_toom3_n_to_2n(result.data(),
+                                u.values.data(),
+                                local_number_of_limbs,
+                                t.data());
+
+      std::copy(result.cbegin(),
+                result.cbegin() + local_number_of_limbs,
+                u.values.begin());
+    }
+
+    template<const size_t OtherWidth2>
+    static WIDE_INTEGER_CONSTEXPR void eval_sqr_unary(uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                                      typename std::enable_if<((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_ntt_threshold)>::type* = nullptr) // NOLINT(hicpp-named-parameter,readability-named-parameter)
+    {
+      // Unary squaring function using the number-theoretic transform.
+
+      static_assert(eval_ntt_storage(number_of_limbs) <= size_t(UINT32_C(7) << 24U),
+                    "Error: The width exceeds the maximum length of the number-theoretic transform");
+
+      constexpr size_t local_number_of_limbs =
+        uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      using storage_array_type =
+        detail::large_scratch_array<std::uint32_t, eval_ntt_storage(number_of_limbs), AllocatorType>;
+
+      detail::scratch_array<limb_type, number_of_limbs, AllocatorType> result { };
+      storage_array_type  t;
+
+      eval_multiply_ntt_n_by_n_to_lo_part(result.data(),
+                                          u.values.data(),
+                                          u.values.data(),
+                                          local_number_of_limbs,
+                                          t.data(),
+                                          true);
+
+      std::copy(result.cbegin(),
+                result.cbegin() + local_number_of_limbs,
+                u.values.begin());
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight>
+    static WIDE_INTEGER_CONSTEXPR auto eval_add_n(      ResultIterator     r,
+                                                        InputIteratorLeft  u,
+                                                        InputIteratorRight v,
+                                                  const unsinged_fast_type count,
+                                                  const limb_type          carry_in = limb_type(0U)) -> limb_type
+    {
+      #if (WIDE_INTEGER_LIMB_KERNELS_ARE_ACTIVE == 1)
+      if(!detail::is_constant_evaluated())
+      {
+        limb_type carry_kernel = carry_in;
+
+        if(detail::limb_kernel_try_add_n(r, u, v, count, carry_kernel)) { return carry_kernel; }
+      }
+      #endif
+
+      auto carry_out = static_cast<std::uint_fast8_t>(carry_in);
+
+      static_assert
+      (
+           (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
+        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
+
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+      using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+
+      for(unsinged_fast_type i = 0U; i < count; ++i)
+      {
+        const auto uv_as_ularge =
+          local_double_limb_type(local_double_limb_type(local_double_limb_type(*(u + left_difference_type(i))) + *(v + right_difference_type(i))) + carry_out);
+
+        carry_out = static_cast<std::uint_fast8_t>(detail::make_hi<local_limb_type>(uv_as_ularge));
+
+        *(r + result_difference_type(i)) = static_cast<local_limb_type>(uv_as_ularge);
+      }
+
+      return static_cast<limb_type>(carry_out);
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight>
+    static WIDE_INTEGER_CONSTEXPR auto eval_subtract_n(      ResultIterator     r,
+                                                             InputIteratorLeft  u,
+                                                             InputIteratorRight v,
+                                                       const unsinged_fast_type count,
+                                                       const bool               has_borrow_in = false) -> bool
+    {
+      #if (WIDE_INTEGER_LIMB_KERNELS_ARE_ACTIVE == 1)
+      if(!detail::is_constant_evaluated())
+      {
+        bool has_borrow_kernel = has_borrow_in;
+
+        if(detail::limb_kernel_try_subtract_n(r, u, v, count, has_borrow_kernel)) { return has_borrow_kernel; }
+      }
+      #endif
+
+      std::uint_fast8_t has_borrow_out = (has_borrow_in ? 1U : 0U);
+
+      static_assert
+      (
+           (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
+        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
+
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+      using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+
+      for(unsinged_fast_type i = 0U; i < count; ++i)
+      {
+        const auto uv_as_ularge = local_double_limb_type(local_double_limb_type(local_double_limb_type(*(u + left_difference_type(i))) - *(v + right_difference_type(i))) - has_borrow_out);
+
+        has_borrow_out = (detail::make_hi<local_limb_type>(uv_as_ularge) != local_limb_type(0U)) ? 1U : 0U;
+
+        *(r + result_difference_type(i)) = local_limb_type(uv_as_ularge);
+      }
+
+      return (has_borrow_out != 0U);
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             const size_t RePhraseWidth2 = Width2,
+             typename std::enable_if<(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs == 4U)>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_lo_part(      ResultIterator     r,
+                                                                             InputIteratorLeft  a,
+                                                                             InputIteratorRight b,
+                                                                       const unsinged_fast_type count)
+    {
+      static_cast<void>(count);
+
+      static_assert
+      (
+           (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
+        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
+
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+      using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+
+      using result_value_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      // The algorithm has been derived from the polynomial multiplication.
+      // After the multiplication terms of equal order are grouped
+      // together and retained up to order(3). The carries from the
+      // multiplications are included when adding up the terms.
+      // The results of the intermediate multiplications are stored
+      // in local variables in memory.
+
+      //   Column[CoefficientList[Expand[(a0 + a1 x + a2 x^2 + a3 x^3) (b0 + b1 x + b2 x^2 + b3 x^3)], x]]
+      //   a0b0
+      //   a1b0 + a0b1
+      //   a2b0 + a1b1 + a0b2
+      //   a3b0 + a2b1 + a1b2 + a0b3
+
+      // See also Wolfram Alpha at:
+      // https://www.wolframalpha.com/input/?i=Column%5BCoefficientList%5B+++Expand%5B%28a0+%2B+a1+x+%2B+a2+x%5E2+%2B+a3+x%5E3%29+%28b0+%2B+b1+x+%2B+b2+x%5E2+%2B+b3+x%5E3%29%5D%2C++++x%5D%5D
+      // ... and take the upper half of the pyramid.
+
+      // Performance improvement:
+      //   (old) kops_per_sec: 33173.50
+      //   (new) kops_per_sec: 95069.43
+
+      local_double_limb_type r1;
+      local_double_limb_type r2;
+
+      const auto a0b0 = local_double_limb_type(*(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(0))));
+      const auto a0b1 = local_double_limb_type(*(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(1))));
+      const auto a1b0 = local_double_limb_type(*(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(0))));
+      const auto a1b1 = local_double_limb_type(*(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(1))));
+
+      // One special case is considered, the case of multiplication
+      // of the form BITS/2 * BITS/2 = BITS. In this case, the algorithm
+      // can be significantly simplified by using only the 'lower-halves'
+      // of the data.
+      if(    (*(a + left_difference_type(2)) == 0U) && (*(b + right_difference_type(2)) == 0U)
+          && (*(a + left_difference_type(3)) == 0U) && (*(b + right_difference_type(3)) == 0U))
+      {
+        r1    = local_double_limb_type
+                (
+                  local_double_limb_type
+                  (
+                    detail::make_hi<local_limb_type>(a0b0)
+                  )
+                  + detail::make_lo<local_limb_type>(a1b0)
+                  + detail::make_lo<local_limb_type>(a0b1)
+                )
+                ;
+        r2    = local_double_limb_type
+                (
+                  local_double_limb_type
+                  (
+                    detail::make_hi<local_limb_type>(r1)
+                  )
+                  + detail::make_lo<local_limb_type>(a1b1)
+                  + detail::make_hi<local_limb_type>(a0b1)
+                  + detail::make_hi<local_limb_type>(a1b0)
+                )
+                ;
+        *(r + result_difference_type(3))
+              = result_value_type
+                (
+                    detail::make_hi<local_limb_type>(r2)
+                  + detail::make_hi<local_limb_type>(a1b1)
+                )
+                ;
+      }
+      else
+      {
+        const auto a0b2 = local_double_limb_type(*(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(2))));
+        const auto a2b0 = local_double_limb_type(*(a + left_difference_type(2)) * local_double_limb_type(*(b + right_difference_type(0))));
+
+        r1    = local_double_limb_type
+                (
+                  local_double_limb_type
+                  (
+                    detail::make_hi<local_limb_type>(a0b0)
+                  )
+                  + detail::make_lo<local_limb_type>(a1b0)
+                  + detail::make_lo<local_limb_type>(a0b1)
+                )
+                ;
+        r2    = local_double_limb_type
+                (
+                  local_double_limb_type
+                  (
+                    detail::make_hi<local_limb_type>(r1)
+                  )
+                  + detail::make_lo<local_limb_type>(a2b0)
+                  + detail::make_lo<local_limb_type>(a1b1)
+                  + detail::make_lo<local_limb_type>(a0b2)
+                  + detail::make_hi<local_limb_type>(a1b0)
+                  + detail::make_hi<local_limb_type>(a0b1)
+                )
+                ;
+        *(r + result_difference_type(3))
+              = result_value_type
+                (
+                    detail::make_hi<local_limb_type>(r2)
+                  + static_cast<local_limb_type>    (*(a + left_difference_type(3)) * local_double_limb_type(*(b + right_difference_type(0))))
+                  + static_cast<local_limb_type>    (*(a + left_difference_type(2)) * local_double_limb_type(*(b + right_difference_type(1))))
+                  + static_cast<local_limb_type>    (*(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(2))))
+                  + static_cast<local_limb_type>    (*(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(3))))
+                  + detail::make_hi<local_limb_type>(a2b0)
+                  + detail::make_hi<local_limb_type>(a1b1)
+                  + detail::make_hi<local_limb_type>(a0b2)
+                )
+                ;
+      }
+
+      *(r + result_difference_type(0)) = local_limb_type(a0b0);
+      *(r + result_difference_type(1)) = local_limb_type(r1);
+      *(r + result_difference_type(2)) = local_limb_type(r2);
+    }
+
+    #if defined(WIDE_INTEGER_HAS_MUL_8_BY_8_UNROLL)
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             const size_t RePhraseWidth2 = Width2,
+             typename std::enable_if<(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs == size_t(UINT32_C(8)))>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_lo_part(      ResultIterator     r,
+                                                                             InputIteratorLeft  a,
+                                                                             InputIteratorRight b,
+                                                                       const unsinged_fast_type count)
+    {
+      static_cast<void>(count);
+
+      static_assert
+      (
+           (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
+        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
+
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+      using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+
+      // The algorithm has been derived from the polynomial multiplication.
+      // After the multiplication terms of equal order are grouped
+      // together and retained up to order(3). The carries from the
+      // multiplications are included when adding up the terms.
+      // The results of the intermediate multiplications are stored
+      // in local variables in memory.
+
+      //   Column[CoefficientList[Expand[(a0 + a1 x + a2 x^2 + a3 x^3 + a4 x^4 + a5 x^5 + a6 x^6 + a7 x^7) (b0 + b1 x + b2 x^2 + b3 x^3 + b4 x^4 + b5 x^5 + b6 x^6 + b7 x^7)], x]]
+      //   a0b0
+      //   a1b0 + a0b1
+      //   a2b0 + a1b1 + a0b2
+      //   a3b0 + a2b1 + a1b2 + a0b3
+      //   a4b0 + a3b1 + a2b2 + a1b3 + a0b4
+      //   a5b0 + a4b1 + a3b2 + a2b3 + a1b4 + a0b5
+      //   a6b0 + a5b1 + a4b2 + a3b3 + a2b4 + a1b5 + a0b6
+      //   a7b0 + a6b1 + a5b2 + a4b3 + a3b4 + a2b5 + a1b6 + a0b7
+
+      // See also Wolfram Alpha at:
+      // https://www.wolframalpha.com/input/?i=Column%5BCoefficientList%5B+++Expand%5B%28a0+%2B+a1+x+%2B+a2+x%5E2+%2B+a3+x%5E3%29+%28b0+%2B+b1+x+%2B+b2+x%5E2+%2B+b3+x%5E3%29%5D%2C++++x%5D%5D
+      // ... and take the upper half of the pyramid.
+
+      const local_double_limb_type a0b0 = *(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(0)));
+
+      const local_double_limb_type a1b0 = *(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(0)));
+      const local_double_limb_type a0b1 = *(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(1)));
+
+      const local_double_limb_type a2b0 = *(a + left_difference_type(2)) * local_double_limb_type(*(b + right_difference_type(0)));
+      const local_double_limb_type a1b1 = *(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(1)));
+      const local_double_limb_type a0b2 = *(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(2)));
+
+      const local_double_limb_type a3b0 = *(a + left_difference_type(3)) * local_double_limb_type(*(b + right_difference_type(0)));
+      const local_double_limb_type a2b1 = *(a + left_difference_type(2)) * local_double_limb_type(*(b + right_difference_type(1)));
+      const local_double_limb_type a1b2 = *(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(2)));
+      const local_double_limb_type a0b3 = *(a + left_difference_type(0)) * local_double_limb_type(*(b + right_difference_type(3)));
+
+      const local_double_limb_type a3b1 = *(a + left_difference_type(3)) * local_double_limb_type(*(b + right_difference_type(1)));
+      const local_double_limb_type a2b2 = *(a + left_difference_type(2)) * local_double_limb_type(*(b + right_difference_type(2)));
+      const local_double_limb_type a1b3 = *(a + left_difference_type(1)) * local_double_limb_type(*(b + right_difference_type(3)));
+
+      const local_double_limb_type a3b2 = *(a + left_difference_type(3)) * local_double_limb_type(*(b + right_difference_type(2)));
+      const local_double_limb_type a2b3 = *(a + left_difference_type(2)) * local_double_limb_type(*(b + right_difference_type(3)));
+
+      const local_double_limb_type a3b3 = *(a + left_difference_type(3)) * local_double_limb_type(*(b + right_difference_type(3)));
+
+            local_double_limb_type rd1;
+            local_double_limb_type rd2;
+            local_double_limb_type rd3;
+            local_double_limb_type rd4;
+            local_double_limb_type rd5;
+            local_double_limb_type rd6;
+
+      // One special case is considered, the case of multiplication
+      // of the form BITS/2 * BITS/2 = BITS. In this case, the algorithm
+      // can be significantly simplified by using only the 'lower-halves'
+      // of the data.
+      if(    (*(a + left_difference_type(INT32_C(7))) == 0U) && (*(b + right_difference_type(INT32_C(7))) == 0U)
+          && (*(a + left_difference_type(INT32_C(6))) == 0U) && (*(b + right_difference_type(INT32_C(6))) == 0U)
+          && (*(a + left_difference_type(INT32_C(5))) == 0U) && (*(b + right_difference_type(INT32_C(5))) == 0U)
+          && (*(a + left_difference_type(INT32_C(4))) == 0U) && (*(b + right_difference_type(INT32_C(4))) == 0U))
+      {
+        rd1   = local_double_limb_type
+                (
+                  detail::make_hi<local_limb_type>(a0b0)
+                )
+                + detail::make_lo<local_limb_type>(a1b0)
+                + detail::make_lo<local_limb_type>(a0b1)
+                ;
+
+        rd2   = local_double_limb_type
+                (
+                  detail::make_hi<local_limb_type>(rd1)
+                )
+                + detail::make_lo<local_limb_type>(a2b0)
+                + detail::make_lo<local_limb_type>(a1b1)
+                + detail::make_lo<local_limb_type>(a0b2)
+                + detail::make_hi<local_limb_type>(a1b0)
+                + detail::make_hi<local_limb_type>(a0b1)
+                ;
+
+        rd3   = local_double_limb_type
+                (
+                  detail::make_hi<local_limb_type>(rd2)
+                )
+                + detail::make_lo<local_limb_type>(a3b0)
+                + detail::make_lo<local_limb_type>(a2b1)
+                + detail::make_lo<local_limb_type>(a1b2)
+                + detail::make_lo<local_limb_type>(a0b3)
+                + detail::make_hi<local_limb_type>(a2b0)
+                + detail::make_hi<local_limb_type>(a1b1)
+                + detail::make_hi<local_limb_type>(a0b2)
+                ;
+
+        rd4   = local_double_limb_type
+                (
+                  detail::make_hi<local_limb_type>(rd3)
+                )
+                + detail::make_lo<local_limb_type>(a3b1)
+                + detail::make_lo<local_limb_type>(a2b2)
+                + detail::make_lo<local_limb_type>(a1b3)
+                + detail::make_hi<local_limb_type>(a3b0)
+                + detail::make_hi<local_limb_type>(a2b1)
+                + detail::make_hi<local_limb_type>(a1b2)
+                + detail::make_hi<local_limb_type>(a0b3)
+                ;
+
+        rd5   = local_double_limb_type
+                (
+                  detail::make_hi<local_limb_type>(rd4)
+                )
+                + detail::make_lo<local_limb_type>(a3b2)
+                + detail::make_lo<local_limb_type>(a2b3)
+                + detail::make_hi<local_limb_type>(a3b1)
+                + detail::make_hi<local_limb_type>(a2b2)
+                + detail::make_hi<local_limb_type>(a1b3)
+                ;
+
+        rd6   = local_double_limb_type
+                (
+                  detail::make_hi<local_limb_type>(rd5)
+                )
+                + detail::make_lo<local_limb_type>(a3b3)
+                + detail::make_hi<local_limb_type>(a3b2)
+                + detail::make_hi<local_limb_type>(a2b3)
+                ;
+
+        *(r + result_difference_type(INT32_C(7)))
+              = local_limb_type
+                (
+                    detail::make_hi<local_limb_type>(rd6)
+                  + detail::make_hi<local_limb_type>(a3b3)
+                )
+                ;
+      }
+      else
+      {
+        const local_double_limb_type a4b0 = *(a + left_difference_type(INT32_C(4))) * local_double_limb_type(*(b + right_difference_type(INT32_C(0))));
+        const local_double_limb_type a0b4 = *(a + left_difference_type(INT32_C(0))) * local_double_limb_type(*(b + right_difference_type(INT32_C(4))));
+
+        const local_double_limb_type a5b0 = *(a + left_difference_type(INT32_C(5))) * local_double_limb_type(*(b + right_difference_type(INT32_C(0))));
+        const local_double_limb_type a4b1 = *(a + left_difference_type(INT32_C(4))) * local_double_limb_type(*(b + right_difference_type(INT32_C(1))));
+
+        const local_double_limb_type a1b4 = *(a + left_difference_type(INT32_C(1))) * local_double_limb_type(*(b + right_difference_type(INT32_C(4))));
+        const local_double_limb_type a0b5 = *(a + left_difference_type(INT32_C(0))) * local_double_limb_type(*(b + right_difference_type(INT32_C(5))));
+
+        const local_double_limb_type a6b0 = *(a + left_difference_type(INT32_C(6))) * local_double_limb_type(*(b + right_difference_type(INT32_C(0))));
+        const local_double_limb_type a5b1 = *(a + left_difference_type(INT32_C(5))) * local_double_limb_type(*(b + right_difference_type(INT32_C(1))));
+
+        const local_double_limb_type a4b2 = *(a + left_difference_type(INT32_C(4))) * local_double_limb_type(*(b + right_difference_type(INT32_C(2))));
+        const local_double_limb_type a2b4 = *(a + left_difference_type(INT32_C(2))) * local_double_limb_type(*(b + right_difference_type(INT32_C(4))));
+
+        const local_double_limb_type a1b5 = *(a + left_difference_type(INT32_C(1))) * local_double_limb_type(*(b + right_difference_type(INT32_C(5))));
+        const local_double_limb_type a0b6 = *(a + left_difference_type(INT32_C(0))) * local_double_limb_type(*(b + right_difference_type(INT32_C(6))));
+
+        rd1   = local_double_limb_type
+                (
+                  detail::make_hi<local_limb_type>(a0b0)
+                )
+                + detail::make_lo<local_limb_type>(a1b0)
+                + detail::make_lo<local_limb_type>(a0b1)
+                ;
+
+        rd2   = local_double_limb_type
+                (
+                  detail::make_hi<local_limb_type>(rd1)
+                )
+                + detail::make_lo<local_limb_type>(a2b0)
+                + detail::make_lo<local_limb_type>(a1b1)
+                + detail::make_lo<local_limb_type>(a0b2)
+                + detail::make_hi<local_limb_type>(a1b0)
+                + detail::make_hi<local_limb_type>(a0b1)
+                ;
+
+        rd3   = local_double_limb_type
+                (
+                  detail::make_hi<local_limb_type>(rd2)
+                )
+                + detail::make_lo<local_limb_type>(a3b0)
+                + detail::make_lo<local_limb_type>(a2b1)
+                + detail::make_lo<local_limb_type>(a1b2)
+                + detail::make_lo<local_limb_type>(a0b3)
+                + detail::make_hi<local_limb_type>(a2b0)
+                + detail::make_hi<local_limb_type>(a1b1)
+                + detail::make_hi<local_limb_type>(a0b2)
+                ;
+
+        rd4   = local_double_limb_type
+                (
+                  detail::make_hi<local_limb_type>(rd3)
+                )
+                + detail::make_lo<local_limb_type>(a4b0)
+                + detail::make_lo<local_limb_type>(a3b1)
+                + detail::make_lo<local_limb_type>(a2b2)
+                + detail::make_lo<local_limb_type>(a1b3)
+                + detail::make_lo<local_limb_type>(a0b4)
+                + detail::make_hi<local_limb_type>(a3b0)
+                + detail::make_hi<local_limb_type>(a2b1)
+                + detail::make_hi<local_limb_type>(a1b2)
+                + detail::make_hi<local_limb_type>(a0b3)
+                ;
+
+        rd5   = local_double_limb_type
+                (
+                  detail::make_hi<local_limb_type>(rd4)
+                )
+                + detail::make_lo<local_limb_type>(a5b0)
+                + detail::make_lo<local_limb_type>(a4b1)
+                + detail::make_lo<local_limb_type>(a3b2)
+                + detail::make_lo<local_limb_type>(a2b3)
+                + detail::make_lo<local_limb_type>(a1b4)
+                + detail::make_lo<local_limb_type>(a0b5)
+                + detail::make_hi<local_limb_type>(a4b0)
+                + detail::make_hi<local_limb_type>(a3b1)
+                + detail::make_hi<local_limb_type>(a2b2)
+                + detail::make_hi<local_limb_type>(a1b3)
+                + detail::make_hi<local_limb_type>(a0b4)
+                ;
+
+        rd6   = local_double_limb_type
+                (
+                  detail::make_hi<local_limb_type>(rd5)
+                )
+                + detail::make_lo<local_limb_type>(a6b0)
+                + detail::make_lo<local_limb_type>(a5b1)
+                + detail::make_lo<local_limb_type>(a4b2)
+                + detail::make_lo<local_limb_type>(a3b3)
+                + detail::make_lo<local_limb_type>(a2b4)
+                + detail::make_lo<local_limb_type>(a1b5)
+                + detail::make_lo<local_limb_type>(a0b6)
+                + detail::make_hi<local_limb_type>(a5b0)
+                + detail::make_hi<local_limb_type>(a4b1)
+                + detail::make_hi<local_limb_type>(a3b2)
+                + detail::make_hi<local_limb_type>(a2b3)
+                + detail::make_hi<local_limb_type>(a1b4)
+                + detail::make_hi<local_limb_type>(a0b5)
+                ;
+
+        *(r + result_difference_type(INT32_C(7)))
+              = local_limb_type
+                (
+                    detail::make_hi<local_limb_type>(rd6)
+                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(7))) * local_double_limb_type(*(b + right_difference_type(INT32_C(0)))))
+                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(6))) * local_double_limb_type(*(b + right_difference_type(INT32_C(1)))))
+                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(5))) * local_double_limb_type(*(b + right_difference_type(INT32_C(2)))))
+                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(4))) * local_double_limb_type(*(b + right_difference_type(INT32_C(3)))))
+                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(3))) * local_double_limb_type(*(b + right_difference_type(INT32_C(4)))))
+                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(2))) * local_double_limb_type(*(b + right_difference_type(INT32_C(5)))))
+                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(1))) * local_double_limb_type(*(b + right_difference_type(INT32_C(6)))))
+                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(0))) * local_double_limb_type(*(b + right_difference_type(INT32_C(7)))))
+                  + detail::make_hi<local_limb_type>(a6b0)
+                  + detail::make_hi<local_limb_type>(a5b1)
+                  + detail::make_hi<local_limb_type>(a4b2)
+                  + detail::make_hi<local_limb_type>(a3b3)
+                  + detail::make_hi<local_limb_type>(a2b4)
+                  + detail::make_hi<local_limb_type>(a1b5)
+                  + detail::make_hi<local_limb_type>(a0b6)
+                )
+                ;
+      }
+
+      *(r + result_difference_type(INT32_C(0))) = static_cast<local_limb_type>(a0b0);
+      *(r + result_difference_type(INT32_C(1))) = static_cast<local_limb_type>(rd1);
+      *(r + result_difference_type(INT32_C(2))) = static_cast<local_limb_type>(rd2);
+      *(r + result_difference_type(INT32_C(3))) = static_cast<local_limb_type>(rd3);
+      *(r + result_difference_type(INT32_C(4))) = static_cast<local_limb_type>(rd4);
+      *(r + result_difference_type(INT32_C(5))) = static_cast<local_limb_type>(rd5);
+      *(r + result_difference_type(INT32_C(6))) = static_cast<local_limb_type>(rd6);
+    }
+    #endif
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             const size_t RePhraseWidth2 = Width2,
+             typename std::enable_if<(   (uintwide_t<RePhraseWidth2, LimbType, AllocatorType>::number_of_limbs != size_t(UINT32_C(4)))
+    #if defined(WIDE_INTEGER_HAS_MUL_8_BY_8_UNROLL)
+                                      && (uintwide_t<RePhraseWidth2, LimbType, AllocatorType>::number_of_limbs != size_t(UINT32_C(8)))
+    #endif
+                                     )>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_lo_part(      ResultIterator     r,
+                                                                             InputIteratorLeft  a,
+                                                                             InputIteratorRight b,
+                                                                       const unsinged_fast_type count)
+    {
+      static_assert
+      (
+           (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
+        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
+
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+      using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+
+      #if (WIDE_INTEGER_LIMB_KERNELS_ARE_ACTIVE == 1)
+      if((!detail::is_constant_evaluated()) && detail::limb_kernel_try_multiply_n_by_n(r, a, b, count, false)) { return; }
+      #endif
+
+      std::fill_n(r, count, local_limb_type(0U));
+
+      for(unsinged_fast_type i = 0U; i < count; ++i)
+      {
+        if(*(a + left_difference_type(i)) != local_limb_type(0U))
+        {
+          local_double_limb_type carry = 0U;
+
+          for(unsinged_fast_type j = 0U; j < unsinged_fast_type(count - i); ++j)
+          {
+            carry = local_double_limb_type(carry + local_double_limb_type(local_double_limb_type(*(a + left_difference_type(i))) * *(b + right_difference_type(j))));
+            carry = local_double_limb_type(carry + *(r + result_difference_type(i + j)));
+
+            *(r + result_difference_type(i + j)) = local_limb_type(carry);
+            carry                                = detail::make_hi<local_limb_type>(carry);
+          }
+        }
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight>
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_2n(      ResultIterator     r,
+                                                                        InputIteratorLeft  a,
+                                                                        InputIteratorRight b,
+                                                                  const unsinged_fast_type count)
+    {
+      static_assert
+      (
+           (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
+        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
+
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+      using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+
+      #if (WIDE_INTEGER_LIMB_KERNELS_ARE_ACTIVE == 1)
+      if((!detail::is_constant_evaluated()) && detail::limb_kernel_try_multiply_n_by_n(r, a, b, count, true)) { return; }
+      #endif
+
+      std::fill_n(r, (count * 2U), local_limb_type(0U));
+
+      for(unsinged_fast_type i = 0U; i < count; ++i)
+      {
+        if(*(a + left_difference_type(i)) != local_limb_type(0U))
+        {
+          unsinged_fast_type j = 0U;
+
+          local_double_limb_type carry = 0U;
+
+          for( ; j < count; ++j)
+          {
+            carry    = local_double_limb_type(carry + local_double_limb_type(local_double_limb_type(*(a + left_difference_type(i))) * *(b + right_difference_type(j))));
+            carry    = local_double_limb_type(carry + *(r + result_difference_type(i + j)));
+
+            *(r + result_difference_type(i + j)) = local_limb_type(carry);
+            carry                                = detail::make_hi<local_limb_type>(carry);
+          }
+
+          *(r + result_difference_type(i + j)) = local_limb_type(carry);
+        }
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             const size_t RePhraseWidth2 = Width2,
+             typename std::enable_if<(   (uintwide_t<RePhraseWidth2, LimbType, AllocatorType>::number_of_limbs == size_t(UINT32_C(4)))
+    #if defined(WIDE_INTEGER_HAS_MUL_8_BY_8_UNROLL)
+                                      || (uintwide_t<RePhraseWidth2, LimbType, AllocatorType>::number_of_limbs == size_t(UINT32_C(8)))
+    #endif
+                                     )>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR void eval_square_n_to_lo_part(      ResultIterator     r,
+                                                                      InputIteratorLeft  a,
+                                                                const unsinged_fast_type count)
+    {
+      // The unrolled multiplication kernels are already faster
+      // than a looped square for these small limb counts.
+      eval_multiply_n_by_n_to_lo_part(r, a, a, count);
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             const size_t RePhraseWidth2 = Width2,
+             typename std::enable_if<(   (uintwide_t<RePhraseWidth2, LimbType, AllocatorType>::number_of_limbs != size_t(UINT32_C(4)))
+    #if defined(WIDE_INTEGER_HAS_MUL_8_BY_8_UNROLL)
+                                      && (uintwide_t<RePhraseWidth2, LimbType, AllocatorType>::number_of_limbs != size_t(UINT32_C(8)))
+    #endif
+                                     )>::type const* = nullptr>
+    static WIDE_INTEGER_CONSTEXPR void eval_square_n_to_lo_part(      ResultIterator     r,
+                                                                      InputIteratorLeft  a,
+                                                                const unsinged_fast_type count)
+    {
+      static_assert
+      (
+        (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
+
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+
+      // Schoolbook squaring retaining only the low half of the result.
+      // Each cross product a_i * a_j with i < j is computed once,
+      // the sum of the cross products is doubled and the squares
+      // of the diagonal terms a_i * a_i are added afterwards.
+
+      #if (WIDE_INTEGER_LIMB_KERNELS_ARE_ACTIVE == 1)
+      if((!detail::is_constant_evaluated()) && detail::limb_kernel_try_square_n_cross_products(r, a, count, false))
+      {
+        eval_square_double_and_add_diagonal(r, a, count);
+
+        return;
+      }
+      #endif
+
+      std::fill_n(r, count, local_limb_type(0U));
+
+      for(unsinged_fast_type i = 0U; i < count; ++i)
+      {
+        if(*(a + left_difference_type(i)) != local_limb_type(0U))
+        {
+          local_double_limb_type carry = 0U;
+
+          for(unsinged_fast_type j = unsinged_fast_type(i + 1U); unsinged_fast_type(i + j) < count; ++j)
+          {
+            carry = local_double_limb_type(carry + local_double_limb_type(local_double_limb_type(*(a + left_difference_type(i))) * *(a + left_difference_type(j))));
+            carry = local_double_limb_type(carry + *(r + result_difference_type(i + j)));
+
+            *(r + result_difference_type(i + j)) = local_limb_type(carry);
+            carry                                = detail::make_hi<local_limb_type>(carry);
+          }
+        }
+      }
+
+      eval_square_double_and_add_diagonal(r, a, count);
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft>
+    static WIDE_INTEGER_CONSTEXPR void eval_square_n_to_2n(      ResultIterator     r,
+                                                                 InputIteratorLeft  a,
+                                                           const unsinged_fast_type count)
+    {
+      static_assert
+      (
+        (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
+
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+
+      // Schoolbook squaring with the full 2n result.
+      // This requires roughly half of the limb multiplications
+      // needed by the general n*n->2n schoolbook multiplication.
+
+      #if (WIDE_INTEGER_LIMB_KERNELS_ARE_ACTIVE == 1)
+      if((!detail::is_constant_evaluated()) && detail::limb_kernel_try_square_n_cross_products(r, a, count, true))
+      {
+        eval_square_double_and_add_diagonal(r, a, unsinged_fast_type(count * 2U));
+
+        return;
+      }
+      #endif
+
+      std::fill_n(r, (count * 2U), local_limb_type(0U));
+
+      for(unsinged_fast_type i = 0U; i < count; ++i)
+      {
+        if(*(a + left_difference_type(i)) != local_limb_type(0U))
+        {
+          unsinged_fast_type j = unsinged_fast_type(i + 1U);
+
+          local_double_limb_type carry = 0U;
+
+          for( ; j < count; ++j)
+          {
+            carry = local_double_limb_type(carry + local_double_limb_type(local_double_limb_type(*(a + left_difference_type(i))) * *(a + left_difference_type(j))));
+            carry = local_double_limb_type(carry + *(r + result_difference_type(i + j)));
+
+            *(r + result_difference_type(i + j)) = local_limb_type(carry);
+            carry                                = detail::make_hi<local_limb_type>(carry);
+          }
+
+          *(r + result_difference_type(i + j)) = local_limb_type(carry);
+        }
+      }
+
+      eval_square_double_and_add_diagonal(r, a, unsinged_fast_type(count * 2U));
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft>
+    static WIDE_INTEGER_CONSTEXPR void eval_square_double_and_add_diagonal(      ResultIterator     r,
+                                                                                 InputIteratorLeft  a,
+                                                                           const unsinged_fast_type count_r)
+    {
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+
+      // Double the sum of the cross products held in the lowest
+      // count_r limbs of r, then add the diagonal squares a_i * a_i
+      // at the even limb positions. Anything above count_r is discarded.
+
+      local_limb_type carry_bit = 0U;
+
+      for(unsinged_fast_type i = 0U; i < count_r; ++i)
+      {
+        const local_limb_type ri = *(r + result_difference_type(i));
+
+        *(r + result_difference_type(i)) = local_limb_type(local_limb_type(ri << 1U) | carry_bit);
+
+        carry_bit = local_limb_type(ri >> unsigned(std::numeric_limits<local_limb_type>::digits - 1));
+      }
+
+      local_double_limb_type carry = 0U;
+
+      for(unsinged_fast_type i = 0U; unsinged_fast_type(i * 2U) < count_r; ++i)
+      {
+        const auto ai_squared =
+          local_double_limb_type(local_double_limb_type(*(a + left_difference_type(i))) * *(a + left_difference_type(i)));
+
+        carry = local_double_limb_type(carry + local_limb_type(ai_squared));
+        carry = local_double_limb_type(carry + *(r + result_difference_type(i * 2U)));
+
+        *(r + result_difference_type(i * 2U)) = local_limb_type(carry);
+        carry                                 = detail::make_hi<local_limb_type>(carry);
+
+        if(unsinged_fast_type(unsinged_fast_type(i * 2U) + 1U) < count_r)
+        {
+          carry = local_double_limb_type(carry + detail::make_hi<local_limb_type>(ai_squared));
+          carry = local_double_limb_type(carry + *(r + result_difference_type((i * 2U) + 1U)));
+
+          *(r + result_difference_type((i * 2U) + 1U)) = local_limb_type(carry);
+          carry                                         = detail::make_hi<local_limb_type>(carry);
+        }
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft>
+    static WIDE_INTEGER_CONSTEXPR auto eval_multiply_1d(      ResultIterator                                               r,
+                                                              InputIteratorLeft                                            a,
+                                                        const typename std::iterator_traits<InputIteratorLeft>::value_type b,
+                                                        const unsinged_fast_type                                           count) -> limb_type
+    {
+      static_assert
+      (
+        (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
+
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+
+      #if (WIDE_INTEGER_LIMB_KERNELS_ARE_ACTIVE == 1)
+      if(!detail::is_constant_evaluated())
+      {
+        local_limb_type carry_kernel { };
+
+        if(detail::limb_kernel_try_multiply_1d(r, a, b, count, carry_kernel)) { return carry_kernel; }
+      }
+      #endif
+
+      local_double_limb_type carry = 0U;
+
+      if(b == 0U)
+      {
+        std::fill(r, r + count, limb_type(0U));
+      }
+      else
+      {
+        for(unsinged_fast_type i = 0U ; i < count; ++i)
+        {
+          carry = local_double_limb_type(carry + local_double_limb_type(local_double_limb_type(*(a + left_difference_type(i))) * b));
+
+          *(r + result_difference_type(i)) = local_limb_type(carry);
+          carry                            = detail::make_hi<local_limb_type>(carry);
+        }
+      }
+
+      return local_limb_type(carry);
+    }
+
+    template<typename InputIteratorLeft>
+    static WIDE_INTEGER_CONSTEXPR
+    void eval_multiply_kara_propagate_carry(      InputIteratorLeft                                            t,
+                                            const unsinged_fast_type                                           n,
+                                            const typename std::iterator_traits<InputIteratorLeft>::value_type carry)
+    {
+      using local_limb_type = typename std::iterator_traits<InputIteratorLeft>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+
+      unsinged_fast_type i = 0U;
+
+      local_limb_type carry_out = carry;
+
+      while((i < n) && (carry_out != local_limb_type(0U)))
+      {
+        const local_double_limb_type uv_as_ularge = local_double_limb_type(*(t + left_difference_type(i))) + carry_out;
+
+        carry_out = detail::make_hi<local_limb_type>(uv_as_ularge);
+
+        *(t + left_difference_type(i)) = local_limb_type(uv_as_ularge);
+
+        ++i;
+      }
+    }
+
+    template<typename InputIteratorLeft>
+    static WIDE_INTEGER_CONSTEXPR
+    void eval_multiply_kara_propagate_borrow(      InputIteratorLeft  t,
+                                             const unsinged_fast_type n,
+                                             const bool               has_borrow)
+    {
+      using local_limb_type = typename std::iterator_traits<InputIteratorLeft>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+
+      unsinged_fast_type i = 0U;
+
+      bool has_borrow_out = has_borrow;
+
+      while((i < n) && (has_borrow_out))
+      {
+        auto uv_as_ularge = local_double_limb_type(*(t + left_difference_type(i)));
+
+        if(has_borrow_out)
+        {
+          --uv_as_ularge;
+        }
+
+        has_borrow_out = (detail::make_hi<local_limb_type>(uv_as_ularge) != local_limb_type(0U));
+
+        *(t + left_difference_type(i)) = local_limb_type(uv_as_ularge);
+
+        ++i;
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static WIDE_INTEGER_CONSTEXPR
+    void eval_multiply_kara_n_by_n_to_2n(      ResultIterator     r, // NOLINT(misc-no-recursion)
+                                         const InputIteratorLeft  a,
+                                         const InputIteratorRight b,
+                                         const unsinged_fast_type n,
+                                               InputIteratorTemp  t)
+    {
+      // Odd limb counts can not be split into equal halves
+      // and are also handled by the schoolbook algorithm.
+      if((n <= unsinged_fast_type(number_of_limbs_karatsuba_base)) || ((n % 2U) != 0U))
+      {
+        static_cast<void>(t);
+
+        eval_multiply_n_by_n_to_2n(r, a, b, n);
+      }
+      else
+      {
+        static_assert
+        (
+             (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
+          && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits)
+          && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorTemp>::value_type>::digits),
+          "Error: Internals require same widths for left-right-result limb_types at the moment"
+        );
+
+        using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+        using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+        using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+        using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+        using temp_difference_type   = typename std::iterator_traits<InputIteratorTemp>::difference_type;
+
+        // Based on "Algorithm 1.3 KaratsubaMultiply", Sect. 1.3.2, page 5
+        // of R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic",
+        // Cambridge University Press (2011).
+
+        // The Karatsuba multipliation computes the product of u*v as:
+        // [b^N + b^(N/2)] a1*b1 + [b^(N/2)](a1 - a0)(b0 - b1) + [b^(N/2) + 1] a0*b0
+
+        // Here we visualize u and v in two components 0,1 corresponding
+        // to the high and low order parts, respectively.
+
+        // Step 1
+        // Calculate a1*b1 and store it in the upper part of r.
+        // Calculate a0*b0 and store it in the lower part of r.
+        // copy r to t0.
+
+        // Step 2
+        // Add a1*b1 (which is t2) to the middle two-quarters of r (which is r1)
+        // Add a0*b0 (which is t0) to the middle two-quarters of r (which is r1)
+
+        // Step 3
+        // Calculate |a1-a0| in t0 and note the sign (i.e., the borrow flag)
+
+        // Step 4
+        // Calculate |b0-b1| in t1 and note the sign (i.e., the borrow flag)
+
+        // Step 5
+        // Call kara mul to calculate |a1-a0|*|b0-b1| in (t2),
+        // while using temporary storage in t4 along the way.
+
+        // Step 6
+        // Check the borrow signs. If a1-a0 and b0-b1 have the same signs,
+        // then add |a1-a0|*|b0-b1| to r1, otherwise subtract it from r1.
+
+        const unsinged_fast_type  nh = n / 2U;
+
+        const InputIteratorLeft   a0 = a + left_difference_type(0);
+        const InputIteratorLeft   a1 = a + left_difference_type(nh);
+
+        const InputIteratorRight  b0 = b + right_difference_type(0);
+        const InputIteratorRight  b1 = b + right_difference_type(nh);
+
+              ResultIterator      r0 = r + result_difference_type(0);
+              ResultIterator      r1 = r + result_difference_type(nh);
+              ResultIterator      r2 = r + result_difference_type(n);
+              ResultIterator      r3 = r + result_difference_type(n + nh);
+
+              InputIteratorTemp   t0 = t + temp_difference_type(0);
+              InputIteratorTemp   t1 = t + temp_difference_type(nh);
+              InputIteratorTemp   t2 = t + temp_difference_type(n);
+              InputIteratorTemp   t4 = t + temp_difference_type(n + n);
+
+        // Step 1
+        //   a1*b1 -> r2
+        //   a0*b0 -> r0
+        //   r -> t0
+        eval_multiply_kara_n_by_n_to_2n(r2, a1, b1, nh, t0);
+        eval_multiply_kara_n_by_n_to_2n(r0, a0, b0, nh, t0);
+        std::copy(r0, r0 + (2U * n), t0);
+
+        local_limb_type carry;
+
+        // Step 2
+        //   r1 += a1*b1
+        //   r1 += a0*b0
+        carry = eval_add_n(r1, r1, t2, n);
+        eval_multiply_kara_propagate_carry(r3, nh, carry);
+        carry = eval_add_n(r1, r1, t0, n);
+        eval_multiply_kara_propagate_carry(r3, nh, carry);
+
+        // Step 3
+        //   |a1-a0| -> t0
+        const std::int_fast8_t cmp_result_a1a0 = compare_ranges(a1, a0, nh);
+
+        if(cmp_result_a1a0 == 1)
+        {
+          static_cast<void>(eval_subtract_n(t0, a1, a0, nh));
+        }
+        else if(cmp_result_a1a0 == -1)
+        {
+          static_cast<void>(eval_subtract_n(t0, a0, a1, nh));
+        }
+
+        // Step 4
+        //   |b0-b1| -> t1
+        const std::int_fast8_t cmp_result_b0b1 = compare_ranges(b0, b1, nh);
+
+        if(cmp_result_b0b1 == 1)
+        {
+          static_cast<void>(eval_subtract_n(t1, b0, b1, nh));
+        }
+        else if(cmp_result_b0b1 == -1)
+        {
+          static_cast<void>(eval_subtract_n(t1, b1, b0, nh));
+        }
+
+        // Step 5
+        //   |a1-a0|*|b0-b1| -> t2
+        eval_multiply_kara_n_by_n_to_2n(t2, t0, t1, nh, t4);
+
+        // Step 6
+        //   either r1 += |a1-a0|*|b0-b1|
+        //   or     r1 -= |a1-a0|*|b0-b1|
+        if((cmp_result_a1a0 * cmp_result_b0b1) == 1)
+        {
+          carry = eval_add_n(r1, r1, t2, n);
+
+          eval_multiply_kara_propagate_carry(r3, nh, carry);
+        }
+        else if((cmp_result_a1a0 * cmp_result_b0b1) == -1)
+        {
+          const bool has_borrow = eval_subtract_n(r1, r1, t2, n);
+
+          eval_multiply_kara_propagate_borrow(r3, nh, has_borrow);
+        }
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorTemp>
+    static WIDE_INTEGER_CONSTEXPR
+    void eval_square_kara_n_to_2n(      ResultIterator     r, // NOLINT(misc-no-recursion)
+                                  const InputIteratorLeft  a,
+                                  const unsinged_fast_type n,
+                                        InputIteratorTemp  t)
+    {
+      // Odd limb counts can not be split into equal halves
+      // and are also handled by the schoolbook algorithm.
+      if((n <= unsinged_fast_type(number_of_limbs_karatsuba_base)) || ((n % 2U) != 0U))
+      {
+        static_cast<void>(t);
+
+        eval_square_n_to_2n(r, a, n);
+      }
+      else
+      {
+        static_assert
+        (
+             (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
+          && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorTemp>::value_type>::digits),
+          "Error: Internals require same widths for left-right-result limb_types at the moment"
+        );
+
+        using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+        using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+        using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+        using temp_difference_type   = typename std::iterator_traits<InputIteratorTemp>::difference_type;
+
+        // This is the Karatsuba multiplication from above with b = a.
+        // The middle term (a1 - a0)(b0 - b1) becomes -(a1 - a0)^2,
+        // so only one recursive square |a1 - a0|^2 is needed and
+        // it is always subtracted. This requires no sign bookkeeping.
+        //   a^2 = [b^N + b^(N/2)] a1^2 - [b^(N/2)] (a1 - a0)^2 + [b^(N/2) + 1] a0^2
+
+        const unsinged_fast_type  nh = n / 2U;
+
+        const InputIteratorLeft   a0 = a + left_difference_type(0);
+        const InputIteratorLeft   a1 = a + left_difference_type(nh);
+
+              ResultIterator      r0 = r + result_difference_type(0);
+              ResultIterator      r1 = r + result_difference_type(nh);
+              ResultIterator      r2 = r + result_difference_type(n);
+              ResultIterator      r3 = r + result_difference_type(n + nh);
+
+              InputIteratorTemp   t0 = t + temp_difference_type(0);
+              InputIteratorTemp   t2 = t + temp_difference_type(n);
+              InputIteratorTemp   t4 = t + temp_difference_type(n + n);
+
+        // Step 1
+        //   a1^2 -> r2
+        //   a0^2 -> r0
+        //   r -> t0
+        eval_square_kara_n_to_2n(r2, a1, nh, t0);
+        eval_square_kara_n_to_2n(r0, a0, nh, t0);
+        std::copy(r0, r0 + (2U * n), t0);
+
+        local_limb_type carry;
+
+        // Step 2
+        //   r1 += a1^2
+        //   r1 += a0^2
+        carry = eval_add_n(r1, r1, t2, n);
+        eval_multiply_kara_propagate_carry(r3, nh, carry);
+        carry = eval_add_n(r1, r1, t0, n);
+        eval_multiply_kara_propagate_carry(r3, nh, carry);
+
+        // Step 3
+        //   |a1-a0| -> t0
+        const std::int_fast8_t cmp_result_a1a0 = compare_ranges(a1, a0, nh);
+
+        if(cmp_result_a1a0 != 0)
+        {
+          if(cmp_result_a1a0 == 1)
+          {
+            static_cast<void>(eval_subtract_n(t0, a1, a0, nh));
+          }
+          else
+          {
+            static_cast<void>(eval_subtract_n(t0, a0, a1, nh));
+          }
+
+          // Step 4
+          //   |a1-a0|^2 -> t2
+          //   r1 -= |a1-a0|^2
+          eval_square_kara_n_to_2n(t2, t0, nh, t4);
+
+          const bool has_borrow = eval_subtract_n(r1, r1, t2, n);
+
+          eval_multiply_kara_propagate_borrow(r3, nh, has_borrow);
+        }
+      }
+    }
+
+    static constexpr auto eval_toom3_split_round(const size_t k, const size_t p) -> size_t // NOLINT(misc-no-recursion)
+    {
+      // Round k up to c * 2^j with c <= number_of_limbs_karatsuba_base, so that
+      // the Karatsuba recursion on k limbs always splits into equal halves.
+      return ((size_t(k + size_t(p - 1U)) / p) <= number_of_limbs_karatsuba_base)
+               ? size_t(size_t(size_t(k + size_t(p - 1U)) / p) * p)
+               : eval_toom3_split_round(k, size_t(p * 2U));
+    }
+
+    static constexpr auto eval_toom3_split(const size_t n) -> size_t
+    {
+      // The number of limbs in each of the lower two parts of a Toom-3 split.
+      // The rounding is dropped if it would leave no limbs for the upper part.
+      return (size_t(eval_toom3_split_round(size_t(size_t(n + 2U) / 3U), size_t(1U)) * 2U) < n)
+               ? eval_toom3_split_round(size_t(size_t(n + 2U) / 3U), size_t(1U))
+               : size_t(size_t(n + 2U) / 3U);
+    }
+
+    static constexpr auto eval_toom3_storage(const size_t n) -> size_t // NOLINT(misc-no-recursion)
+    {
+      // The number of limbs of temporary storage needed by the Toom-3
+      // multiplication of n limbs, including that of all recursion levels.
+      return (n < number_of_limbs_toom3_threshold)
+               ? size_t(n * 4U)
+               : size_t(size_t(size_t(eval_toom3_split(n) * 20U) + 18U) + eval_toom3_storage(eval_toom3_split(n)));
+    }
+
+    static constexpr auto eval_ntt_storage(const size_t n) -> size_t
+    {
+      // The number of 32-bit values of temporary storage needed by the
+      // NTT multiplication of n limbs. These are the transforms of the
+      // first operand modulo both primes, the transform of the second
+      // operand and the twiddle factors.
+      return size_t(size_t(detail::ntt_length(size_t(size_t(size_t(size_t(n * size_t(std::numeric_limits<limb_type>::digits)) + 15U) / 16U) * 2U)) * 7U) / 2U);
+    }
+
+    template<typename InputIteratorLeft>
+    static WIDE_INTEGER_CONSTEXPR void eval_toom3_shr1(      InputIteratorLeft  w,
+                                                       const unsinged_fast_type count)
+    {
+      using local_limb_type = typename std::iterator_traits<InputIteratorLeft>::value_type;
+
+      using left_difference_type = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+
+      local_limb_type carry_bit = 0U;
+
+      for(auto i = count; i > 0U; --i)
+      {
+        const local_limb_type wi = *(w + left_difference_type(i - 1U));
+
+        *(w + left_difference_type(i - 1U)) =
+          local_limb_type(local_limb_type(wi >> 1U) | local_limb_type(carry_bit << unsigned(std::numeric_limits<local_limb_type>::digits - 1)));
+
+        carry_bit = local_limb_type(wi & 1U);
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft>
+    static WIDE_INTEGER_CONSTEXPR void eval_toom3_shl(      ResultIterator     r,
+                                                            InputIteratorLeft  w,
+                                                      const unsinged_fast_type count,
+                                                      const unsigned           bits)
+    {
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+
+      local_limb_type carry_bits = 0U;
+
+      for(unsinged_fast_type i = 0U; i < count; ++i)
+      {
+        const local_limb_type wi = *(w + left_difference_type(i));
+
+        *(r + result_difference_type(i)) = local_limb_type(local_limb_type(wi << bits) | carry_bits);
+
+        carry_bits = local_limb_type(wi >> unsigned(unsigned(std::numeric_limits<local_limb_type>::digits) - bits));
+      }
+    }
+
+    template<typename InputIteratorLeft>
+    static WIDE_INTEGER_CONSTEXPR void eval_toom3_div3(      InputIteratorLeft  w,
+                                                       const unsinged_fast_type count)
+    {
+      // Exact division by three, running from the most significant limb.
+
+      using local_limb_type = typename std::iterator_traits<InputIteratorLeft>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using left_difference_type = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+
+      local_limb_type remainder = 0U;
+
+      for(auto i = count; i > 0U; --i)
+      {
+        const auto numerator =
+          local_double_limb_type(local_double_limb_type(local_double_limb_type(remainder) << unsigned(std::numeric_limits<local_limb_type>::digits)) | *(w + left_difference_type(i - 1U)));
+
+        *(w + left_difference_type(i - 1U)) = local_limb_type(numerator / 3U);
+
+        remainder = local_limb_type(numerator % 3U);
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft>
+    static WIDE_INTEGER_CONSTEXPR void eval_toom3_add_mul_1d(      ResultIterator                                            r,
+                                                                   InputIteratorLeft                                         a,
+                                                             const typename std::iterator_traits<ResultIterator>::value_type v,
+                                                             const unsinged_fast_type                                        count)
+    {
+      // r += a * v, where a has count limbs. The carry is propagated
+      // upward in r, which is known to be long enough to hold it.
+
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+
+      local_double_limb_type carry = 0U;
+
+      unsinged_fast_type i = 0U;
+
+      for( ; i < count; ++i)
+      {
+        carry = local_double_limb_type(carry + local_double_limb_type(local_double_limb_type(*(a + left_difference_type(i))) * v));
+        carry = local_double_limb_type(carry + *(r + result_difference_type(i)));
+
+        *(r + result_difference_type(i)) = local_limb_type(carry);
+        carry                            = detail::make_hi<local_limb_type>(carry);
+      }
+
+      for( ; carry != 0U; ++i)
+      {
+        carry = local_double_limb_type(carry + *(r + result_difference_type(i)));
+
+        *(r + result_difference_type(i)) = local_limb_type(carry);
+        carry                            = detail::make_hi<local_limb_type>(carry);
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft>
+    static WIDE_INTEGER_CONSTEXPR void eval_toom3_accumulate(      ResultIterator     r,
+                                                           const unsinged_fast_type r_count,
+                                                           const unsinged_fast_type offset,
+                                                                 InputIteratorLeft  w,
+                                                           const unsinged_fast_type w_count)
+    {
+      // r += w * b^offset, where r has r_count limbs. Limbs of w
+      // reaching beyond r are known to be zero and are skipped.
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+
+      const auto count = (std::min)(w_count, unsinged_fast_type(r_count - offset));
+
+      const auto carry = eval_add_n(r + result_difference_type(offset),
+                                    r + result_difference_type(offset),
+                                    w,
+                                    count);
+
+      eval_multiply_kara_propagate_carry(r + result_difference_type(offset + count),
+                                         unsinged_fast_type(r_count - unsinged_fast_type(offset + count)),
+                                         carry);
+    }
+
+    template<typename InputIteratorLeft,
+             typename InputIteratorTemp>
+    static WIDE_INTEGER_CONSTEXPR auto eval_toom3_evaluate(const InputIteratorLeft  x,
+                                                           const unsinged_fast_type n,
+                                                           const unsinged_fast_type k,
+                                                                 InputIteratorTemp  x2,
+                                                                 InputIteratorTemp  e1,
+                                                                 InputIteratorTemp  em1,
+                                                                 InputIteratorTemp  e2) -> bool
+    {
+      // Evaluate x = x0 + x1 y + x2 y^2 with y = b^k at the points
+      // y = 1, -1 and 2. Each of the values has (k + 1) limbs.
+      // The magnitude of x(-1) is stored and its sign is returned.
+
+      using local_limb_type = typename std::iterator_traits<InputIteratorTemp>::value_type;
+
+      using left_difference_type = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+      using temp_difference_type = typename std::iterator_traits<InputIteratorTemp>::difference_type;
+
+      const InputIteratorLeft x0 = x;
+      const InputIteratorLeft x1 = x + left_difference_type(k);
+
+      // Copy x2 and pad it with zeros to k limbs.
+      std::copy(x + left_difference_type(2U * k), x + left_difference_type(n), x2);
+      std::fill(x2 + temp_difference_type(n - (2U * k)), x2 + temp_difference_type(k), local_limb_type(0U));
+
+      // x0 + x2 -> em1
+      // x0 + x1 + x2 -> e1
+      *(em1 + temp_difference_type(k)) = eval_add_n(em1, x0, x2, k);
+      *(e1  + temp_difference_type(k)) = local_limb_type(*(em1 + temp_difference_type(k)) + eval_add_n(e1, em1, x1, k));
+
+      // x0 + 2 (x1 + 2 x2) -> e2
+      *(e2 + temp_difference_type(k)) = eval_add_n(e2, x2, x2, k);
+      *(e2 + temp_difference_type(k)) = local_limb_type(*(e2 + temp_difference_type(k)) + eval_add_n(e2, e2, x1, k));
+      static_cast<void>(eval_add_n(e2, e2, e2, unsinged_fast_type(k + 1U)));
+      *(e2 + temp_difference_type(k)) = local_limb_type(*(e2 + temp_difference_type(k)) + eval_add_n(e2, e2, x0, k));
+
+      // |x0 - x1 + x2| -> em1
+      bool is_neg = false;
+
+      if(   (*(em1 + temp_difference_type(k)) != 0U)
+         || (compare_ranges(em1, x1, k) >= 0))
+      {
+        const bool has_borrow = eval_subtract_n(em1, em1, x1, k);
+
+        *(em1 + temp_difference_type(k)) = local_limb_type(*(em1 + temp_difference_type(k)) - (has_borrow ? 1U : 0U));
+      }
+      else
+      {
+        static_cast<void>(eval_subtract_n(em1, x1, em1, k));
+
+        is_neg = true;
+      }
+
+      return is_neg;
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static WIDE_INTEGER_CONSTEXPR
+    void eval_toom3_sub_product(      ResultIterator     r, // NOLINT(misc-no-recursion)
+                                const InputIteratorLeft  a,
+                                const InputIteratorRight b,
+                                const unsinged_fast_type n,
+                                      InputIteratorTemp  t,
+                                const bool               is_square)
+    {
+      if(n >= unsinged_fast_type(number_of_limbs_toom3_threshold))
+      {
+        eval_toom3_n_by_n_to_2n(r, a, b, n, t, is_square);
+      }
+      else if(is_square)
+      {
+        eval_square_kara_n_to_2n(r, a, n, t);
+      }
+      else
+      {
+        eval_multiply_kara_n_by_n_to_2n(r, a, b, n, t);
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorTemp>
+    static WIDE_INTEGER_CONSTEXPR
+    void eval_toom3_point_product(      ResultIterator     r, // NOLINT(misc-no-recursion)
+                                  const InputIteratorTemp  x,
+                                  const InputIteratorTemp  y,
+                                  const unsinged_fast_type k,
+                                        InputIteratorTemp  t,
+                                  const bool               is_square)
+    {
+      // Multiply the (k + 1)-limb point values x and y, whose upper limbs
+      // are small, giving (2k + 2) limbs. Only the lower k limbs enter the
+      // recursion. The upper limbs are handled with limb multiplications.
+
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using temp_difference_type   = typename std::iterator_traits<InputIteratorTemp>::difference_type;
+
+      eval_toom3_sub_product(r, x, y, k, t, is_square);
+
+      *(r + result_difference_type(2U * k))        = local_limb_type(0U);
+      *(r + result_difference_type((2U * k) + 1U)) = local_limb_type(0U);
+
+      const local_limb_type xh = *(x + temp_difference_type(k));
+      const local_limb_type yh = *(y + temp_difference_type(k));
+
+      if(xh != 0U) { eval_toom3_add_mul_1d(r + result_difference_type(k), y, xh, k); }
+      if(yh != 0U) { eval_toom3_add_mul_1d(r + result_difference_type(k), x, yh, k); }
+
+      const auto xh_yh =
+        local_double_limb_type(local_double_limb_type(local_double_limb_type(xh) * yh) + *(r + result_difference_type(2U * k)));
+
+      *(r + result_difference_type(2U * k))        = local_limb_type(xh_yh);
+      *(r + result_difference_type((2U * k) + 1U)) = local_limb_type(*(r + result_difference_type((2U * k) + 1U)) + detail::make_hi<local_limb_type>(xh_yh));
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static WIDE_INTEGER_CONSTEXPR
+    void eval_toom3_n_by_n_to_2n(      ResultIterator     r, // NOLINT(misc-no-recursion)
+                                 const InputIteratorLeft  a,
+                                 const InputIteratorRight b,
+                                 const unsinged_fast_type n,
+                                       InputIteratorTemp  t,
+                                 const bool               is_square)
+    {
+      static_assert
+      (
+           (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
+        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits)
+        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorTemp>::value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
+
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using temp_difference_type   = typename std::iterator_traits<InputIteratorTemp>::difference_type;
+
+      // Based on "Algorithm 1.4 ToomCook3", Sect. 1.3.3, page 7
+      // of R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic",
+      // Cambridge University Press (2011), here with the evaluation
+      // points 0, 1, -1, 2 and infinity.
+
+      // Split a = a0 + a1 y + a2 y^2 (likewise b) with y = b^k,
+      // where a2 has (n - 2k) limbs. The product has the coefficients
+      // r0...r4, which are recovered from the five point products
+      //   w0 = r(0), w1 = r(1), w2 = r(-1), w3 = r(2) and w4 = r(infinity).
+      // All of the coefficients are non-negative, which allows for the
+      // interpolation to be carried out with unsigned arithmetic,
+      // with only the sign of r(-1) needing to be tracked.
+
+      const auto k = unsinged_fast_type(eval_toom3_split(size_t(n)));
+      const auto l = unsinged_fast_type((2U * k) + 2U);
+
+      InputIteratorTemp a2   = t    + temp_difference_type(0);
+      InputIteratorTemp b2   = a2   + temp_difference_type(k);
+      InputIteratorTemp ea1  = b2   + temp_difference_type(k);
+      InputIteratorTemp eam1 = ea1  + temp_difference_type(k + 1U);
+      InputIteratorTemp ea2  = eam1 + temp_difference_type(k + 1U);
+      InputIteratorTemp eb1  = ea2  + temp_difference_type(k + 1U);
+      InputIteratorTemp ebm1 = eb1  + temp_difference_type(k + 1U);
+      InputIteratorTemp eb2  = ebm1 + temp_difference_type(k + 1U);
+      InputIteratorTemp w0   = eb2  + temp_difference_type(k + 1U);
+      InputIteratorTemp w1   = w0   + temp_difference_type(l);
+      InputIteratorTemp w2   = w1   + temp_difference_type(l);
+      InputIteratorTemp w3   = w2   + temp_difference_type(l);
+      InputIteratorTemp w4   = w3   + temp_difference_type(l);
+      InputIteratorTemp wt   = w4   + temp_difference_type(l);
+      InputIteratorTemp tn   = wt   + temp_difference_type(l);
+
+      // Evaluation.
+      const bool a_is_neg = eval_toom3_evaluate(a, n, k, a2, ea1, eam1, ea2);
+            bool b_is_neg = a_is_neg;
+
+      if(is_square)
+      {
+        b2   = a2;
+        eb1  = ea1;
+        ebm1 = eam1;
+        eb2  = ea2;
+      }
+      else
+      {
+        b_is_neg = eval_toom3_evaluate(b, n, k, b2, eb1, ebm1, eb2);
+      }
+
+      // Pointwise multiplication.
+      eval_toom3_sub_product(w0, a, b, k, tn, is_square);
+      eval_toom3_sub_product(w4, a2, b2, k, tn, is_square);
+
+      std::fill(w0 + temp_difference_type(2U * k), w0 + temp_difference_type(l), local_limb_type(0U));
+      std::fill(w4 + temp_difference_type(2U * k), w4 + temp_difference_type(l), local_limb_type(0U));
+
+      eval_toom3_point_product(w1, ea1,  eb1,  k, tn, is_square);
+      eval_toom3_point_product(w2, eam1, ebm1, k, tn, is_square);
+      eval_toom3_point_product(w3, ea2,  eb2,  k, tn, is_square);
+
+      // Interpolation.
+      //   w2 = (w1 - r(-1)) / 2 = r1 + r3
+      //   w1 = (w1 + r(-1)) / 2 - r0 - r4 = r2
+      if(a_is_neg != b_is_neg)
+      {
+        static_cast<void>(eval_add_n(w2, w1, w2, l));
+      }
+      else
+      {
+        static_cast<void>(eval_subtract_n(w2, w1, w2, l));
+      }
+
+      static_cast<void>(eval_add_n(w1, w1, w1, l));
+      static_cast<void>(eval_subtract_n(w1, w1, w2, l));
+
+      eval_toom3_shr1(w2, l);
+      eval_toom3_shr1(w1, l);
+
+      static_cast<void>(eval_subtract_n(w1, w1, w0, l));
+      static_cast<void>(eval_subtract_n(w1, w1, w4, l));
+
+      //   w3 = ((r(2) - r0 - 16 r4 - 4 r2) / 2 - (r1 + r3)) / 3 = r3
+      //   w2 = (r1 + r3) - r3 = r1
+      static_cast<void>(eval_subtract_n(w3, w3, w0, l));
+      eval_toom3_shl(wt, w4, l, 4U);
+      static_cast<void>(eval_subtract_n(w3, w3, wt, l));
+      eval_toom3_shl(wt, w1, l, 2U);
+      static_cast<void>(eval_subtract_n(w3, w3, wt, l));
+
+      eval_toom3_shr1(w3, l);
+
+      static_cast<void>(eval_subtract_n(w3, w3, w2, l));
+
+      eval_toom3_div3(w3, l);
+
+      static_cast<void>(eval_subtract_n(w2, w2, w3, l));
+
+      // Recomposition.
+      std::copy(w0, w0 + temp_difference_type(2U * k), r);
+      std::fill(r + result_difference_type(2U * k), r + result_difference_type(2U * n), local_limb_type(0U));
+
+      eval_toom3_accumulate(r, unsinged_fast_type(2U * n), unsinged_fast_type(1U * k), w2, l);
+      eval_toom3_accumulate(r, unsinged_fast_type(2U * n), unsinged_fast_type(2U * k), w1, l);
+      eval_toom3_accumulate(r, unsinged_fast_type(2U * n), unsinged_fast_type(3U * k), w3, l);
+      eval_toom3_accumulate(r, unsinged_fast_type(2U * n), unsinged_fast_type(4U * k), w4, l);
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static WIDE_INTEGER_CONSTEXPR
+    void eval_multiply_toom3_n_by_n_to_2n(      ResultIterator     r,
+                                          const InputIteratorLeft  a,
+                                          const InputIteratorRight b,
+                                          const unsinged_fast_type n,
+                                                InputIteratorTemp  t)
+    {
+      eval_toom3_n_by_n_to_2n(r, a, b, n, t, false);
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorTemp>
+    static WIDE_INTEGER_CONSTEXPR
+    void eval_square_toom3_n_to_2n(      ResultIterator     r,
+                                   const InputIteratorLeft  a,
+                                   const unsinged_fast_type n,
+                                         InputIteratorTemp  t)
+    {
+      eval_toom3_n_by_n_to_2n(r, a, a, n, t, true);
+    }
+
+    template<typename ValueIterator,
+             typename InputIteratorLeft>
+    static WIDE_INTEGER_CONSTEXPR void eval_ntt_load(      ValueIterator      f,
+                                                           InputIteratorLeft  x,
+                                                     const unsinged_fast_type count,
+                                                     const size_t             len)
+    {
+      // Split the limbs of x into 16-bit digits, padded with zeros to len.
+
+      using local_limb_type = typename std::iterator_traits<InputIteratorLeft>::value_type;
+
+      using value_difference_type = typename std::iterator_traits<ValueIterator>::difference_type;
+      using left_difference_type  = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+
+      size_t        i        = 0U;
+      std::uint64_t acc      = 0U;
+      unsigned      acc_bits = 0U;
+
+      for(unsinged_fast_type j = 0U; j < count; ++j)
+      {
+        acc      = std::uint64_t(acc | std::uint64_t(std::uint64_t(*(x + left_difference_type(j))) << acc_bits));
+        acc_bits = unsigned(acc_bits + unsigned(std::numeric_limits<local_limb_type>::digits));
+
+        while(acc_bits >= 16U)
+        {
+          *(f + value_difference_type(i)) = std::uint32_t(acc & UINT32_C(0xFFFF));
+
+          ++i;
+
+          acc      = std::uint64_t(acc >> 16U);
+          acc_bits = unsigned(acc_bits - 16U);
+        }
+      }
+
+      if(acc_bits != 0U)
+      {
+        *(f + value_difference_type(i)) = std::uint32_t(acc);
+
+        ++i;
+      }
+
+      std::fill(f + value_difference_type(i), f + value_difference_type(len), std::uint32_t(0U));
+    }
+
+    template<typename NttPrimeType,
+             typename ValueIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight>
+    static WIDE_INTEGER_CONSTEXPR void eval_ntt_convolve(      ValueIterator      f,
+                                                               ValueIterator      g,
+                                                               ValueIterator      w,
+                                                               InputIteratorLeft  a,
+                                                         const unsinged_fast_type na,
+                                                               InputIteratorRight b,
+                                                         const unsinged_fast_type nb,
+                                                         const size_t             len,
+                                                         const bool               is_square)
+    {
+      // Cyclic convolution of the digits of a and b modulo one prime, in f.
+
+      using value_difference_type = typename std::iterator_traits<ValueIterator>::difference_type;
+
+      NttPrimeType::twiddles(w, len);
+
+      eval_ntt_load(f, a, na, len);
+
+      NttPrimeType::transform(f, w, len, false);
+
+      if(is_square)
+      {
+        for(size_t i = 0U; i < len; ++i)
+        {
+          *(f + value_difference_type(i)) = NttPrimeType::mul(*(f + value_difference_type(i)), *(f + value_difference_type(i)));
+        }
+      }
+      else
+      {
+        eval_ntt_load(g, b, nb, len);
+
+        NttPrimeType::transform(g, w, len, false);
+
+        for(size_t i = 0U; i < len; ++i)
+        {
+          *(f + value_difference_type(i)) = NttPrimeType::mul(*(f + value_difference_type(i)), *(g + value_difference_type(i)));
+        }
+      }
+
+      NttPrimeType::transform(f, w, len, true);
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename ValueIterator>
+    static WIDE_INTEGER_CONSTEXPR void eval_multiply_ntt_n_by_n_to_lo_part(      ResultIterator     r,
+                                                                                 InputIteratorLeft  a,
+                                                                                 InputIteratorRight b,
+                                                                           const unsinged_fast_type count,
+                                                                                 ValueIterator      t,
+                                                                           const bool               is_square)
+    {
+      // Multiplication via number-theoretic transform, retaining only
+      // the low count limbs of the result. The operands are split into
+      // 16-bit digits and convolved modulo two primes (see detail::ntt_prime_0
+      // and detail::ntt_prime_1). The exact convolution is recovered with
+      // the Chinese remainder theorem (Garner's algorithm), since it is
+      // known to be smaller than the product of the primes. The temporary
+      // storage t must hold 7/2 * ntt_length(2 * digits) values.
+
+      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+
+      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
+      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+      using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+      using value_difference_type  = typename std::iterator_traits<ValueIterator>::difference_type;
+
+      constexpr auto limb_digits = unsigned(std::numeric_limits<local_limb_type>::digits);
+
+      // Strip leading zero limbs, which shortens the transform
+      // for operands that are small compared with the full width.
+      auto na = count;
+      auto nb = count;
+
+      while((na != 0U) && (*(a + left_difference_type (na - 1U)) == 0U)) { --na; }
+      while((nb != 0U) && (*(b + right_difference_type(nb - 1U)) == 0U)) { --nb; }
+
+      if((na == 0U) || (nb == 0U))
+      {
+        std::fill(r, r + result_difference_type(count), local_limb_type(0U));
+      }
+      else
+      {
+        const auto da = size_t(size_t(size_t(na * limb_digits) + 15U) / 16U);
+        const auto db = size_t(size_t(size_t(nb * limb_digits) + 15U) / 16U);
+
+        const size_t n_coefficients = size_t(size_t(da + db) - 1U);
+
+        const size_t len = detail::ntt_length(n_coefficients);
+
+        const ValueIterator f0 = t;
+        const ValueIterator f1 = t + value_difference_type(len);
+        const ValueIterator g  = t + value_difference_type(len * 2U);
+        const ValueIterator w  = t + value_difference_type(len * 3U);
+
+        eval_ntt_convolve<detail::ntt_prime_0>(f0, g, w, a, na, b, nb, len, is_square);
+        eval_ntt_convolve<detail::ntt_prime_1>(f1, g, w, a, na, b, nb, len, is_square);
+
+        constexpr auto p0 = std::uint32_t(UINT32_C(469762049));
+
+        const std::uint32_t p0_inv = detail::ntt_prime_1::pow(std::uint32_t(p0 % UINT32_C(167772161)), std::uint32_t(UINT32_C(167772161) - 2U));
+
+        // Recombine the coefficients, propagate the carries
+        // and pack the 16-bit digits into limbs.
+        std::uint64_t carry    = 0U;
+        std::uint64_t acc      = 0U;
+        unsigned      acc_bits = 0U;
+
+        unsinged_fast_type j = 0U;
+
+        for(size_t i = 0U; j < count; ++i)
+        {
+          if(i < n_coefficients)
+          {
+            const std::uint32_t r0 = *(f0 + value_difference_type(i));
+            const std::uint32_t r1 = *(f1 + value_difference_type(i));
+
+            const std::uint32_t h =
+              detail::ntt_prime_1::mul(detail::ntt_prime_1::sub(r1, std::uint32_t(r0 % UINT32_C(167772161))), p0_inv);
+
+            carry = std::uint64_t(carry + std::uint64_t(r0 + std::uint64_t(std::uint64_t(p0) * h)));
+          }
+
+          acc      = std::uint64_t(acc | std::uint64_t(std::uint64_t(carry & UINT32_C(0xFFFF)) << acc_bits));
+          acc_bits = unsigned(acc_bits + 16U);
+          carry    = std::uint64_t(carry >> 16U);
+
+          while((acc_bits >= limb_digits) && (j < count))
+          {
+            *(r + result_difference_type(j)) = local_limb_type(acc);
+
+            ++j;
+
+            acc      = std::uint64_t(std::uint64_t(acc >> unsigned(limb_digits - 1U)) >> 1U);
+            acc_bits = unsigned(acc_bits - limb_digits);
+          }
+        }
+      }
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto leading_zero_limbs() const -> unsinged_fast_type
+    {
+      auto u_offset = unsinged_fast_type(0U);
+
+      while((u_offset < unsinged_fast_type(number_of_limbs)) && (*(values.cbegin() + size_t(unsinged_fast_type(number_of_limbs - 1U) - u_offset)) == limb_type(0U)))
+      {
+        ++u_offset;
+      }
+
+      return u_offset;
+    }
+
+    using wr_string_unsigned_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+
+    static constexpr auto wr_string_dec_dc_levels(const size_t n) -> size_t
+    {
+      // One more than ceil(log2(n)), the number of powers of ten
+      // 10^(digits10 * 2^k) needed to split a number having n limbs.
+      return (n <= 1U) ? size_t(1U) : size_t(1U + wr_string_dec_dc_levels(size_t((n + 1U) / 2U)));
+    }
+
+    static WIDE_INTEGER_CONSTEXPR auto wr_string_dec(wr_string_unsigned_type& t, char* p_end) -> unsinged_fast_type
+    {
+      // Write the decimal digits of the nonzero value t (which is destroyed)
+      // backwards, ending in front of p_end. Return the number of digits.
+
+      if(number_of_limbs < wr_string_dec_dc_threshold)
+      {
+        return wr_string_dec_chunked(t, p_end, 0U);
+      }
+
+      // Set up the table of the powers 10^(digits10 * 2^k). The last power
+      // is at least 2^(my_width2 / 2), so its square exceeds every value.
+      // The table is on the heap (or from the allocator), since it holds
+      // O(log(number_of_limbs)) full-width values.
+      using powers_array_type =
+        detail::fixed_dynamic_array<wr_string_unsigned_type,
+                                    wr_string_dec_dc_levels(number_of_limbs) + 1U,
+                                    typename std::allocator_traits<typename std::conditional<std::is_same<AllocatorType, void>::value,
+                                                                                             std::allocator<void>,
+                                                                                             AllocatorType>::type>::template rebind_alloc<wr_string_unsigned_type>>;
+
+      powers_array_type powers;
+
+      powers[0U] = dec_limb_pow10(std::numeric_limits<limb_type>::digits10);
+
+      const wr_string_unsigned_type half_width_power(wr_string_unsigned_type(1U) << (my_width2 / 2U));
+
+      auto level = static_cast<unsinged_fast_type>(0U);
+
+      while((powers[size_t(level)] < half_width_power) && (size_t(level + 1U) < powers.size()))
+      {
+        powers[size_t(level + 1U)] = powers[size_t(level)];
+
+        powers[size_t(level + 1U)] *= powers[size_t(level + 1U)];
+
+        ++level;
+      }
+
+      return wr_string_dec_recursive(t, p_end, 0U, powers.data(), level);
+    }
+
+    static WIDE_INTEGER_CONSTEXPR auto wr_string_dec_recursive(const wr_string_unsigned_type&  t,                  // NOLINT(misc-no-recursion)
+                                                                     char*                     p_end,
+                                                               const unsinged_fast_type        min_digits,
+                                                               const wr_string_unsigned_type*  p_powers,
+                                                               const unsinged_fast_type        level) -> unsinged_fast_type
+    {
+      // Here, t is less than the square of p_powers[level]. Split t
+      // into its high and low parts with respect to p_powers[level],
+      // write the low part with exactly (digits10 * 2^level) digits
+      // and the high part in front of it.
+
+      if((level == 0U) || ((size_t(2U) << level) <= wr_string_dec_dc_leaf_limbs))
+      {
+        wr_string_unsigned_type t_leaf(t);
+
+        return wr_string_dec_chunked(t_leaf, p_end, min_digits);
+      }
+
+      const wr_string_unsigned_type& p = *(p_powers + size_t(level)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      if(t < p)
+      {
+        return wr_string_dec_recursive(t, p_end, min_digits, p_powers, unsinged_fast_type(level - 1U));
+      }
+
+      wr_string_unsigned_type q(t);
+      wr_string_unsigned_type r;
+
+      q.eval_divmod(p, &r);
+
+      const auto digits_lo = static_cast<unsinged_fast_type>(static_cast<unsinged_fast_type>(std::numeric_limits<limb_type>::digits10) << level);
+
+      static_cast<void>(wr_string_dec_recursive(r, p_end, digits_lo, p_powers, unsinged_fast_type(level - 1U)));
+
+      const unsinged_fast_type digits_hi =
+        wr_string_dec_recursive(q,
+                                p_end - digits_lo, // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                                ((min_digits > digits_lo) ? unsinged_fast_type(min_digits - digits_lo) : unsinged_fast_type(0U)),
+                                p_powers,
+                                unsinged_fast_type(level - 1U));
+
+      return static_cast<unsinged_fast_type>(digits_lo + digits_hi);
+    }
+
+    static WIDE_INTEGER_CONSTEXPR auto dec_limb_pow10(const int k) -> limb_type
+    {
+      // The power of ten 10^k for 0 <= k <= digits10. The largest
+      // of these, 10^digits10, is the chunk size of decimal strings.
+      auto p10 = limb_type(1U);
+
+      for(auto i = static_cast<int>(INT8_C(0)); i < k; ++i)
+      {
+        p10 = static_cast<limb_type>(p10 * UINT8_C(10));
+      }
+
+      return p10;
+    }
+
+    static WIDE_INTEGER_CONSTEXPR auto wr_string_dec_chunked(wr_string_unsigned_type& t, char* p_end, const unsinged_fast_type min_digits) -> unsinged_fast_type
+    {
+      // Write the decimal digits of t (which is destroyed) backwards,
+      // ending in front of p_end and padded with leading zeros to at least
+      // min_digits. Each division yields a chunk of digits10 digits.
+
+      const limb_divisor<limb_type> chunk_divisor(dec_limb_pow10(std::numeric_limits<limb_type>::digits10));
+
+      auto u_offset = t.leading_zero_limbs();
+
+      auto count = static_cast<unsinged_fast_type>(0U);
+
+      char* p = p_end;
+
+      while(u_offset < unsinged_fast_type(number_of_limbs))
+      {
+        auto chunk = t.eval_divide_by_limb_divisor(chunk_divisor, u_offset);
+
+        while((u_offset < unsinged_fast_type(number_of_limbs)) && (*(t.values.cbegin() + size_t(unsinged_fast_type(number_of_limbs - 1U) - u_offset)) == limb_type(0U)))
+        {
+          ++u_offset;
+        }
+
+        const bool chunk_is_leading = (u_offset == unsinged_fast_type(number_of_limbs));
+
+        for(auto i = static_cast<int>(INT8_C(0)); (i < std::numeric_limits<limb_type>::digits10) && ((!chunk_is_leading) || (chunk != limb_type(0U))); ++i)
+        {
+          *(--p) = static_cast<char>(static_cast<limb_type>(chunk % UINT8_C(10)) + UINT8_C(0x30)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          chunk = static_cast<limb_type>(chunk / UINT8_C(10));
+
+          ++count;
+        }
+      }
+
+      while(count < min_digits)
+      {
+        *(--p) = char('0'); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        ++count;
+      }
+
+      return count;
+    }
+
+    WIDE_INTEGER_CONSTEXPR void eval_divide_knuth(const uintwide_t& other, // NOLINT(readability-function-cognitive-complexity)
+                                                        uintwide_t* remainder)
+    {
+      // Use Knuth's long division algorithm.
+      // The loop-ordering of indices in Knuth's original
+      // algorithm has been reversed due to the data format
+      // used here. Several optimizations and combinations
+      // of logic have been carried out in the source code.
+
+      // See also:
+      // D.E. Knuth, "The Art of Computer Programming, Volume 2:
+      // Seminumerical Algorithms", Addison-Wesley (1998),
+      // Section 4.3.1 Algorithm D and Exercise 16.
+
+      using local_uint_index_type = unsinged_fast_type;
+
+      auto u_offset = local_uint_index_type(0U);
+      auto v_offset = local_uint_index_type(0U);
+
+      // Compute the offsets for u and v.
+      for(auto i = local_uint_index_type(0U); (i < number_of_limbs) && (*(      values.cbegin() + size_t(local_uint_index_type(number_of_limbs - 1U) - i)) == limb_type(0U)); ++i) { ++u_offset; }
+      for(auto i = local_uint_index_type(0U); (i < number_of_limbs) && (*(other.values.cbegin() + size_t(local_uint_index_type(number_of_limbs - 1U) - i)) == limb_type(0U)); ++i) { ++v_offset; }
+
+      if(v_offset == local_uint_index_type(number_of_limbs))
+      {
+        // The denominator is zero. Set the maximum value and return.
+        // This also catches (0 / 0) and sets the maximum value for it.
+        operator=(limits_helper_max(IsSigned));
+
+        if(remainder != nullptr)
+        {
+          *remainder = uintwide_t(std::uint8_t(0U));
+        }
+      }
+      else if(u_offset == local_uint_index_type(number_of_limbs))
+      {
+        // The numerator is zero. Do nothing and return.
+
+        if(remainder != nullptr)
+        {
+          *remainder = uintwide_t(std::uint8_t(0U));
+        }
+      }
+      else
+      {
+        const auto result_of_compare_left_with_right = compare(other);
+
+        const bool left_is_less_than_right = (result_of_compare_left_with_right == INT8_C(-1));
+        const bool left_is_equal_to_right  = (result_of_compare_left_with_right == INT8_C( 0));
+
+        if(left_is_less_than_right)
+        {
+          // If the denominator is larger than the numerator,
+          // then the result of the division is zero.
+          if(remainder != nullptr)
+          {
+            *remainder = *this;
+          }
+
+          operator=(std::uint8_t(0U));
+        }
+        else if(left_is_equal_to_right)
+        {
+          // If the denominator is equal to the numerator,
+          // then the result of the division is one.
+          operator=(std::uint8_t(1U));
+
+          if(remainder != nullptr)
+          {
+            *remainder = uintwide_t(std::uint8_t(0U));
+          }
+        }
+        else if(v_offset == local_uint_index_type(number_of_limbs - 1U))
+        {
+          // The denominator has one single limb.
+          // Use a one-dimensional division algorithm.
+          const limb_type short_denominator = *other.values.cbegin();
+
+          eval_divide_by_single_limb(short_denominator, u_offset, remainder);
+        }
+        else
+        {
+          // We will now use the Knuth long division algorithm.
+
+          // Compute the normalization factor d.
+          const auto d =
+            limb_type(double_limb_type(  double_limb_type(double_limb_type(1U) << unsigned(std::numeric_limits<limb_type>::digits))
+                                       / double_limb_type(double_limb_type(*(other.values.cbegin() + size_t(local_uint_index_type(number_of_limbs - 1U) - v_offset))) + limb_type(1U))));
+
+          // Step D1(b), normalize u -> u * d = uu.
+          // Step D1(c): normalize v -> v * d = vv.
+
+          using uu_array_type =
+            detail::scratch_array<limb_type, number_of_limbs + 1U, AllocatorType>;
+
+          using vv_array_type =
+            detail::scratch_array<limb_type, number_of_limbs, AllocatorType>;
+
+          uu_array_type uu;
+          vv_array_type vv { };
+
+          if(d > limb_type(1U))
+          {
+            *(uu.begin() + size_t(local_uint_index_type(number_of_limbs) - u_offset)) =
+              eval_multiply_1d(uu.data(), values.data(), d, number_of_limbs - u_offset);
+
+            static_cast<void>(eval_multiply_1d(vv.data(), other.values.data(), d, number_of_limbs - v_offset));
+          }
+          else
+          {
+            std::copy(values.cbegin(), values.cend(), uu.begin());
+
+            *(uu.begin() + size_t(local_uint_index_type(number_of_limbs) - u_offset)) = limb_type(0U);
+
+            std::copy(other.values.cbegin(), other.values.cend(), vv.begin());
+          }
+
+          // Step D2: Initialize j.
+          // Step D7: Loop on j from m to 0.
+
+          const auto n   = local_uint_index_type(number_of_limbs - v_offset);
+          const auto m   = local_uint_index_type(number_of_limbs - u_offset) - n;
+          const auto vj0 = local_uint_index_type((number_of_limbs - 1U) - v_offset);
+
+          for(auto j = local_uint_index_type(0U); j <= m; ++j)
+          {
+            // Step D3 [Calculate q_hat].
+            //   if u[j] == v[j0]
+            //     set q_hat = b - 1
+            //   else
+            //     set q_hat = (u[j] * b + u[j + 1]) / v[1]
+
+            const auto uj     = local_uint_index_type(local_uint_index_type(local_uint_index_type(local_uint_index_type(number_of_limbs + 1U) - 1U) - u_offset) - j);
+            const auto u_j_j1 = double_limb_type(double_limb_type(double_limb_type(*(uu.cbegin() + size_t(uj))) << unsigned(std::numeric_limits<limb_type>::digits)) + *(uu.cbegin() + size_t(uj - 1U)));
+
+            limb_type q_hat = ((*(uu.cbegin() + size_t(uj)) == *(vv.cbegin() + size_t(vj0)))
+              ? (std::numeric_limits<limb_type>::max)()
+              : limb_type(u_j_j1 / *(vv.cbegin() + size_t(vj0))));
+
+            // Decrease q_hat if necessary.
+            // This means that q_hat must be decreased if the
+            // expression [(u[uj] * b + u[uj - 1] - q_hat * v[vj0 - 1]) * b]
+            // exceeds the range of uintwide_t.
+
+            for(auto t = double_limb_type(u_j_j1 - double_limb_type(q_hat * double_limb_type(*(vv.cbegin() + size_t(vj0))))); ; --q_hat, t = double_limb_type(t + *(vv.cbegin() + size_t(vj0))))
+            {
+              if(   (detail::make_hi<limb_type>(t) != limb_type(0U))
+                 || (   double_limb_type(double_limb_type(*(vv.cbegin() + size_t(vj0 - 1U))) * q_hat)
+                     <= double_limb_type(double_limb_type(t << unsigned(std::numeric_limits<limb_type>::digits)) + *(uu.cbegin() + size_t(uj - 2U)))))
+              {
+                break;
+              }
+            }
+
+            // Step D4: Multiply and subtract.
+            // Replace u[j, ... j + n] by u[j, ... j + n] - q_hat * v[1, ... n].
+
+            // Set nv = q_hat * (v[1, ... n]).
+            uu_array_type nv;
+
+            *(nv.begin() + size_t(n)) = eval_multiply_1d(nv.data(), vv.data(), q_hat, n);
+
+            const bool has_borrow =
+              eval_subtract_n(uu.data() + size_t(local_uint_index_type(uj - n)),
+                              uu.data() + size_t(local_uint_index_type(uj - n)),
+                              nv.data(),
+                              n + 1U);
+
+
+            // Get the result data.
+            *(values.begin() + size_t(m - j)) = limb_type(q_hat - (has_borrow ? 1U : 0U));
+
+            // Step D5: Test the remainder.
+            // Set the result value: Set result.m_data[m - j] = q_hat.
+            // Use the condition (u[j] < 0), in other words if the borrow
+            // is non-zero, then step D6 needs to be carried out.
+
+            if(has_borrow)
+            {
+              // Step D6: Add back.
+              // Add v[1, ... n] back to u[j, ... j + n],
+              // and decrease the result by 1.
+
+              static_cast<void>(eval_add_n(uu.data() + size_t(local_uint_index_type(uj - n)),
+                                           uu.data() + size_t(local_uint_index_type(uj - n)),
+                                           vv.data(),
+                                           n));
+            }
+          }
+
+          // Clear the data elements that have not
+          // been computed in the division algorithm.
+          std::fill(values.begin() + local_uint_index_type(m + 1U), values.end(), limb_type(0U));
+
+          if(remainder != nullptr)
+          {
+            if(d == 1U)
+            {
+              std::copy(uu.cbegin(),
+                        uu.cbegin() + size_t(local_uint_index_type(number_of_limbs - v_offset)),
+                        remainder->values.begin());
+            }
+            else
+            {
+              auto previous_u = limb_type(0U);
+
+              for(auto rl = singed_fast_type(n - 1U), ul = singed_fast_type(number_of_limbs - (v_offset + 1U)); rl >= 0; --rl, --ul)
+              {
+                const auto t =
+                  double_limb_type(  *(uu.cbegin() + size_t(ul))
+                                   + double_limb_type(double_limb_type(previous_u) << unsigned(std::numeric_limits<limb_type>::digits)));
+
+                *(remainder->values.begin() + size_t(rl)) = limb_type(double_limb_type(t / d));
+                previous_u                                = limb_type(double_limb_type(t - double_limb_type(double_limb_type(d) * *(remainder->values.cbegin() + size_t(rl)))));
+              }
+            }
+
+            std::fill(remainder->values.begin() + size_t(n),
+                      remainder->values.end(),
+                      limb_type(0U));
+          }
+        }
+      }
+    }
+
+    WIDE_INTEGER_CONSTEXPR void shl(const unsinged_fast_type offset,
+                                    const std::uint_fast16_t left_shift_amount)
+    {
+      eval_shl_n(values.begin(), unsinged_fast_type(number_of_limbs), offset, left_shift_amount);
+    }
+
+    WIDE_INTEGER_CONSTEXPR void shr(const unsinged_fast_type offset,
+                                    const std::uint_fast16_t right_shift_amount)
+    {
+      eval_shr_n(values.begin(), unsinged_fast_type(number_of_limbs), offset, right_shift_amount, is_neg(*this));
+    }
+
+    template<typename ForwardIterator>
+    static WIDE_INTEGER_CONSTEXPR void eval_shl_n(      ForwardIterator    p,
+                                                  const unsinged_fast_type count,
+                                                  const unsinged_fast_type offset,
+                                                  const std::uint_fast16_t left_shift_amount)
+    {
+      // Left-shift the count limbs at p by offset limbs
+      // plus left_shift_amount bits, where offset < count.
+
+      if(offset > 0U)
+      {
+        std::copy_backward(p,
+                           p + size_t(count - offset),
+                           p + size_t(count));
+
+        std::fill(p, p + size_t(offset), limb_type(0U));
+      }
+
+      using local_integral_type = unsinged_fast_type;
+
+      if(left_shift_amount != local_integral_type(0U))
+      {
+        auto part_from_previous_value = limb_type(0U);
+
+        for(unsinged_fast_type i = offset; i < count; ++i)
+        {
+          const limb_type t = *(p + size_t(i));
+
+          *(p + size_t(i)) =
+            limb_type(limb_type(t << local_integral_type(left_shift_amount)) | part_from_previous_value);
+
+          part_from_previous_value =
+            limb_type(t >> local_integral_type(unsinged_fast_type(std::numeric_limits<limb_type>::digits - left_shift_amount)));
+        }
+      }
+    }
+
+    template<typename ForwardIterator>
+    static WIDE_INTEGER_CONSTEXPR void eval_shr_n(      ForwardIterator    p,
+                                                  const unsinged_fast_type count,
+                                                  const unsinged_fast_type offset,
+                                                  const std::uint_fast16_t right_shift_amount,
+                                                  const bool               is_neg_fill)
+    {
+      // Right-shift the count limbs at p by offset limbs
+      // plus right_shift_amount bits, where offset < count.
+      // The vacated bits are filled with ones if is_neg_fill is set.
+
+      if(offset > 0U)
+      {
+        std::copy(p + size_t(offset),
+                  p + size_t(count),
+                  p);
+
+        std::fill(p + size_t(count - offset),
+                  p + size_t(count),
+                  (!is_neg_fill) ? limb_type(0U) : limb_type((std::numeric_limits<limb_type>::max)()));
+      }
+
+      using local_integral_type = unsinged_fast_type;
+
+      if(right_shift_amount != local_integral_type(0U))
+      {
+        limb_type part_from_previous_value =
+          (!is_neg_fill)
+            ? limb_type(0U)
+            : limb_type((std::numeric_limits<limb_type>::max)() << std::uint_fast16_t(std::uint_fast16_t(std::numeric_limits<limb_type>::digits) - right_shift_amount));
+
+        for(auto i = singed_fast_type((count - 1U) - offset); i >= singed_fast_type(0); --i)
+        {
+          const limb_type t = *(p + size_t(i));
+
+          *(p + size_t(i)) = limb_type(limb_type(t >> local_integral_type(right_shift_amount)) | part_from_previous_value);
+
+          part_from_previous_value = limb_type(t << local_integral_type(unsinged_fast_type(std::numeric_limits<limb_type>::digits - right_shift_amount)));
+        }
+      }
+    }
+
+    // Read string function.
+    WIDE_INTEGER_CONSTEXPR auto rd_string(const char* str_input) -> bool // NOLINT(readability-function-cognitive-complexity)
+    {
+      std::fill(values.begin(), values.end(), limb_type(0U));
+
+      const unsinged_fast_type str_length = detail::strlen_unsafe(str_input);
+
+      std::uint_fast8_t base = UINT8_C(10);
+
+      unsinged_fast_type pos = 0U;
+
+      // Detect: Is there a plus sign?
+      // And if there is a plus sign, skip over the plus sign.
+      if((str_length > 0U) && (str_input[0U] == char('+'))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        ++pos;
+      }
+
+      bool str_has_neg_sign = false;
+
+      // Detect: Is there a minus sign?
+      // And if there is a minus sign, skip over the minus sign.
+      if((str_length > 0U) && (str_input[0U] == char('-'))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        str_has_neg_sign = true;
+
+        ++pos;
+      }
+
+      // Perform a dynamic detection of the base.
+      if(str_length > (pos + 0U))
+      {
+        const bool might_be_oct_or_hex = ((str_input[pos + 0U] == char('0')) && (str_length > (pos + 1U))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        if(might_be_oct_or_hex)
+        {
+          if((str_input[pos + 1U] >= char('0')) && (str_input[pos + 1U] <= char('8'))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          {
+            // The input format is octal.
+            base = UINT8_C(8);
+
+            pos += 1U;
+          }
+          else if((str_input[pos + 1U] == char('x')) || (str_input[pos + 1U] == char('X'))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          {
+            // The input format is hexadecimal.
+            base = UINT8_C(16);
+
+            pos += 2U;
+          }
+        }
+        else if((str_input[pos + 0U] >= char('0')) && (str_input[pos + 0U] <= char('9'))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        {
+          // The input format is decimal.
+          ;
+        }
+      }
+
+      bool char_is_valid = true;
+
+      if(base == UINT8_C(10))
+      {
+        char_is_valid = rd_string_dec(str_input + pos, unsinged_fast_type(str_length - pos)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+      else if(base == UINT8_C(16))
+      {
+        char_is_valid = rd_string_hex(str_input + pos, unsinged_fast_type(str_length - pos)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+      else
+      {
+        for( ; ((pos < str_length) && char_is_valid); ++pos)
+        {
+          const auto c = std::uint8_t(str_input[pos]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          // TBD: Handle other digit delimiters in addition to apostrophe.
+          const bool char_is_apostrophe = (c == char(39));
+
+          if(!char_is_apostrophe)
+          {
+            std::uint8_t uc_oct { };
+
+            if  ((c >= char('0')) && (c <= char('8'))) { uc_oct = std::uint8_t(c - std::uint8_t(UINT8_C(0x30))); }
+            else                                       { uc_oct = std::uint8_t('\0'); char_is_valid = false; }
+
+            if(char_is_valid)
+            {
+              operator<<=(3);
+
+              *values.begin() |= uc_oct;
+            }
+          }
+        }
+      }
+
+      if(str_has_neg_sign)
+      {
+        negate();
+      }
+
+      return char_is_valid;
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto rd_string_hex(const char* p, const unsinged_fast_type n) -> bool
+    {
+      // Map the hexadecimal digits straight into the limbs, beginning
+      // with the least significant nibble at the end of the string.
+      // Nibbles beyond the width of the type are dropped.
+
+      constexpr auto nibbles_per_limb = static_cast<unsinged_fast_type>(std::numeric_limits<limb_type>::digits / 4);
+
+      auto nibble_index = static_cast<unsinged_fast_type>(0U);
+
+      for(auto i = n; i > 0U; --i)
+      {
+        const auto c = std::uint8_t(p[i - 1U]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        // TBD: Handle other digit delimiters in addition to apostrophe.
+        if(c != std::uint8_t(39U))
+        {
+          std::uint8_t uc_hex { };
+
+          if     ((c >= std::uint8_t('a')) && (c <= std::uint8_t('f'))) { uc_hex = std::uint8_t(c - std::uint8_t(UINT8_C(  87))); }
+          else if((c >= std::uint8_t('A')) && (c <= std::uint8_t('F'))) { uc_hex = std::uint8_t(c - std::uint8_t(UINT8_C(  55))); }
+          else if((c >= std::uint8_t('0')) && (c <= std::uint8_t('9'))) { uc_hex = std::uint8_t(c - std::uint8_t(UINT8_C(0x30))); }
+          else                                                          { return false; }
+
+          const auto limb_index = static_cast<unsinged_fast_type>(nibble_index / nibbles_per_limb);
+
+          if(limb_index < unsinged_fast_type(number_of_limbs))
+          {
+            const auto nibble_shift = static_cast<unsigned>(static_cast<unsigned>(nibble_index % nibbles_per_limb) * 4U);
+
+            *(values.begin() + size_t(limb_index)) |= static_cast<limb_type>(static_cast<limb_type>(uc_hex) << nibble_shift);
+          }
+
+          ++nibble_index;
+        }
+      }
+
+      return true;
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto rd_string_dec(const char* p, const unsinged_fast_type n) -> bool
+    {
+      // Long strings consisting of digits only (no delimiters)
+      // are converted by divide and conquer.
+
+      constexpr auto digits10 = static_cast<unsinged_fast_type>(std::numeric_limits<limb_type>::digits10);
+
+      bool use_dc =
+      (
+           (number_of_limbs >= rd_string_dec_dc_threshold)
+        && (n >= unsinged_fast_type(digits10 * unsinged_fast_type(rd_string_dec_dc_threshold)))
+        && (n <= unsinged_fast_type(digits10 * unsinged_fast_type(number_of_limbs * 2U)))
+      );
+
+      for(auto i = static_cast<unsinged_fast_type>(0U); (i < n) && use_dc; ++i)
+      {
+        use_dc = ((p[i] >= char('0')) && (p[i] <= char('9'))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      if(!use_dc)
+      {
+        return rd_string_dec_chunked(p, n);
+      }
+
+      // Set up the table of the powers 10^(digits10 * 2^k) needed
+      // to split the string into parts having digits10 * 2^k digits.
+      // As in wr_string_dec, the table is not on the stack.
+      using powers_array_type =
+        detail::fixed_dynamic_array<uintwide_t,
+                                    wr_string_dec_dc_levels(number_of_limbs) + 1U,
+                                    typename std::allocator_traits<typename std::conditional<std::is_same<AllocatorType, void>::value,
+                                                                                             std::allocator<void>,
+                                                                                             AllocatorType>::type>::template rebind_alloc<uintwide_t>>;
+
+      powers_array_type powers;
+
+      powers[0U] = dec_limb_pow10(std::numeric_limits<limb_type>::digits10);
+
+      detail::scratch_array<limb_type, number_of_limbs * 2U, AllocatorType> r;
+      detail::scratch_array<limb_type, number_of_limbs * 4U, AllocatorType> t;
+
+      auto level = static_cast<unsinged_fast_type>(0U);
+
+      while(unsinged_fast_type(digits10 << unsinged_fast_type(level + 1U)) < n)
+      {
+        powers[size_t(level + 1U)] = powers[size_t(level)];
+
+        rd_string_dec_mul(powers[size_t(level + 1U)], powers[size_t(level)], r.data(), t.data());
+
+        ++level;
+      }
+
+      rd_string_dec_recursive(p, n, *this, powers.data(), level, r.data(), t.data());
+
+      return true;
+    }
+
+    static WIDE_INTEGER_CONSTEXPR void rd_string_dec_recursive(const char*              p,        // NOLINT(misc-no-recursion)
+                                                               const unsinged_fast_type n,
+                                                                     uintwide_t&        result,
+                                                               const uintwide_t*        p_powers,
+                                                               const unsinged_fast_type level,
+                                                                     limb_type*         r,
+                                                                     limb_type*         t)
+    {
+      // Convert the n decimal digits at p, where n is at most
+      // digits10 * 2^(level + 1), from the high part of the digits,
+      // the low part of the digits (having digits10 * 2^level digits)
+      // and the power p_powers[level] via (high * power) + low.
+
+      const auto digits_lo = static_cast<unsinged_fast_type>(static_cast<unsinged_fast_type>(std::numeric_limits<limb_type>::digits10) << level);
+
+      if((level == 0U) || ((size_t(2U) << level) <= rd_string_dec_dc_leaf_limbs))
+      {
+        result = uintwide_t(std::uint8_t(0U));
+
+        static_cast<void>(result.rd_string_dec_chunked(p, n));
+      }
+      else if(n <= digits_lo)
+      {
+        rd_string_dec_recursive(p, n, result, p_powers, unsinged_fast_type(level - 1U), r, t);
+      }
+      else
+      {
+        uintwide_t lo;
+
+        rd_string_dec_recursive(p + size_t(n - digits_lo), digits_lo, lo, p_powers, unsinged_fast_type(level - 1U), r, t); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        rd_string_dec_recursive(p, unsinged_fast_type(n - digits_lo), result, p_powers, unsinged_fast_type(level - 1U), r, t);
+
+        rd_string_dec_mul(result, *(p_powers + size_t(level)), r, t); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        result += lo;
+      }
+    }
+
+    static WIDE_INTEGER_CONSTEXPR void rd_string_dec_mul(uintwide_t& u, const uintwide_t& v, limb_type* r, limb_type* t)
+    {
+      // Multiply u by v using only the limbs in use, rounded up
+      // to a multiple of 16 limbs so that the Karatsuba multiplication
+      // can halve them repeatedly. Here, r has room for 2 * number_of_limbs
+      // limbs of the product and t is the Karatsuba temporary storage.
+
+      const auto limbs_in_use =
+        static_cast<unsinged_fast_type>
+        (
+          unsinged_fast_type(number_of_limbs) - (std::min)(u.leading_zero_limbs(), v.leading_zero_limbs())
+        );
+
+      const auto len =
+        (std::min)(static_cast<unsinged_fast_type>(static_cast<unsinged_fast_type>(limbs_in_use + 15U) & static_cast<unsinged_fast_type>(~static_cast<unsinged_fast_type>(15U))),
+                   static_cast<unsinged_fast_type>(number_of_limbs));
+
+      eval_multiply_kara_n_by_n_to_2n(r, u.values.data(), v.values.data(), len, t);
+
+      const auto len_product = (std::min)(static_cast<unsinged_fast_type>(len * 2U), static_cast<unsinged_fast_type>(number_of_limbs));
+
+      std::copy(r, r + size_t(len_product), u.values.begin()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      std::fill(u.values.begin() + size_t(len_product), u.values.end(), limb_type(0U));
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto rd_string_dec_chunked(const char* p, const unsinged_fast_type n) -> bool // NOLINT(readability-function-cognitive-complexity)
+    {
+      // Accumulate chunks of up to digits10 decimal digits in a limb
+      // and fold each chunk into the limbs in use with one multiply-add.
+      // Within a chunk, blocks of eight digits are validated and converted
+      // at once (SIMD within a register). Apostrophes are skipped.
+
+      constexpr auto digits10 = std::numeric_limits<limb_type>::digits10;
+
+      const limb_type chunk_scale = dec_limb_pow10(digits10);
+      const limb_type block_scale = dec_limb_pow10((std::min)(digits10, 8));
+
+      auto limbs_in_use = static_cast<unsinged_fast_type>(0U);
+
+      auto chunk        = limb_type(0U);
+      auto chunk_digits = static_cast<int>(INT8_C(0));
+
+      auto pos = static_cast<unsinged_fast_type>(0U);
+
+      while(pos < n)
+      {
+        const auto c = std::uint8_t(p[pos]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        // TBD: Handle other digit delimiters in addition to apostrophe.
+        if(c == std::uint8_t(39U))
+        {
+          ++pos;
+
+          continue;
+        }
+
+        std::uint64_t block { };
+
+        if(   ((digits10 - chunk_digits) >= 8)
+           && (unsinged_fast_type(n - pos) >= 8U)
+           && rd_string_dec_block(p + size_t(pos), block)) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        {
+          chunk         = static_cast<limb_type>(static_cast<limb_type>(chunk * block_scale) + static_cast<limb_type>(block));
+          chunk_digits += 8;
+          pos          += 8U;
+        }
+        else
+        {
+          if((c < std::uint8_t('0')) || (c > std::uint8_t('9')))
+          {
+            return false;
+          }
+
+          chunk = static_cast<limb_type>(static_cast<limb_type>(chunk * UINT8_C(10)) + static_cast<limb_type>(c - std::uint8_t(UINT8_C(0x30))));
+
+          ++chunk_digits;
+          ++pos;
+        }
+
+        if(chunk_digits == digits10)
+        {
+          static_cast<void>(rd_string_mul_add(chunk_scale, chunk, limbs_in_use));
+
+          chunk        = limb_type(0U);
+          chunk_digits = 0;
+        }
+      }
+
+      if(chunk_digits > 0)
+      {
+        static_cast<void>(rd_string_mul_add(dec_limb_pow10(chunk_digits), chunk, limbs_in_use));
+      }
+
+      return true;
+    }
+
+    static WIDE_INTEGER_CONSTEXPR auto rd_string_dec_block(const char* p, std::uint64_t& block) -> bool
+    {
+      // Validate and convert eight decimal digits held in the bytes
+      // of a 64-bit integer, with the first digit in the lowest byte.
+
+      auto x = static_cast<std::uint64_t>(UINT8_C(0));
+
+      for(auto i = static_cast<unsigned>(UINT8_C(8)); i > 0U; --i)
+      {
+        x = static_cast<std::uint64_t>(static_cast<std::uint64_t>(x << 8U) | std::uint8_t(p[i - 1U])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      const bool all_are_digits =
+      (
+           ((x                                            & UINT64_C(0xF0F0F0F0F0F0F0F0)) == UINT64_C(0x3030303030303030))
+        && (((x + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)) == UINT64_C(0x3030303030303030))
+      );
+
+      if(all_are_digits)
+      {
+        // Combine pairs of digits, then pairs of pairs and so on.
+        x = static_cast<std::uint64_t>(x & UINT64_C(0x0F0F0F0F0F0F0F0F));
+        x = static_cast<std::uint64_t>(static_cast<std::uint64_t>(x * UINT64_C(2561)) >> 8U);
+        x = static_cast<std::uint64_t>(x & UINT64_C(0x00FF00FF00FF00FF));
+        x = static_cast<std::uint64_t>(static_cast<std::uint64_t>(x * UINT64_C(6553601)) >> 16U);
+        x = static_cast<std::uint64_t>(x & UINT64_C(0x0000FFFF0000FFFF));
+
+        block = static_cast<std::uint64_t>(static_cast<std::uint64_t>(x * UINT64_C(42949672960001)) >> 32U);
+      }
+
+      return all_are_digits;
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto rd_string_mul_add(const limb_type m, const limb_type a, unsinged_fast_type& limbs_in_use) -> bool
+    {
+      // Compute (*this * m) + a over the limbs in use, extending these
+      // by one limb if there is a carry. Return true if the carry
+      // is lost because all limbs are in use (overflow).
+
+      auto carry = static_cast<double_limb_type>(a);
+
+      for(auto i = static_cast<unsinged_fast_type>(0U); i < limbs_in_use; ++i)
+      {
+        carry = static_cast<double_limb_type>(carry + static_cast<double_limb_type>(static_cast<double_limb_type>(*(values.cbegin() + size_t(i))) * m));
+
+        *(values.begin() + size_t(i)) = static_cast<limb_type>(carry);
+
+        carry = detail::make_hi<limb_type>(carry);
+      }
+
+      const bool carry_is_lost = ((carry != 0U) && (limbs_in_use == unsinged_fast_type(number_of_limbs)));
+
+      if((carry != 0U) && (!carry_is_lost))
+      {
+        *(values.begin() + size_t(limbs_in_use)) = static_cast<limb_type>(carry);
+
+        ++limbs_in_use;
+      }
+
+      return carry_is_lost;
+    }
+
+    #if !defined(WIDE_INTEGER_DISABLE_TO_CHARS)
+    WIDE_INTEGER_CONSTEXPR auto wr_chars_bits(const unsinged_fast_type bit_pos, const unsinged_fast_type bit_count) const -> limb_type
+    {
+      // Extract bit_count bits (at most one limb) beginning at bit_pos,
+      // which may straddle two limbs.
+
+      constexpr auto limb_digits = static_cast<unsinged_fast_type>(std::numeric_limits<limb_type>::digits);
+
+      const auto index = static_cast<unsinged_fast_type>(bit_pos / limb_digits);
+      const auto shift = static_cast<unsinged_fast_type>(bit_pos % limb_digits);
+
+      auto bits = static_cast<limb_type>(*(values.cbegin() + size_t(index)) >> unsigned(shift));
+
+      if((unsinged_fast_type(shift + bit_count) > limb_digits) && (unsinged_fast_type(index + 1U) < unsinged_fast_type(number_of_limbs)))
+      {
+        bits = static_cast<limb_type>(bits | static_cast<limb_type>(*(values.cbegin() + size_t(index + 1U)) << unsigned(limb_digits - shift)));
+      }
+
+      return static_cast<limb_type>(bits & static_cast<limb_type>(static_cast<limb_type>(static_cast<limb_type>(1U) << unsigned(bit_count)) - 1U));
+    }
+
+    static constexpr auto wr_chars_digit(const limb_type d) -> char
+    {
+      return (d < 10U) ? static_cast<char>(d + UINT8_C(0x30)) : static_cast<char>(static_cast<limb_type>(d - 10U) + UINT8_C(0x61));
+    }
+
+    static constexpr auto rd_chars_digit(const char c) -> int
+    {
+      // The value of the digit character c in the bases up to 36,
+      // or 36 if c is not a digit character.
+      return ((c >= char('0')) && (c <= char('9'))) ? static_cast<int>(c - char('0'))
+           : ((c >= char('a')) && (c <= char('z'))) ? static_cast<int>(static_cast<int>(c - char('a')) + 10)
+           : ((c >= char('A')) && (c <= char('Z'))) ? static_cast<int>(static_cast<int>(c - char('A')) + 10)
+           : 36;
+    }
+
+    static WIDE_INTEGER_CONSTEXPR auto chars_chunk_digits(const limb_type base) -> int
+    {
+      // The number of digits in the base that fit in one limb.
+      auto chunk_digits = static_cast<int>(INT8_C(0));
+
+      for(auto p = limb_type(1U); p <= static_cast<limb_type>((std::numeric_limits<limb_type>::max)() / base); p = static_cast<limb_type>(p * base))
+      {
+        ++chunk_digits;
+      }
+
+      return chunk_digits;
+    }
+
+    static WIDE_INTEGER_CONSTEXPR auto chars_limb_pow(const limb_type base, const int k) -> limb_type
+    {
+      auto p = limb_type(1U);
+
+      for(auto i = static_cast<int>(INT8_C(0)); i < k; ++i)
+      {
+        p = static_cast<limb_type>(p * base);
+      }
+
+      return p;
+    }
+
+    static WIDE_INTEGER_CONSTEXPR auto wr_chars_chunked(wr_string_unsigned_type& t, char* p_end, const limb_type base) -> unsinged_fast_type
+    {
+      // Write the digits of the nonzero value t (which is destroyed)
+      // in the base backwards, ending in front of p_end. Return the number
+      // of digits. Each division yields a chunk of digits.
+
+      const int chunk_digits = chars_chunk_digits(base);
+
+      const limb_divisor<limb_type> chunk_divisor(chars_limb_pow(base, chunk_digits));
+
+      auto u_offset = t.leading_zero_limbs();
+
+      auto count = static_cast<unsinged_fast_type>(0U);
+
+      char* p = p_end;
+
+      while(u_offset < unsinged_fast_type(number_of_limbs))
+      {
+        auto chunk = t.eval_divide_by_limb_divisor(chunk_divisor, u_offset);
+
+        while((u_offset < unsinged_fast_type(number_of_limbs)) && (*(t.values.cbegin() + size_t(unsinged_fast_type(number_of_limbs - 1U) - u_offset)) == limb_type(0U)))
+        {
+          ++u_offset;
+        }
+
+        const bool chunk_is_leading = (u_offset == unsinged_fast_type(number_of_limbs));
+
+        for(auto i = static_cast<int>(INT8_C(0)); (i < chunk_digits) && ((!chunk_is_leading) || (chunk != limb_type(0U))); ++i)
+        {
+          *(--p) = wr_chars_digit(static_cast<limb_type>(chunk % base)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          chunk = static_cast<limb_type>(chunk / base);
+
+          ++count;
+        }
+      }
+
+      return count;
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto rd_chars_chunked(const char* p, const unsinged_fast_type n, const limb_type base) -> bool
+    {
+      // Accumulate chunks of digits in the base in a limb and fold each
+      // chunk into the limbs in use with one multiply-add. The digits
+      // must be valid. Return false if the value overflows.
+
+      const int chunk_digits_max = chars_chunk_digits(base);
+
+      const limb_type chunk_scale = chars_limb_pow(base, chunk_digits_max);
+
+      auto limbs_in_use = static_cast<unsinged_fast_type>(0U);
+
+      auto chunk        = limb_type(0U);
+      auto chunk_digits = static_cast<int>(INT8_C(0));
+
+      bool has_overflow = false;
+
+      for(auto pos = static_cast<unsinged_fast_type>(0U); pos < n; ++pos)
+      {
+        chunk = static_cast<limb_type>(static_cast<limb_type>(chunk * base) + static_cast<limb_type>(rd_chars_digit(p[pos]))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        ++chunk_digits;
+
+        if(chunk_digits == chunk_digits_max)
+        {
+          has_overflow = (rd_string_mul_add(chunk_scale, chunk, limbs_in_use) || has_overflow);
+
+          chunk        = limb_type(0U);
+          chunk_digits = 0;
+        }
+      }
+
+      if(chunk_digits > 0)
+      {
+        has_overflow = (rd_string_mul_add(chars_limb_pow(base, chunk_digits), chunk, limbs_in_use) || has_overflow);
+      }
+
+      return (!has_overflow);
+    }
+    #endif
+
+    WIDE_INTEGER_CONSTEXPR void bitwise_not()
+    {
+      for(unsinged_fast_type i = 0U; i < number_of_limbs; ++i)
+      {
+        *(values.begin() + size_t(i)) = limb_type(~(*(values.cbegin() + size_t(i))));
+      }
+    }
+
+    WIDE_INTEGER_CONSTEXPR void preincrement()
+    {
+      // Implement pre-increment.
+      unsinged_fast_type i = 0U;
+
+      for( ; (i < unsinged_fast_type(values.size() - 1U)) && (++(*(values.begin() + size_t(i))) == limb_type(0U)); ++i)
+      {
+        ;
+      }
+
+      if(i == unsinged_fast_type(values.size() - 1U))
+      {
+        ++(*(values.begin() + size_t(i)));
+      }
+    }
+
+    WIDE_INTEGER_CONSTEXPR void predecrement()
+    {
+      // Implement pre-decrement.
+      unsinged_fast_type i = 0U;
+
+      for( ; (i < unsinged_fast_type(values.size() - 1U)) && ((*(values.begin() + size_t(i)))-- == limb_type(0U)); ++i)
+      {
+        ;
+      }
+
+      if(i == unsinged_fast_type(values.size() - 1U))
+      {
+        --(*(values.begin() + size_t(i)));
+      }
+    }
+  };
+
+  // Define some convenient unsigned wide integer types.
+  using uint64_t    = uintwide_t<size_t(UINT32_C(   64)), std::uint16_t>;
+  using uint128_t   = uintwide_t<size_t(UINT32_C(  128)), std::uint32_t>;
+  using uint256_t   = uintwide_t<size_t(UINT32_C(  256)), std::uint32_t>;
+  using uint512_t   = uintwide_t<size_t(UINT32_C(  512)), std::uint32_t>;
+  using uint1024_t  = uintwide_t<size_t(UINT32_C( 1024)), std::uint32_t>;
+  using uint2048_t  = uintwide_t<size_t(UINT32_C( 2048)), std::uint32_t>;
+  using uint4096_t  = uintwide_t<size_t(UINT32_C( 4096)), std::uint32_t>;
+  using uint8192_t  = uintwide_t<size_t(UINT32_C( 8192)), std::uint32_t>;
+  using uint16384_t = uintwide_t<size_t(UINT32_C(16384)), std::uint32_t>;
+  using uint32768_t = uintwide_t<size_t(UINT32_C(32768)), std::uint32_t>;
+  using uint65536_t = uintwide_t<size_t(UINT32_C(65536)), std::uint32_t>;
+
+  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
+  static_assert(std::is_trivially_copyable<uint64_t   >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint128_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint256_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint512_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint1024_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint2048_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint4096_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint8192_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint16384_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint32768_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint65536_t>::value, "uintwide_t must be trivially copyable.");
+
+  static_assert(std::is_standard_layout<uint64_t   >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint128_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint256_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint512_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint1024_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint2048_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint4096_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint8192_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint16384_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint32768_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint65536_t>::value, "uintwide_t must have standard layout.");
+  #endif
+
+  using  int64_t    = uintwide_t<size_t(UINT32_C(   64)), std::uint16_t, void, true>;
+  using  int128_t   = uintwide_t<size_t(UINT32_C(  128)), std::uint32_t, void, true>;
+  using  int256_t   = uintwide_t<size_t(UINT32_C(  256)), std::uint32_t, void, true>;
+  using  int512_t   = uintwide_t<size_t(UINT32_C(  512)), std::uint32_t, void, true>;
+  using  int1024_t  = uintwide_t<size_t(UINT32_C( 1024)), std::uint32_t, void, true>;
+  using  int2048_t  = uintwide_t<size_t(UINT32_C( 2048)), std::uint32_t, void, true>;
+  using  int4096_t  = uintwide_t<size_t(UINT32_C( 4096)), std::uint32_t, void, true>;
+  using  int8192_t  = uintwide_t<size_t(UINT32_C( 8192)), std::uint32_t, void, true>;
+  using  int16384_t = uintwide_t<size_t(UINT32_C(16384)), std::uint32_t, void, true>;
+  using  int32768_t = uintwide_t<size_t(UINT32_C(32768)), std::uint32_t, void, true>;
+  using  int65536_t = uintwide_t<size_t(UINT32_C(65536)), std::uint32_t, void, true>;
+
+  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
+  static_assert(std::is_trivially_copyable<int64_t   >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int128_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int256_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int512_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int1024_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int2048_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int4096_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int8192_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int16384_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int32768_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int65536_t>::value, "uintwide_t must be trivially copyable.");
+
+  static_assert(std::is_standard_layout<int64_t   >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int128_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int256_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int512_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int1024_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int2048_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int4096_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int8192_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int16384_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int32768_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int65536_t>::value, "uintwide_t must have standard layout.");
+  #endif
+
+  // Insert a base class for numeric_limits<> support.
+  // This class inherits from std::numeric_limits<unsigned int>
+  // in order to provide limits for a non-specific unsigned type.
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits_uintwide_t_base
+    : public std::numeric_limits<typename std::conditional<(!IsSigned), unsigned int, signed int>::type>
+  {
+  private:
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  public:
+    static constexpr int digits          = (!IsSigned)
+                                             ? static_cast<int>(local_wide_integer_type::my_width2)
+                                             : static_cast<int>(local_wide_integer_type::my_width2 - 1U);
+
+    static constexpr int digits10        = static_cast<int>((std::uintmax_t(digits)       * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
+    static constexpr int max_digits10    = digits10;
+    static constexpr int max_exponent    = digits;
+    static constexpr int max_exponent10  = static_cast<int>((std::uintmax_t(max_exponent) * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
+
+    static constexpr auto (max) () -> local_wide_integer_type { return local_wide_integer_type::limits_helper_max   (IsSigned); }
+    static constexpr auto (min) () -> local_wide_integer_type { return local_wide_integer_type::limits_helper_min   (IsSigned); }
+    static constexpr auto lowest() -> local_wide_integer_type { return local_wide_integer_type::limits_helper_lowest(IsSigned); }
+  };
+
+  template<class T>
+  struct is_integral : public std::is_integral<T> { };
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  struct is_integral<math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+    : public std::integral_constant<bool, true> { };
+
+  } // namespace wide_integer
+  } // namespace math
+
+  WIDE_INTEGER_NAMESPACE_END
+
+  namespace std
+  {
+    // Specialization of std::numeric_limits<uintwide_t>.
+    template<const WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t Width2,
+             typename LimbType,
+             typename AllocatorType,
+             const bool IsSigned>
+    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+      : public WIDE_INTEGER_NAMESPACE::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
+  } // namespace std
+
+  WIDE_INTEGER_NAMESPACE_BEGIN
+  namespace math { namespace wide_integer {
+
+  // Non-member binary add, sub, mul, div, mod of (uintwide_t op uintwide_t).
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator- (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator* (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator% (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(v); }
+
+  // Non-member binary logic operations of (uintwide_t op uintwide_t).
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator| (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator& (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(v); }
+
+  // Non-member binary add, sub, mul, div, mod of (uintwide_t op IntegralType).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
+  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<(   ( std::is_integral<IntegralType>::value)
+                                                                                                                                              && (!std::is_unsigned<IntegralType>::value)),
+                                                                                                                                              uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type
+  { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<(   (std::is_integral<IntegralType>::value)
+                                                                                                                                                           && (std::is_unsigned<IntegralType>::value)
+                                                                                                                                                           && (std::numeric_limits<IntegralType>::digits <= std::numeric_limits<LimbType>::digits)),
+                                                                                                                                                           typename uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::limb_type>::type
+  {
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    const bool u_is_neg = local_wide_integer_type::is_neg(u);
+
+    local_wide_integer_type remainder;
+
+    local_wide_integer_type((!u_is_neg) ? u : -u).eval_divide_by_single_limb(v, 0U, &remainder);
+
+    using local_limb_type = typename local_wide_integer_type::limb_type;
+
+    auto u_rem = local_limb_type(remainder);
+
+    return ((!u_is_neg) ? u_rem : local_limb_type(local_limb_type(~u_rem) + 1U));
+  }
+
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
+  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<(   (std::is_integral<IntegralType>::value)
+                                                                                                                                              && (std::is_unsigned<IntegralType>::value)
+                                                                                                                                              && (std::numeric_limits<IntegralType>::digits > std::numeric_limits<LimbType>::digits)),
+                                                                                                                                              uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type
+  { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+
+  // Non-member binary add, sub, mul, div, mod of (IntegralType op uintwide_t).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(v); }
+
+  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+  // Non-member binary add, sub, mul, div, mod of (uintwide_t op FloatingPointType).
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+
+  // Non-member binary add, sub, mul, div, mod of (FloatingPointType op uintwide_t).
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator+=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator-=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator*=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator/=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator%=(v); }
+  #endif
+
+  // Non-member binary logic operations of (uintwide_t op IntegralType).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator|(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator&(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+
+  // Non-member binary binary logic operations of (IntegralType op uintwide_t).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator|(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator&(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(v); }
+
+  // Non-member shift functions of (uintwide_t shift IntegralType).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<<(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType n) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator<<=(n); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>>(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType n) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator>>=(n); }
+
+  // Non-member comparison functions of (uintwide_t cmp uintwide_t).
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator==(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator!=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator> (v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator< (v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator>=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator<=(v); }
+
+  // Non-member comparison functions of (uintwide_t cmp IntegralType).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return u.operator==(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return u.operator!=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return u.operator> (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return u.operator< (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return u.operator>=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return u.operator<=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+
+  // Non-member comparison functions of (IntegralType cmp uintwide_t).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator==(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator!=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator> (v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator< (v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator>=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator<=(v); }
+
+  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+  // Non-member comparison functions of (uintwide_t cmp FloatingPointType).
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return u.operator==(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return u.operator!=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return u.operator> (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return u.operator< (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return u.operator>=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return u.operator<=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+
+  // Non-member comparison functions of (FloatingPointType cmp uintwide_t).
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator==(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator!=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator> (v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator< (v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator>=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator<=(v); }
+  #endif
+
+  #if !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+
+  // I/O streaming functions.
+  template<typename char_type,
+           typename traits_type,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto operator<<(std::basic_ostream<char_type, traits_type>& out,
+                  const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_ostream<char_type, traits_type>&
+  {
+    std::basic_ostringstream<char_type, traits_type> ostr;
+
+    const std::ios::fmtflags my_flags = out.flags();
+
+    const bool show_pos     = ((my_flags & std::ios::showpos)   == std::ios::showpos);
+    const bool show_base    = ((my_flags & std::ios::showbase)  == std::ios::showbase);
+    const bool is_uppercase = ((my_flags & std::ios::uppercase) == std::ios::uppercase);
+
+    std::uint_fast8_t base_rep { };
+
+    if     ((my_flags & std::ios::oct) == std::ios::oct) { base_rep = UINT8_C( 8); }
+    else if((my_flags & std::ios::hex) == std::ios::hex) { base_rep = UINT8_C(16); }
+    else                                                 { base_rep = UINT8_C(10); }
+
+    const auto field_width = unsinged_fast_type(out.width());
+    const auto fill_char   = static_cast<char>(out.fill());
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    if(base_rep == UINT8_C(8))
+    {
+      detail::string_buffer<local_wide_integer_type::wr_string_max_buffer_size_oct, AllocatorType> str_result { };
+
+      x.wr_string(str_result.data(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char);
+
+      static_cast<void>(ostr << str_result.data());
+    }
+    else if(base_rep == UINT8_C(10))
+    {
+      detail::string_buffer<local_wide_integer_type::wr_string_max_buffer_size_dec, AllocatorType> str_result { };
+
+      x.wr_string(str_result.data(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char);
+
+      static_cast<void>(ostr << str_result.data());
+    }
+    else if(base_rep == UINT8_C(16))
+    {
+      detail::string_buffer<local_wide_integer_type::wr_string_max_buffer_size_hex, AllocatorType> str_result { };
+
+      x.wr_string(str_result.data(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char);
+
+      static_cast<void>(ostr << str_result.data());
+    }
+
+    return (out << ostr.str());
+  }
+
+  template<typename char_type,
+           typename traits_type,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto operator>>(std::basic_istream<char_type, traits_type>& in,
+                  uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_istream<char_type, traits_type>&
+  {
+    std::string str_in;
+
+    in >> str_in;
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    x = local_wide_integer_type(str_in.c_str());
+
+    return in;
+  }
+
+  #endif
+
+  #if !defined(WIDE_INTEGER_DISABLE_TO_CHARS)
+
+  // Character conversion functions.
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto to_chars(char* first,
+                                       char* last,
+                                       const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
+                                       const int base) -> to_chars_result
+  {
+    return x.wr_chars(first, last, base);
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto from_chars(const char* first,
+                                         const char* last,
+                                         uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
+                                         const int base) -> from_chars_result
+  {
+    return x.rd_chars(first, last, base);
+  }
+
+  #endif
+
+  } // namespace wide_integer
+  } // namespace math
+
+  // Implement various number-theoretical tools.
+
+  namespace math { namespace wide_integer {
+
+  namespace detail {
+
+  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+  namespace my_own {
+
+  template<typename FloatingPointType> WIDE_INTEGER_CONSTEXPR auto frexp(FloatingPointType x, int* expptr) -> typename std::enable_if<((std::is_floating_point<FloatingPointType>::value) && (std::numeric_limits<FloatingPointType>::is_iec559)), FloatingPointType>::type
+  {
+    using local_floating_point_type = FloatingPointType;
+
+    const bool x_is_neg = (x < local_floating_point_type(0.0L));
+
+    local_floating_point_type f = (x_is_neg ? -x : x);
+
+    int e2 = 0;
+
+    constexpr long double two_pow32 =
+      static_cast<long double>(0x10000) * static_cast<long double>(0x10000);
+
+    while(f >= local_floating_point_type(two_pow32))
+    {
+      // TBD: Maybe optimize this exponent reduction
+      // with a more clever kind of binary searching.
+
+      f   = local_floating_point_type(f / local_floating_point_type(two_pow32));
+      e2 += int(INT32_C(32));
+    }
+
+    constexpr long double one_ldbl(1.0L);
+
+    while(f >= local_floating_point_type(one_ldbl))
+    {
+      constexpr long double two_ldbl(2.0L);
+
+      f = local_floating_point_type(f / local_floating_point_type(two_ldbl));
+
+      ++e2;
+    }
+
+    if(expptr != nullptr)
+    {
+      *expptr = e2;
+    }
+
+    return ((!x_is_neg) ? f : -f);
+  }
+
+  template<typename FloatingPointType> WIDE_INTEGER_CONSTEXPR auto frexp(FloatingPointType x, int* expptr) -> typename std::enable_if<((std::is_floating_point<FloatingPointType>::value) && (!std::numeric_limits<FloatingPointType>::is_iec559)), FloatingPointType>::type
+  {
+    using std::frexp;
+
+    return frexp(x, expptr);
+  }
+
+  template<typename FloatingPointType> WIDE_INTEGER_CONSTEXPR auto isfinite(FloatingPointType x) -> typename std::enable_if<((std::is_floating_point<FloatingPointType>::value) && (std::numeric_limits<FloatingPointType>::is_iec559)), bool>::type
+  {
+    using local_floating_point_type = FloatingPointType;
+
+    bool x_is_finite = true;
+
+    const bool x_is_nan = (x != x);
+
+    if(x_is_nan)
+    {
+      x_is_finite = false;
+    }
+    else
+    {
+      const bool x_is_inf_pos = (x > (std::numeric_limits<local_floating_point_type>::max)());
+      const bool x_is_inf_neg = (x < (std::numeric_limits<local_floating_point_type>::lowest)());
+
+      if(x_is_inf_pos || x_is_inf_neg)
+      {
+        x_is_finite = false;
+      }
+    }
+
+    return x_is_finite;
+  }
+
+  template<typename FloatingPointType> WIDE_INTEGER_CONSTEXPR auto isfinite(FloatingPointType x) -> typename std::enable_if<((std::is_floating_point<FloatingPointType>::value) && (!std::numeric_limits<FloatingPointType>::is_iec559)), bool>::type
+  {
+    using std::isfinite;
+
+    return isfinite(x);
+  }
+
+  } // namespace my_own
+  #endif
+
+  template<typename UnsignedIntegralType>
+  inline WIDE_INTEGER_CONSTEXPR auto lsb_helper(const UnsignedIntegralType& u) -> unsinged_fast_type
+  {
+    // Compile-time checks.
+    static_assert((   (std::is_integral<UnsignedIntegralType>::value)
+                   && (std::is_unsigned<UnsignedIntegralType>::value)),
+                   "Error: Please check the characteristics of UnsignedIntegralType");
+
+    unsinged_fast_type result = 0U;
+
+    UnsignedIntegralType mask(u);
+
+    // This assumes that at least one bit is set.
+    // Otherwise saturation of the index will occur.
+
+    // Naive and basic LSB search.
+    // TBD: This could be improved with a binary search
+    // on the lowest bit position of the fundamental type.
+    while((unsinged_fast_type(mask) & 1U) == 0U)
+    {
+      mask >>= 1U;
+
+      ++result;
+    }
+
+    return result;
+  }
+
+  template<typename UnsignedIntegralType>
+  inline WIDE_INTEGER_CONSTEXPR auto msb_helper(const UnsignedIntegralType& u) -> unsinged_fast_type
+  {
+    // Compile-time checks.
+    static_assert((   (std::is_integral<UnsignedIntegralType>::value)
+                   && (std::is_unsigned<UnsignedIntegralType>::value)),
+                   "Error: Please check the characteristics of UnsignedIntegralType");
+
+    using local_unsigned_integral_type = UnsignedIntegralType;
+
+    singed_fast_type i { };
+
+    // TBD: This could potentially be improved with a binary
+    // search for the highest bit position in the type.
+
+    for(i = singed_fast_type(std::numeric_limits<local_unsigned_integral_type>::digits - 1); i >= 0; --i)
+    {
+      if((u & UnsignedIntegralType(local_unsigned_integral_type(1U) << i)) != 0U)
+      {
+        break;
+      }
+    }
+
+    return unsinged_fast_type((std::max)(singed_fast_type(0), i));
+  }
+
+  template<>
+  inline WIDE_INTEGER_CONSTEXPR auto msb_helper<std::uint32_t>(const std::uint32_t& u) -> unsinged_fast_type
+  {
+    unsinged_fast_type r(0);
+
+    std::uint32_t x = u;
+
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if((x & UINT32_C(0xFFFF0000)) != UINT32_C(0)) { x = std::uint32_t(x >> unsigned(UINT32_C(16))); r = unsinged_fast_type(r | UINT32_C(16)); }
+    if((x & UINT32_C(0x0000FF00)) != UINT32_C(0)) { x = std::uint32_t(x >> unsigned(UINT32_C( 8))); r = unsinged_fast_type(r | UINT32_C( 8)); }
+    if((x & UINT32_C(0x000000F0)) != UINT32_C(0)) { x = std::uint32_t(x >> unsigned(UINT32_C( 4))); r = unsinged_fast_type(r | UINT32_C( 4)); }
+    if((x & UINT32_C(0x0000000C)) != UINT32_C(0)) { x = std::uint32_t(x >> unsigned(UINT32_C( 2))); r = unsinged_fast_type(r | UINT32_C( 2)); }
+    if((x & UINT32_C(0x00000002)) != UINT32_C(0)) {                                                 r = unsinged_fast_type(r | UINT32_C( 1)); }
+
+    return unsinged_fast_type(r);
+  }
+
+  template<>
+  inline WIDE_INTEGER_CONSTEXPR auto msb_helper<std::uint16_t>(const std::uint16_t& u) -> unsinged_fast_type
+  {
+    unsinged_fast_type r(0);
+
+    std::uint16_t x = u;
+
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if((x & UINT16_C(0xFF00)) != UINT16_C(0)) { x = std::uint16_t(x >> unsigned(UINT16_C(8))); r = unsinged_fast_type(r | UINT16_C(8)); } // NOLINT(hicpp-signed-bitwise)
+    if((x & UINT16_C(0x00F0)) != UINT16_C(0)) { x = std::uint16_t(x >> unsigned(UINT16_C(4))); r = unsinged_fast_type(r | UINT16_C(4)); } // NOLINT(hicpp-signed-bitwise)
+    if((x & UINT16_C(0x000C)) != UINT16_C(0)) { x = std::uint16_t(x >> unsigned(UINT16_C(2))); r = unsinged_fast_type(r | UINT16_C(2)); } // NOLINT(hicpp-signed-bitwise)
+    if((x & UINT16_C(0x0002)) != UINT16_C(0)) {                                                r = unsinged_fast_type(r | UINT16_C(1)); } // NOLINT(hicpp-signed-bitwise)
+
+    return unsinged_fast_type(r);
+  }
+
+  template<>
+  inline WIDE_INTEGER_CONSTEXPR auto msb_helper<std::uint8_t>(const std::uint8_t& u) -> unsinged_fast_type
+  {
+    unsinged_fast_type r(0);
+
+    std::uint8_t x = u;
+
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if((x & UINT8_C(0xF0)) != UINT8_C(0)) { x = std::uint8_t(x >> 4U); r = unsinged_fast_type(r | UINT8_C(4)); } // NOLINT(hicpp-signed-bitwise)
+    if((x & UINT8_C(0x0C)) != UINT8_C(0)) { x = std::uint8_t(x >> 2U); r = unsinged_fast_type(r | UINT8_C(2)); } // NOLINT(hicpp-signed-bitwise)
+    if((x & UINT8_C(0x02)) != UINT8_C(0)) {                            r = unsinged_fast_type(r | UINT8_C(1)); } // NOLINT(hicpp-signed-bitwise)
+
+    return unsinged_fast_type(r);
+  }
+
+  } // namespace detail
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR void swap(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
+                                   uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& y)
+  {
+    if(&x != &y)
+    {
+      using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+      const local_wide_integer_type tmp_x(x);
+
+      x = y;
+      y = tmp_x;
+    }
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  inline WIDE_INTEGER_CONSTEXPR auto lsb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsinged_fast_type
+  {
+    // Calculate the position of the least-significant bit.
+    // Use a linear search starting from the least significant limbs.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_value_type        = typename local_wide_integer_type::limb_type;
+
+    auto bpos = unsinged_fast_type(0U);
+
+    for(auto it = (x.crepresentation()).cbegin(); it != (x.crepresentation()).cend(); ++it) // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+    {
+      if((*it & (std::numeric_limits<local_value_type>::max)()) != 0U)
+      {
+        const auto offset = unsinged_fast_type(it - x.crepresentation().cbegin());
+
+        bpos =   detail::lsb_helper(*it)
+               + unsinged_fast_type(unsinged_fast_type(std::numeric_limits<local_value_type>::digits) * offset);
+
+        break;
+      }
+    }
+
+    return bpos;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto msb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsinged_fast_type
+  {
+    // Calculate the position of the most-significant bit.
+    // Use a linear search starting from the most significant limbs.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_value_type        = typename local_wide_integer_type::limb_type;
+
+    auto bpos = unsinged_fast_type(0U);
+
+    for(auto ri = x.crepresentation().crbegin(); ri != x.crepresentation().crend(); ++ri)
+    {
+      if((*ri & (std::numeric_limits<local_value_type>::max)()) != 0U)
+      {
+        const unsinged_fast_type offset = unsinged_fast_type((x.crepresentation().crend() - 1U) - ri);
+
+        bpos =   detail::msb_helper(*ri)
+               + unsinged_fast_type(unsinged_fast_type(std::numeric_limits<local_value_type>::digits) * offset);
+
+        break;
+      }
+    }
+
+    return bpos;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto abs(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    return ((local_wide_integer_type::is_neg(x) == false) ? x : -x);
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto sqrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the square root.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    local_wide_integer_type s;
+
+    if(m.is_zero() || local_wide_integer_type::is_neg(m))
+    {
+      s = local_wide_integer_type(std::uint_fast8_t(0U));
+    }
+    else
+    {
+      // Obtain the initial guess via algorithms
+      // involving the position of the msb.
+      const unsinged_fast_type msb_pos = msb(m);
+
+      // Obtain the initial value.
+      const unsinged_fast_type left_shift_amount =
+        ((unsinged_fast_type(msb_pos % 2U) == 0U)
+          ? 1U + unsinged_fast_type((msb_pos + 0U) / 2U)
+          : 1U + unsinged_fast_type((msb_pos + 1U) / 2U));
+
+      local_wide_integer_type u(local_wide_integer_type(std::uint_fast8_t(1U)) << left_shift_amount);
+
+      // Perform the iteration for the square root.
+      // See Algorithm 1.13 SqrtInt, Sect. 1.5.1
+      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+      // Cambridge University Press, 2011.
+
+      for(unsinged_fast_type i = 0U; i < unsinged_fast_type(UINT8_C(64)); ++i)
+      {
+        s = u;
+
+        u = (s + (m / s)) >> 1;
+
+        if(u >= s)
+        {
+          break;
+        }
+      }
+    }
+
+    return s;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto cbrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> // NOLINT(misc-no-recursion)
+  {
+    // Calculate the cube root.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    local_wide_integer_type s;
+
+    if(local_wide_integer_type::is_neg(m))
+    {
+      s = -cbrt(-m);
+    }
+    else if(m.is_zero())
+    {
+      s = local_wide_integer_type(std::uint_fast8_t(0U));
+    }
+    else
+    {
+      // Obtain the initial guess via algorithms
+      // involving the position of the msb.
+      const unsinged_fast_type msb_pos = msb(m);
+
+      // Obtain the initial value.
+      const unsinged_fast_type msb_pos_mod_3 = msb_pos % 3;
+
+      const unsinged_fast_type left_shift_amount =
+        ((msb_pos_mod_3 == 0U)
+          ? 1U + unsinged_fast_type((msb_pos +                  0U ) / 3U)
+          : 1U + unsinged_fast_type((msb_pos + (3U - msb_pos_mod_3)) / 3U));
+
+      local_wide_integer_type u(local_wide_integer_type(std::uint_fast8_t(1U)) << left_shift_amount);
+
+      // Perform the iteration for the k'th root.
+      // See Algorithm 1.14 RootInt, Sect. 1.5.2
+      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+      // Cambridge University Press, 2011.
+
+      const unsinged_fast_type three_minus_one(3U - 1U);
+
+      for(unsinged_fast_type i = 0U; i < unsinged_fast_type(UINT8_C(64)); ++i)
+      {
+        s = u;
+
+        local_wide_integer_type m_over_s_pow_3_minus_one = m;
+
+        for(unsinged_fast_type j = 0U; j < 3U - 1U; ++j)
+        {
+          // Use a loop here to divide by s^(3 - 1) because
+          // without a loop, s^(3 - 1) is likely to overflow.
+
+          m_over_s_pow_3_minus_one /= s;
+        }
+
+        u = ((s * three_minus_one) + m_over_s_pow_3_minus_one) / 3U;
+
+        if(u >= s)
+        {
+          break;
+        }
+      }
+    }
+
+    return s;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto rootk(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m, const std::uint_fast8_t k) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the k'th root.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    local_wide_integer_type s;
+
+    if(k < 2U)
+    {
+      s = m;
+    }
+    else if(k == 2U)
+    {
+      s = sqrt(m);
+    }
+    else if(k == 3U)
+    {
+      s = cbrt(m);
+    }
+    else
+    {
+      if(m.is_zero() || local_wide_integer_type::is_neg(m))
+      {
+        s = local_wide_integer_type(std::uint_fast8_t(0U));
+      }
+      else
+      {
+        // Obtain the initial guess via algorithms
+        // involving the position of the msb.
+        const unsinged_fast_type msb_pos = msb(m);
+
+        // Obtain the initial value.
+        const unsinged_fast_type msb_pos_mod_k = msb_pos % k;
+
+        const unsinged_fast_type left_shift_amount =
+          ((msb_pos_mod_k == 0U)
+            ? 1U + unsinged_fast_type((msb_pos +                 0U ) / k)
+            : 1U + unsinged_fast_type((msb_pos + (k - msb_pos_mod_k)) / k));
+
+        local_wide_integer_type u(local_wide_integer_type(std::uint_fast8_t(1U)) << left_shift_amount);
+
+        // Perform the iteration for the k'th root.
+        // See Algorithm 1.14 RootInt, Sect. 1.5.2
+        // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+        // Cambridge University Press, 2011.
+
+        const unsinged_fast_type k_minus_one(k - 1U);
+
+        for(unsinged_fast_type i = 0U; i < unsinged_fast_type(UINT8_C(64)); ++i)
+        {
+          s = u;
+
+          local_wide_integer_type m_over_s_pow_k_minus_one = m;
+
+          for(unsinged_fast_type j = 0U; j < k - 1U; ++j)
+          {
+            // Use a loop here to divide by s^(k - 1) because
+            // without a loop, s^(k - 1) is likely to overflow.
+
+            m_over_s_pow_k_minus_one /= s;
+          }
+
+          u = ((s * k_minus_one) + m_over_s_pow_k_minus_one) / k;
+
+          if(u >= s)
+          {
+            break;
+          }
+        }
+      }
+    }
+
+    return s;
+  }
+
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto pow(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b, const OtherIntegralTypeP& p) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate (b ^ p).
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    local_wide_integer_type result;
+    auto p0(static_cast<local_limb_type>(p));
+
+    if((p0 == 0U) && (p == OtherIntegralTypeP(0)))
+    {
+      result = local_wide_integer_type(std::uint8_t(1U));
+    }
+    else if((p0 == 1U) && (p == OtherIntegralTypeP(1)))
+    {
+      result = b;
+    }
+    else if((p0 == 2U) && (p == OtherIntegralTypeP(2)))
+    {
+      result  = b;
+      result *= result;
+    }
+    else
+    {
+      result = local_wide_integer_type(std::uint8_t(1U));
+
+      local_wide_integer_type y      (b);
+      local_wide_integer_type p_local(p);
+
+      while(((p0 = local_limb_type(p_local)) != 0U) || (p_local != 0U))
+      {
+        if((p0 & 1U) != 0U)
+        {
+          result *= y;
+        }
+
+        y *= y;
+
+        p_local >>= 1;
+      }
+    }
+
+    return result;
+  }
+
+  namespace detail {
+
+  // Helpers for scanning the bits of an exponent, which can be
+  // either a built-in integral type or a uintwide_t of any width.
+  template<typename IntegralTypeP>
+  WIDE_INTEGER_CONSTEXPR auto exponent_bit_count(const IntegralTypeP& p) -> typename std::enable_if<std::is_integral<IntegralTypeP>::value, unsinged_fast_type>::type
+  {
+    using local_unsigned_type = typename std::make_unsigned<IntegralTypeP>::type;
+
+    const auto u = static_cast<local_unsigned_type>(p);
+
+    return ((u == 0U) ? unsinged_fast_type(0U) : unsinged_fast_type(msb_helper(u) + 1U));
+  }
+
+  template<typename IntegralTypeP>
+  WIDE_INTEGER_CONSTEXPR auto exponent_test_bit(const IntegralTypeP& p, const unsinged_fast_type i) -> typename std::enable_if<std::is_integral<IntegralTypeP>::value, bool>::type
+  {
+    using local_unsigned_type = typename std::make_unsigned<IntegralTypeP>::type;
+
+    return ((local_unsigned_type(static_cast<local_unsigned_type>(p) >> i) & 1U) != 0U);
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto exponent_bit_count(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& p) -> unsinged_fast_type
+  {
+    return (p.is_zero() ? unsinged_fast_type(0U) : unsinged_fast_type(msb(p) + 1U));
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto exponent_test_bit(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& p, const unsinged_fast_type i) -> bool
+  {
+    // Read the bit directly from its limb, without shifting the whole exponent.
+    constexpr auto limb_digits = unsinged_fast_type(std::numeric_limits<LimbType>::digits);
+
+    const LimbType limb = *(p.crepresentation().cbegin() + size_t(i / limb_digits));
+
+    return ((LimbType(limb >> (i % limb_digits)) & 1U) != 0U);
+  }
+
+  constexpr auto pow_window_bits_max = unsinged_fast_type(5U);
+
+  constexpr auto pow_window_bits_for_exponent(const unsinged_fast_type bit_count) -> unsinged_fast_type
+  {
+    // Choose the window size which minimizes the total number
+    // of multiplications (including the table precomputation)
+    // for the given bit count of the exponent.
+
+    return ((bit_count > 239U) ? unsinged_fast_type(5U)
+         : ((bit_count >  79U) ? unsinged_fast_type(4U)
+         : ((bit_count >  23U) ? unsinged_fast_type(3U)
+         : ((bit_count >   7U) ? unsinged_fast_type(2U)
+         :                       unsinged_fast_type(1U)))));
+  }
+
+  template<typename ValueType>
+  struct pow_table_allocator
+  {
+    using type = std::allocator<ValueType>;
+  };
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  struct pow_table_allocator<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  {
+    // The table of powers uses the allocator of the wide integer type,
+    // or std::allocator if it has none.
+    using type =
+      typename std::allocator_traits<typename std::conditional<std::is_same<AllocatorType, void>::value,
+                                                               std::allocator<void>,
+                                                               AllocatorType>::type>::template rebind_alloc<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>;
+  };
+
+  template<typename ModularArithmeticType,
+           typename ValueType,
+           typename OtherIntegralTypeP>
+  WIDE_INTEGER_CONSTEXPR auto pow_sliding_window(const ModularArithmeticType& arith,
+                                                 const ValueType&             y,
+                                                 const OtherIntegralTypeP&    p,
+                                                 const unsinged_fast_type     window_bits) -> ValueType
+  {
+    // Calculate y^p using left-to-right sliding-window exponentiation.
+    // See Algorithm 14.85 in A.J. Menezes, P.C. van Oorschot and S.A. Vanstone,
+    // "Handbook of Applied Cryptography", CRC Press, 1996.
+
+    // The modular arithmetic type provides one(), mul(a, b) and sqr(a).
+    // The exponent bits are read directly from p, which is not modified.
+
+    const unsinged_fast_type bit_count = exponent_bit_count(p);
+
+    const unsinged_fast_type k =
+      ((window_bits != 0U) ? (std::min)(window_bits, pow_window_bits_max)
+                           : pow_window_bits_for_exponent(bit_count));
+
+    // Precompute the odd powers y, y^3, y^5, ..., y^(2^k - 1).
+    // The table has 2^(k - 1) entries and is not placed on the stack,
+    // since these can be very wide (double-width in powm).
+    using table_type = detail::dynamic_array<ValueType, typename pow_table_allocator<ValueType>::type, size_t, ptrdiff_t>;
+
+    table_type g(size_t(1U << (k - 1U)), y);
+
+    if(k > 1U)
+    {
+      const ValueType y2 = arith.sqr(y);
+
+      for(auto j = size_t(1U); j < size_t(1U << (k - 1U)); ++j)
+      {
+        g[j] = arith.mul(g[size_t(j - 1U)], y2);
+      }
+    }
+
+    ValueType x        = arith.one();
+    bool      x_is_one = true;
+
+    auto i = singed_fast_type(singed_fast_type(bit_count) - 1);
+
+    while(i >= 0)
+    {
+      if(!exponent_test_bit(p, unsinged_fast_type(i)))
+      {
+        if(!x_is_one) { x = arith.sqr(x); }
+
+        --i;
+      }
+      else
+      {
+        // Find the longest window p[i...j] having at most k bits
+        // and ending with a set bit. Its value is odd.
+        auto j = (std::max)(singed_fast_type(i - singed_fast_type(k - 1U)), singed_fast_type(0));
+
+        while(!exponent_test_bit(p, unsinged_fast_type(j)))
+        {
+          ++j;
+        }
+
+        auto w = size_t(0U);
+
+        for(auto n = i; n >= j; --n)
+        {
+          w = size_t(w << 1U);
+
+          if(exponent_test_bit(p, unsinged_fast_type(n))) { w = size_t(w | 1U); }
+
+          if(!x_is_one) { x = arith.sqr(x); }
+        }
+
+        x        = (x_is_one ? g[size_t(w / 2U)] : arith.mul(x, g[size_t(w / 2U)]));
+        x_is_one = false;
+
+        i = singed_fast_type(j - 1);
+      }
+    }
+
+    return x;
+  }
+
+  template<typename DoubleWidthType>
+  class powm_double_width_arithmetic
+  {
+  public:
+    // Modular arithmetic via multiplication at double width followed by
+    // long division. This is used by powm() for moduli which are not
+    // suitable for Montgomery multiplication.
+
+    explicit constexpr powm_double_width_arithmetic(const DoubleWidthType& m) : my_m(m) { }
+
+    WIDE_INTEGER_CONSTEXPR auto one() const -> DoubleWidthType
+    {
+      return DoubleWidthType(std::uint8_t(1U));
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto mul(const DoubleWidthType& a, const DoubleWidthType& b) const -> DoubleWidthType
+    {
+      DoubleWidthType r(a);
+
+      r *= b;
+      r %= my_m;
+
+      return r;
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto sqr(const DoubleWidthType& a) const -> DoubleWidthType
+    {
+      DoubleWidthType r(a);
+
+      r *= r;
+      r %= my_m;
+
+      return r;
+    }
+
+  private:
+    const DoubleWidthType my_m;
+  };
+
+  template<typename LimbType>
+  WIDE_INTEGER_CONSTEXPR auto cnd_mask(const LimbType bit) -> LimbType
+  {
+    // Map the bit 0 or 1 to the mask of all zeros or all ones.
+    return static_cast<LimbType>(static_cast<LimbType>(0U) - bit);
+  }
+
+  template<typename LimbType>
+  WIDE_INTEGER_CONSTEXPR auto cnd_nonzero_bit(const LimbType x) -> LimbType
+  {
+    // The result is 1 if x is nonzero, otherwise 0.
+    return static_cast<LimbType>(static_cast<LimbType>(x | static_cast<LimbType>(static_cast<LimbType>(0U) - x)) >> static_cast<unsigned>(std::numeric_limits<LimbType>::digits - 1));
+  }
+
+  template<typename ConstLimbIteratorTypeA,
+           typename ConstLimbIteratorTypeB>
+  WIDE_INTEGER_CONSTEXPR auto cnd_borrow_n(      ConstLimbIteratorTypeA                                             a,
+                                                 ConstLimbIteratorTypeB                                             b,
+                                           const unsinged_fast_type                                                 count,
+                                           const typename std::iterator_traits<ConstLimbIteratorTypeA>::value_type borrow_in = 0U) -> typename std::iterator_traits<ConstLimbIteratorTypeA>::value_type
+  {
+    // Return the borrow of (a - b), without storing the difference.
+    // The borrow (0 or 1) is 1 if and only if a < b.
+
+    using local_limb_type        = typename std::iterator_traits<ConstLimbIteratorTypeA>::value_type;
+    using local_double_limb_type = typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+    auto borrow = borrow_in;
+
+    for(auto i = static_cast<size_t>(0U); i < static_cast<size_t>(count); ++i)
+    {
+      const auto diff =
+        static_cast<local_double_limb_type>
+        (
+            static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(*(a + i)) - *(b + i))
+          - borrow
+        );
+
+      borrow = static_cast<local_limb_type>(detail::make_hi<local_limb_type>(diff) & static_cast<local_limb_type>(1U));
+    }
+
+    return borrow;
+  }
+
+  template<typename LimbIteratorType,
+           typename ConstLimbIteratorType>
+  WIDE_INTEGER_CONSTEXPR auto cnd_add_n(      LimbIteratorType                                             r,
+                                              ConstLimbIteratorType                                        b,
+                                        const unsinged_fast_type                                           count,
+                                        const typename std::iterator_traits<LimbIteratorType>::value_type mask) -> typename std::iterator_traits<LimbIteratorType>::value_type
+  {
+    // Add (b & mask) to r without branching on the mask and
+    // return the carry.
+
+    using local_limb_type        = typename std::iterator_traits<LimbIteratorType>::value_type;
+    using local_double_limb_type = typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+    auto carry = static_cast<local_limb_type>(0U);
+
+    for(auto i = static_cast<size_t>(0U); i < static_cast<size_t>(count); ++i)
+    {
+      const auto sum =
+        static_cast<local_double_limb_type>
+        (
+            static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(*(r + i)) + static_cast<local_limb_type>(*(b + i) & mask))
+          + carry
+        );
+
+      *(r + i) = detail::make_lo<local_limb_type>(sum);
+      carry    = detail::make_hi<local_limb_type>(sum);
+    }
+
+    return carry;
+  }
+
+  template<typename LimbIteratorType,
+           typename ConstLimbIteratorType>
+  WIDE_INTEGER_CONSTEXPR auto cnd_sub_n(      LimbIteratorType                                             r,
+                                              ConstLimbIteratorType                                        b,
+                                        const unsinged_fast_type                                           count,
+                                        const typename std::iterator_traits<LimbIteratorType>::value_type mask) -> typename std::iterator_traits<LimbIteratorType>::value_type
+  {
+    // Subtract (b & mask) from r without branching on the mask
+    // and return the borrow.
+
+    using local_limb_type        = typename std::iterator_traits<LimbIteratorType>::value_type;
+    using local_double_limb_type = typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+    auto borrow = static_cast<local_limb_type>(0U);
+
+    for(auto i = static_cast<size_t>(0U); i < static_cast<size_t>(count); ++i)
+    {
+      const auto diff =
+        static_cast<local_double_limb_type>
+        (
+            static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(*(r + i)) - static_cast<local_limb_type>(*(b + i) & mask))
+          - borrow
+        );
+
+      *(r + i) = detail::make_lo<local_limb_type>(diff);
+      borrow   = static_cast<local_limb_type>(detail::make_hi<local_limb_type>(diff) & static_cast<local_limb_type>(1U));
+    }
+
+    return borrow;
+  }
+
+  template<typename LimbIteratorType>
+  WIDE_INTEGER_CONSTEXPR void cnd_swap_n(      LimbIteratorType                                             a,
+                                               LimbIteratorType                                             b,
+                                         const unsinged_fast_type                                           count,
+                                         const typename std::iterator_traits<LimbIteratorType>::value_type mask)
+  {
+    // Swap a and b if the mask is all ones, without branching on the mask.
+
+    using local_limb_type = typename std::iterator_traits<LimbIteratorType>::value_type;
+
+    for(auto i = static_cast<size_t>(0U); i < static_cast<size_t>(count); ++i)
+    {
+      const auto x = static_cast<local_limb_type>(static_cast<local_limb_type>(*(a + i) ^ *(b + i)) & mask);
+
+      *(a + i) = static_cast<local_limb_type>(*(a + i) ^ x);
+      *(b + i) = static_cast<local_limb_type>(*(b + i) ^ x);
+    }
+  }
+
+  template<typename LimbIteratorType>
+  WIDE_INTEGER_CONSTEXPR void cnd_neg_n(      LimbIteratorType                                             r,
+                                        const unsinged_fast_type                                           count,
+                                        const typename std::iterator_traits<LimbIteratorType>::value_type mask)
+  {
+    // Negate r (in two's complement) if the mask is all ones,
+    // without branching on the mask.
+
+    using local_limb_type = typename std::iterator_traits<LimbIteratorType>::value_type;
+
+    auto carry = static_cast<local_limb_type>(mask & static_cast<local_limb_type>(1U));
+
+    for(auto i = static_cast<size_t>(0U); i < static_cast<size_t>(count); ++i)
+    {
+      const auto x = static_cast<local_limb_type>(static_cast<local_limb_type>(*(r + i) ^ mask) + carry);
+
+      carry = static_cast<local_limb_type>(carry & static_cast<local_limb_type>(x == 0U));
+
+      *(r + i) = x;
+    }
+  }
+
+  template<typename LimbIteratorType>
+  WIDE_INTEGER_CONSTEXPR void cnd_shr1_n(      LimbIteratorType                                             r,
+                                         const unsinged_fast_type                                           count,
+                                         const typename std::iterator_traits<LimbIteratorType>::value_type top_bit)
+  {
+    // Shift r right by one bit and shift in the top bit (0 or 1).
+
+    using local_limb_type = typename std::iterator_traits<LimbIteratorType>::value_type;
+
+    constexpr auto limb_digits = static_cast<unsigned>(std::numeric_limits<local_limb_type>::digits);
+
+    for(auto i = static_cast<size_t>(0U); i < static_cast<size_t>(count); ++i)
+    {
+      const auto next =
+        ((size_t(i + 1U) < static_cast<size_t>(count)) ? *(r + size_t(i + 1U)) : static_cast<local_limb_type>(top_bit));
+
+      *(r + i) = static_cast<local_limb_type>(static_cast<local_limb_type>(*(r + i) >> 1U) | static_cast<local_limb_type>(next << static_cast<unsigned>(limb_digits - 1U)));
+    }
+  }
+
+  template<typename LimbIteratorType>
+  WIDE_INTEGER_CONSTEXPR auto cnd_shl1_n(      LimbIteratorType                                             r,
+                                         const unsinged_fast_type                                           count,
+                                         const typename std::iterator_traits<LimbIteratorType>::value_type bottom_bit) -> typename std::iterator_traits<LimbIteratorType>::value_type
+  {
+    // Shift r left by one bit, shift in the bottom bit (0 or 1)
+    // and return the bit shifted out.
+
+    using local_limb_type = typename std::iterator_traits<LimbIteratorType>::value_type;
+
+    constexpr auto limb_digits = static_cast<unsigned>(std::numeric_limits<local_limb_type>::digits);
+
+    auto carry = bottom_bit;
+
+    for(auto i = static_cast<size_t>(0U); i < static_cast<size_t>(count); ++i)
+    {
+      const local_limb_type x = *(r + i);
+
+      *(r + i) = static_cast<local_limb_type>(static_cast<local_limb_type>(x << 1U) | carry);
+
+      carry = static_cast<local_limb_type>(x >> static_cast<unsigned>(limb_digits - 1U));
+    }
+
+    return carry;
+  }
+
+  } // namespace detail
+
+  namespace const_time {
+
+  // Branch-free counterparts of comparison, selection and reduction
+  // for secret values. The sequence of operations and memory accesses
+  // depends on the width of the type only, never on the values.
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto is_zero(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> bool
+  {
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    auto acc = static_cast<local_limb_type>(0U);
+
+    for(auto i = static_cast<size_t>(0U); i < static_cast<size_t>(local_wide_integer_type::number_of_limbs); ++i)
+    {
+      acc = static_cast<local_limb_type>(acc | *(x.crepresentation().cbegin() + i));
+    }
+
+    return static_cast<bool>(static_cast<local_limb_type>(detail::cnd_nonzero_bit(acc) ^ static_cast<local_limb_type>(1U)));
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto equal(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                    const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> bool
+  {
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    auto acc = static_cast<local_limb_type>(0U);
+
+    for(auto i = static_cast<size_t>(0U); i < static_cast<size_t>(local_wide_integer_type::number_of_limbs); ++i)
+    {
+      acc = static_cast<local_limb_type>(acc | static_cast<local_limb_type>(*(a.crepresentation().cbegin() + i) ^ *(b.crepresentation().cbegin() + i)));
+    }
+
+    return static_cast<bool>(static_cast<local_limb_type>(detail::cnd_nonzero_bit(acc) ^ static_cast<local_limb_type>(1U)));
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto less(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                   const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> bool
+  {
+    // The result is the borrow of (a - b). For signed types, flipping
+    // the sign bits of both operands maps the signed order to the
+    // unsigned order, which is done here for the borrow of the top limb.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    constexpr auto count = static_cast<unsinged_fast_type>(local_wide_integer_type::number_of_limbs);
+
+    constexpr auto sign_flip =
+      static_cast<local_limb_type>(IsSigned ? static_cast<local_limb_type>(static_cast<local_limb_type>(1U) << static_cast<unsigned>(std::numeric_limits<local_limb_type>::digits - 1)) : static_cast<local_limb_type>(0U));
+
+    const auto borrow = detail::cnd_borrow_n(a.crepresentation().cbegin(), b.crepresentation().cbegin(), static_cast<unsinged_fast_type>(count - 1U));
+
+    const auto a_top = static_cast<local_limb_type>(*(a.crepresentation().cbegin() + size_t(count - 1U)) ^ sign_flip);
+    const auto b_top = static_cast<local_limb_type>(*(b.crepresentation().cbegin() + size_t(count - 1U)) ^ sign_flip);
+
+    const auto top_borrow = detail::cnd_borrow_n(&a_top, &b_top, static_cast<unsinged_fast_type>(1U), borrow);
+
+    return static_cast<bool>(top_borrow);
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto compare(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                      const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> std::int_fast8_t
+  {
+    // The result is -1, 0 or 1, as from the member function compare.
+    return static_cast<std::int_fast8_t>(static_cast<int>(less(b, a)) - static_cast<int>(less(a, b)));
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto select(const bool                                                   condition,
+                                     const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                     const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // The result is a if the condition is true, otherwise b.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    const auto mask = detail::cnd_mask(static_cast<local_limb_type>(condition));
+
+    local_wide_integer_type result(b);
+
+    for(auto i = static_cast<size_t>(0U); i < static_cast<size_t>(local_wide_integer_type::number_of_limbs); ++i)
+    {
+      const auto x = static_cast<local_limb_type>(static_cast<local_limb_type>(*(a.crepresentation().cbegin() + i) ^ *(b.crepresentation().cbegin() + i)) & mask);
+
+      *(result.representation().begin() + i) = static_cast<local_limb_type>(*(result.crepresentation().cbegin() + i) ^ x);
+    }
+
+    return result;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR void cswap(const bool                                             condition,
+                                          uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                          uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b)
+  {
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    detail::cnd_swap_n(a.representation().begin(),
+                       b.representation().begin(),
+                       static_cast<unsinged_fast_type>(local_wide_integer_type::number_of_limbs),
+                       detail::cnd_mask(static_cast<local_limb_type>(condition)));
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto mod(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                  const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate a % m for nonzero m, with both values taken as unsigned,
+    // by binary long division with a fixed number of Width2 steps.
+    // Each step shifts in the next bit of a and subtracts m when
+    // the running remainder, including the bit shifted out, is at least m.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    constexpr auto count       = static_cast<unsinged_fast_type>(local_wide_integer_type::number_of_limbs);
+    constexpr auto limb_digits = static_cast<unsinged_fast_type>(std::numeric_limits<local_limb_type>::digits);
+
+    local_wide_integer_type r;
+
+    for(auto i = static_cast<unsinged_fast_type>(Width2); i > 0U; --i)
+    {
+      const auto bit_index = static_cast<unsinged_fast_type>(i - 1U);
+
+      const auto a_bit =
+        static_cast<local_limb_type>(static_cast<local_limb_type>(*(a.crepresentation().cbegin() + size_t(bit_index / limb_digits)) >> static_cast<unsigned>(bit_index % limb_digits)) & static_cast<local_limb_type>(1U));
+
+      const auto top_bit = detail::cnd_shl1_n(r.representation().begin(), count, a_bit);
+
+      const auto borrow = detail::cnd_borrow_n(r.crepresentation().cbegin(), m.crepresentation().cbegin(), count);
+
+      const auto mask = detail::cnd_mask(static_cast<local_limb_type>(static_cast<local_limb_type>(top_bit | static_cast<local_limb_type>(borrow ^ static_cast<local_limb_type>(1U))) & static_cast<local_limb_type>(1U)));
+
+      static_cast<void>(detail::cnd_sub_n(r.representation().begin(), m.crepresentation().cbegin(), count, mask));
+    }
+
+    return r;
+  }
+
+  } // namespace const_time
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  class montgomery_context
+  {
+  public:
+    using uint_type        = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using limb_type        = typename uint_type::limb_type;
+    using double_limb_type = typename uint_type::double_limb_type;
+
+    // Set up Montgomery arithmetic for the odd modulus m.
+    // The Montgomery radix is R = b^k, where b is the limb base
+    // and k is the number of significant limbs in m.
+    explicit WIDE_INTEGER_CONSTEXPR montgomery_context(const uint_type& m)
+      : my_m      (m),
+        my_r2     (),
+        my_one    (),
+        my_m_prime(compute_m_prime(*m.crepresentation().cbegin())),
+        my_count  (compute_count(m))
+    {
+      using local_double_width_type = typename uint_type::double_width_type;
+
+      // Compute (R mod m) and (R^2 mod m) once at double width.
+      local_double_width_type r(std::uint8_t(1U));
+
+      r <<= unsinged_fast_type(my_count * unsinged_fast_type(std::numeric_limits<limb_type>::digits));
+      r  %= local_double_width_type(my_m);
+
+      my_one = uint_type(r);
+
+      r *= r;
+      r %= local_double_width_type(my_m);
+
+      my_r2 = uint_type(r);
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto modulus() const -> const uint_type& { return my_m; }
+
+    // The Montgomery representation of one, which is (R mod m).
+    WIDE_INTEGER_CONSTEXPR auto one() const -> const uint_type& { return my_one; }
+
+    WIDE_INTEGER_CONSTEXPR auto to_montgomery(const uint_type& a) const -> uint_type
+    {
+      return mul(((a < my_m) ? a : (a % my_m)), my_r2);
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto from_montgomery(const uint_type& a) const -> uint_type
+    {
+      return mul(a, uint_type(std::uint8_t(1U)));
+    }
+
+    // Calculate (a * b) / R mod m for a and b in Montgomery representation.
+    WIDE_INTEGER_CONSTEXPR auto mul(const uint_type& a, const uint_type& b) const -> uint_type
+    {
+      uint_type t;
+
+      eval_subtract_m_if_needed(t, eval_mul_cios(t, a, b));
+
+      return t;
+    }
+
+    // Calculate (a * b) / R mod m as in mul, but with the final
+    // subtraction of m done without branching on the values.
+    WIDE_INTEGER_CONSTEXPR auto mul_ct(const uint_type& a, const uint_type& b) const -> uint_type
+    {
+      uint_type t;
+
+      eval_subtract_m_masked(t, eval_mul_cios(t, a, b));
+
+      return t;
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto sqr(const uint_type& a) const -> uint_type
+    {
+      uint_type t;
+
+      eval_sqr_sos(t, a);
+
+      return t;
+    }
+
+    template<typename OtherIntegralTypeP>
+    WIDE_INTEGER_CONSTEXPR auto pow(const uint_type&          b,
+                                    const OtherIntegralTypeP& p,
+                                    const unsinged_fast_type  window_bits = 0U) const -> uint_type
+    {
+      // Calculate (b ^ p) % m. The argument b and the result
+      // are in normal (non-Montgomery) representation.
+      // The window size of the exponentiation is chosen
+      // automatically from the size of p if window_bits is zero.
+
+      return from_montgomery(detail::pow_sliding_window(*this, to_montgomery(b), p, window_bits));
+    }
+
+    template<typename OtherIntegralTypeP>
+    WIDE_INTEGER_CONSTEXPR auto pow_ct(const uint_type& b, const OtherIntegralTypeP& p) const -> uint_type
+    {
+      // Calculate (b ^ p) % m with the Montgomery ladder, for secret
+      // values of b and p. Each of the digits of the type of p costs
+      // one multiplication and one squaring, regardless of its value.
+      // The pair (x0, x1) = (b^k, b^(k+1)) is swapped without branching
+      // whenever the exponent bit changes. Squaring is done with mul_ct,
+      // since the carry propagation of sqr depends on the values.
+
+      uint_type x0 = my_one;
+      uint_type x1 = mul_ct(const_time::mod(b, my_m), my_r2);
+
+      auto bit_prev = limb_type(0U);
+
+      for(auto i = unsinged_fast_type(std::numeric_limits<OtherIntegralTypeP>::digits); i > 0U; --i)
+      {
+        const auto bit = limb_type(detail::exponent_test_bit(p, unsinged_fast_type(i - 1U)));
+
+        detail::cnd_swap_n(x0.representation().begin(), x1.representation().begin(), my_count, detail::cnd_mask(limb_type(bit ^ bit_prev)));
+
+        x1 = mul_ct(x0, x1);
+        x0 = mul_ct(x0, x0);
+
+        bit_prev = bit;
+      }
+
+      detail::cnd_swap_n(x0.representation().begin(), x1.representation().begin(), my_count, detail::cnd_mask(bit_prev));
+
+      return mul_ct(x0, uint_type(std::uint8_t(1U)));
+    }
+
+  private:
+    uint_type          my_m;
+    uint_type          my_r2;
+    uint_type          my_one;
+    limb_type          my_m_prime;
+    unsinged_fast_type my_count;
+
+    static WIDE_INTEGER_CONSTEXPR auto compute_m_prime(const limb_type m0) -> limb_type
+    {
+      // Compute -m^-1 mod b with the Newton iteration x = x(2 - m0 x).
+      // The initial guess x = m0 is correct to 3 bits for odd m0,
+      // and each step doubles the number of correct low-order bits.
+
+      limb_type x = m0;
+
+      for(auto bits = unsinged_fast_type(3U); bits < unsinged_fast_type(std::numeric_limits<limb_type>::digits); bits = unsinged_fast_type(bits * 2U))
+      {
+        x = limb_type(x * limb_type(limb_type(2U) - limb_type(m0 * x)));
+      }
+
+      return detail::negate(x);
+    }
+
+    static WIDE_INTEGER_CONSTEXPR auto compute_count(const uint_type& m) -> unsinged_fast_type
+    {
+      auto count = unsinged_fast_type(uint_type::number_of_limbs);
+
+      while((count > 1U) && (*(m.crepresentation().cbegin() + size_t(count - 1U)) == 0U))
+      {
+        --count;
+      }
+
+      return count;
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto eval_mul_cios(uint_type& t, const uint_type& a, const uint_type& b) const -> limb_type
+    {
+      // Montgomery multiplication using coarsely integrated operand scanning (CIOS).
+      // See Sect. 4 of C.K. Koc, T. Acar and B.S. Kaliski Jr., "Analyzing and
+      // Comparing Montgomery Multiplication Algorithms", IEEE Micro 16(3), 1996.
+      // Each outer step adds a * b_i and immediately reduces by one limb,
+      // so the running sum never exceeds (k + 2) limbs, the upper two of
+      // which are held in t_k and t_k1. The result t < 2m is returned
+      // in t and the limb t_k, for the final subtraction of m.
+
+      using local_difference_type = typename uint_type::representation_type::difference_type;
+
+      const auto pa = a.crepresentation().cbegin();
+      const auto pb = b.crepresentation().cbegin();
+      const auto pm = my_m.crepresentation().cbegin();
+            auto pt = t.representation().begin();
+
+      std::fill(t.representation().begin(), t.representation().end(), limb_type(0U));
+
+      limb_type t_k  = 0U;
+      limb_type t_k1 = 0U;
+
+      for(unsinged_fast_type i = 0U; i < my_count; ++i)
+      {
+        // Add a * b_i to t.
+        const limb_type bi = *(pb + local_difference_type(i));
+
+        double_limb_type carry = 0U;
+
+        for(unsinged_fast_type j = 0U; j < my_count; ++j)
+        {
+          carry = double_limb_type(carry + double_limb_type(double_limb_type(*(pa + local_difference_type(j))) * bi));
+          carry = double_limb_type(carry + *(pt + local_difference_type(j)));
+
+          *(pt + local_difference_type(j)) = limb_type(carry);
+          carry                            = detail::make_hi<limb_type>(carry);
+        }
+
+        carry = double_limb_type(carry + t_k);
+
+        t_k  = limb_type(carry);
+        t_k1 = detail::make_hi<limb_type>(carry);
+
+        // Add u * m to t, where u is chosen such that
+        // the lowest limb vanishes. Then shift t down by one limb.
+        const auto u = limb_type(*pt * my_m_prime);
+
+        carry = double_limb_type(double_limb_type(double_limb_type(u) * *pm) + *pt);
+        carry = detail::make_hi<limb_type>(carry);
+
+        for(unsinged_fast_type j = 1U; j < my_count; ++j)
+        {
+          carry = double_limb_type(carry + double_limb_type(double_limb_type(u) * *(pm + local_difference_type(j))));
+          carry = double_limb_type(carry + *(pt + local_difference_type(j)));
+
+          *(pt + local_difference_type(j - 1U)) = limb_type(carry);
+          carry                                 = detail::make_hi<limb_type>(carry);
+        }
+
+        carry = double_limb_type(carry + t_k);
+
+        *(pt + local_difference_type(my_count - 1U)) = limb_type(carry);
+
+        t_k = limb_type(t_k1 + detail::make_hi<limb_type>(carry));
+      }
+
+      return t_k;
+    }
+
+    WIDE_INTEGER_CONSTEXPR void eval_sqr_sos(uint_type& t, const uint_type& a) const
+    {
+      // Montgomery squaring using separated operand scanning (SOS).
+      // The full 2k-limb square is formed first, computing each cross
+      // product a_i * a_j (i < j) only once. It is then reduced by one
+      // limb per step as in Sect. 3 of Koc, Acar and Kaliski (see above).
+
+      using scratch_array_type =
+        detail::scratch_array<limb_type, size_t(uint_type::number_of_limbs * 2U) + 1U, AllocatorType>;
+
+      using local_difference_type = typename uint_type::representation_type::difference_type;
+      using scratch_difference_type = typename scratch_array_type::difference_type;
+
+      const auto pa = a.crepresentation().cbegin();
+      const auto pm = my_m.crepresentation().cbegin();
+
+      scratch_array_type s { };
+
+      const auto ps = s.begin();
+
+      std::fill(s.begin(), s.end(), limb_type(0U));
+
+      // Sum the cross products a_i * a_j with i < j.
+      for(unsinged_fast_type i = 0U; i < my_count; ++i)
+      {
+        const limb_type ai = *(pa + local_difference_type(i));
+
+        double_limb_type carry = 0U;
+
+        for(unsinged_fast_type j = unsinged_fast_type(i + 1U); j < my_count; ++j)
+        {
+          carry = double_limb_type(carry + double_limb_type(double_limb_type(ai) * *(pa + local_difference_type(j))));
+          carry = double_limb_type(carry + *(ps + scratch_difference_type(i + j)));
+
+          *(ps + scratch_difference_type(i + j)) = limb_type(carry);
+          carry                                  = detail::make_hi<limb_type>(carry);
+        }
+
+        *(ps + scratch_difference_type(i + my_count)) = limb_type(carry);
+      }
+
+      // Double the cross products and add the diagonal squares a_i * a_i.
+      limb_type carry_bit = 0U;
+
+      for(unsinged_fast_type i = 0U; i < unsinged_fast_type(my_count * 2U); ++i)
+      {
+        const limb_type si = *(ps + scratch_difference_type(i));
+
+        *(ps + scratch_difference_type(i)) = limb_type(limb_type(si << 1U) | carry_bit);
+
+        carry_bit = limb_type(si >> unsigned(std::numeric_limits<limb_type>::digits - 1));
+      }
+
+      double_limb_type carry = 0U;
+
+      for(unsinged_fast_type i = 0U; i < my_count; ++i)
+      {
+        const auto ai_squared = double_limb_type(double_limb_type(*(pa + local_difference_type(i))) * *(pa + local_difference_type(i)));
+
+        carry = double_limb_type(carry + limb_type(ai_squared));
+        carry = double_limb_type(carry + *(ps + scratch_difference_type(i * 2U)));
+
+        *(ps + scratch_difference_type(i * 2U)) = limb_type(carry);
+        carry                                   = detail::make_hi<limb_type>(carry);
+
+        carry = double_limb_type(carry + detail::make_hi<limb_type>(ai_squared));
+        carry = double_limb_type(carry + *(ps + scratch_difference_type((i * 2U) + 1U)));
+
+        *(ps + scratch_difference_type((i * 2U) + 1U)) = limb_type(carry);
+        carry                                          = detail::make_hi<limb_type>(carry);
+      }
+
+      // Reduce: add u * m * b^i such that limb i vanishes, for each i < k.
+      for(unsinged_fast_type i = 0U; i < my_count; ++i)
+      {
+        const auto u = limb_type(*(ps + scratch_difference_type(i)) * my_m_prime);
+
+        carry = 0U;
+
+        for(unsinged_fast_type j = 0U; j < my_count; ++j)
+        {
+          carry = double_limb_type(carry + double_limb_type(double_limb_type(u) * *(pm + local_difference_type(j))));
+          carry = double_limb_type(carry + *(ps + scratch_difference_type(i + j)));
+
+          *(ps + scratch_difference_type(i + j)) = limb_type(carry);
+          carry                                  = detail::make_hi<limb_type>(carry);
+        }
+
+        for(auto j = unsinged_fast_type(i + my_count); (carry != 0U) && (j <= unsinged_fast_type(my_count * 2U)); ++j)
+        {
+          carry = double_limb_type(carry + *(ps + scratch_difference_type(j)));
+
+          *(ps + scratch_difference_type(j)) = limb_type(carry);
+          carry                              = detail::make_hi<limb_type>(carry);
+        }
+      }
+
+      std::fill(t.representation().begin(), t.representation().end(), limb_type(0U));
+
+      std::copy(ps + scratch_difference_type(my_count),
+                ps + scratch_difference_type(my_count * 2U),
+                t.representation().begin());
+
+      eval_subtract_m_if_needed(t, *(ps + scratch_difference_type(my_count * 2U)));
+    }
+
+    WIDE_INTEGER_CONSTEXPR void eval_subtract_m_if_needed(uint_type& t, const limb_type t_k) const
+    {
+      // Here t < 2m. Subtract m once, if needed. The subtraction is
+      // restricted to the lower k limbs, which discards t_k.
+
+      using local_difference_type = typename uint_type::representation_type::difference_type;
+
+      if((t_k != 0U) || (!(t < my_m)))
+      {
+        const auto pm = my_m.crepresentation().cbegin();
+              auto pt = t.representation().begin();
+
+        limb_type has_borrow = 0U;
+
+        for(unsinged_fast_type j = 0U; j < my_count; ++j)
+        {
+          const auto uv_as_ularge = double_limb_type(double_limb_type(double_limb_type(*(pt + local_difference_type(j))) - *(pm + local_difference_type(j))) - has_borrow);
+
+          has_borrow = (detail::make_hi<limb_type>(uv_as_ularge) != limb_type(0U)) ? 1U : 0U;
+
+          *(pt + local_difference_type(j)) = limb_type(uv_as_ularge);
+        }
+      }
+    }
+
+    WIDE_INTEGER_CONSTEXPR void eval_subtract_m_masked(uint_type& t, const limb_type t_k) const
+    {
+      // Here t < 2m, as in eval_subtract_m_if_needed. Subtract m under
+      // a mask, which is set if t_k is nonzero or if t - m does not borrow.
+
+      const auto borrow = detail::cnd_borrow_n(t.crepresentation().cbegin(), my_m.crepresentation().cbegin(), my_count);
+
+      const auto mask = detail::cnd_mask(limb_type(limb_type(t_k | limb_type(borrow ^ 1U)) & 1U));
+
+      static_cast<void>(detail::cnd_sub_n(t.representation().begin(), my_m.crepresentation().cbegin(), my_count, mask));
+    }
+  };
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  class barrett_reducer<uintwide_t<Width2, LimbType, AllocatorType, false>>
+  {
+  public:
+    using uint_type         = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using double_width_type = typename uint_type::double_width_type;
+    using limb_type         = typename uint_type::limb_type;
+    using double_limb_type  = typename uint_type::double_limb_type;
+
+    // Set up Barrett reduction for the nonzero modulus m. The reciprocal
+    // mu = floor((b^(2k) - 1) / m) is computed once, where b is the limb
+    // base and k is the number of significant limbs in m.
+    explicit WIDE_INTEGER_CONSTEXPR barrett_reducer(const uint_type& m)
+      : my_m    (m),
+        my_mu   (),
+        my_count(compute_count(m))
+    {
+      constexpr auto limb_digits = unsinged_fast_type(std::numeric_limits<limb_type>::digits);
+
+      double_width_type b2k_minus_one((std::numeric_limits<double_width_type>::max)());
+
+      b2k_minus_one >>= unsinged_fast_type(unsinged_fast_type(unsinged_fast_type(uint_type::number_of_limbs) - my_count) * unsinged_fast_type(2U * limb_digits));
+
+      my_mu = b2k_minus_one / double_width_type(my_m);
+    }
+
+    WIDE_INTEGER_CONSTEXPR auto modulus() const -> const uint_type& { return my_m; }
+
+    // Calculate x % m.
+    WIDE_INTEGER_CONSTEXPR auto reduce(const uint_type& x) const -> uint_type
+    {
+      return (is_in_range(x) ? eval_reduce(x) : (x % my_m));
+    }
+
+    // Calculate x % m for x at double width, such as the product
+    // of two values which have already been reduced modulo m.
+    WIDE_INTEGER_CONSTEXPR auto reduce(const double_width_type& x) const -> uint_type
+    {
+      return (is_in_range(x) ? eval_reduce(x) : uint_type(x % double_width_type(my_m)));
+    }
+
+    // Reduce each element in the range [first, last) and store
+    // the results in the range beginning at result. In-place
+    // reduction is supported with result equal to first.
+    template<typename InputIterator,
+             typename OutputIterator>
+    WIDE_INTEGER_CONSTEXPR auto reduce(InputIterator first, InputIterator last, OutputIterator result) const -> OutputIterator
+    {
+      while(first != last)
+      {
+        *result = reduce(*first);
+
+        ++first;
+        ++result;
+      }
+
+      return result;
+    }
+
+  private:
+    // Scratch storage for (k + 3) limbs.
+    using scratch_array_type =
+      detail::scratch_array<limb_type, uint_type::number_of_limbs + 3U, AllocatorType>;
+
+    uint_type          my_m;
+    double_width_type  my_mu;
+    unsinged_fast_type my_count;
+
+    static WIDE_INTEGER_CONSTEXPR auto compute_count(const uint_type& m) -> unsinged_fast_type
+    {
+      auto count = unsinged_fast_type(uint_type::number_of_limbs);
+
+      while((count > 1U) && (*(m.crepresentation().cbegin() + size_t(count - 1U)) == 0U))
+      {
+        --count;
+      }
+
+      return count;
+    }
+
+    template<typename OtherWideIntegerType>
+    static WIDE_INTEGER_CONSTEXPR auto limb_at(const OtherWideIntegerType& u, const unsinged_fast_type i, const unsinged_fast_type count) -> limb_type
+    {
+      return ((i < count) ? *(u.crepresentation().cbegin() + size_t(i)) : limb_type(0U));
+    }
+
+    template<typename OtherWideIntegerType>
+    WIDE_INTEGER_CONSTEXPR auto is_in_range(const OtherWideIntegerType& x) const -> bool
+    {
+      // The reduction requires x < b^(2k).
+
+      for(auto i = unsinged_fast_type(my_count * 2U); i < unsinged_fast_type(OtherWideIntegerType::number_of_limbs); ++i)
+      {
+        if(*(x.crepresentation().cbegin() + size_t(i)) != 0U)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    template<typename OtherWideIntegerType>
+    WIDE_INTEGER_CONSTEXPR auto eval_reduce(const OtherWideIntegerType& x) const -> uint_type
+    {
+      // Barrett reduction, see Algorithm 14.42 in A.J. Menezes, P.C. van Oorschot
+      // and S.A. Vanstone, "Handbook of Applied Cryptography", CRC Press, 1996.
+      // Only the partial products needed for the upper part of q1 * mu and the
+      // lower part of q3 * m are computed (see also Note 14.44 therein).
+      // The truncated quotient q3 is at most a few units too small, which is
+      // corrected by the final subtraction(s) of m.
+
+      constexpr auto x_count = unsinged_fast_type(OtherWideIntegerType::number_of_limbs);
+      constexpr auto n_count = unsinged_fast_type(uint_type::number_of_limbs);
+      constexpr auto u_count = unsinged_fast_type(double_width_type::number_of_limbs);
+
+      const auto k   = my_count;
+      const auto kp1 = unsinged_fast_type(k + 1U);
+      const auto km1 = unsinged_fast_type(k - 1U);
+
+      // Columns (k - 1) ... (2k + 1) of q1 * mu, with q1 = floor(x / b^(k - 1)).
+      // The quotient estimate q3 = floor(q1 * mu / b^(k + 1)) is found in q[2 ... k + 2].
+      scratch_array_type q { };
+
+      for(unsinged_fast_type i = 0U; i < kp1; ++i)
+      {
+        const limb_type q1_i = limb_at(x, unsinged_fast_type(i + km1), x_count);
+
+        if(q1_i != 0U)
+        {
+          double_limb_type carry = 0U;
+
+          for(unsinged_fast_type j = ((i < km1) ? unsinged_fast_type(km1 - i) : unsinged_fast_type(0U)); j < kp1; ++j)
+          {
+            carry = double_limb_type(carry + double_limb_type(double_limb_type(q1_i) * limb_at(my_mu, j, u_count)));
+            carry = double_limb_type(carry + q[size_t((i + j) - km1)]);
+
+            q[size_t((i + j) - km1)] = limb_type(carry);
+            carry                    = detail::make_hi<limb_type>(carry);
+          }
+
+          q[size_t(i + 2U)] = limb_type(carry);
+        }
+      }
+
+      // r = (q3 * m) mod b^(k + 1).
+      scratch_array_type r { };
+
+      for(unsinged_fast_type i = 0U; i < kp1; ++i)
+      {
+        const limb_type q3_i = q[size_t(i + 2U)];
+
+        if(q3_i != 0U)
+        {
+          double_limb_type carry = 0U;
+
+          for(unsinged_fast_type j = 0U; j < unsinged_fast_type(kp1 - i); ++j)
+          {
+            carry = double_limb_type(carry + double_limb_type(double_limb_type(q3_i) * limb_at(my_m, j, n_count)));
+            carry = double_limb_type(carry + r[size_t(i + j)]);
+
+            r[size_t(i + j)] = limb_type(carry);
+            carry            = detail::make_hi<limb_type>(carry);
+          }
+        }
+      }
+
+      // r = (x mod b^(k + 1)) - r, taken modulo b^(k + 1).
+      limb_type has_borrow = 0U;
+
+      for(unsinged_fast_type i = 0U; i < kp1; ++i)
+      {
+        const auto uv_as_ularge = double_limb_type(double_limb_type(double_limb_type(limb_at(x, i, x_count)) - r[size_t(i)]) - has_borrow);
+
+        has_borrow = (detail::make_hi<limb_type>(uv_as_ularge) != limb_type(0U)) ? 1U : 0U;
+
+        r[size_t(i)] = limb_type(uv_as_ularge);
+      }
+
+      // While r >= m, subtract m.
+      for(;;)
+      {
+        auto i = singed_fast_type(k);
+
+        while((i >= 0) && (r[size_t(i)] == limb_at(my_m, unsinged_fast_type(i), n_count)))
+        {
+          --i;
+        }
+
+        if((i >= 0) && (r[size_t(i)] < limb_at(my_m, unsinged_fast_type(i), n_count)))
+        {
+          break;
+        }
+
+        has_borrow = 0U;
+
+        for(unsinged_fast_type j = 0U; j < kp1; ++j)
+        {
+          const auto uv_as_ularge = double_limb_type(double_limb_type(double_limb_type(r[size_t(j)]) - limb_at(my_m, j, n_count)) - has_borrow);
+
+          has_borrow = (detail::make_hi<limb_type>(uv_as_ularge) != limb_type(0U)) ? 1U : 0U;
+
+          r[size_t(j)] = limb_type(uv_as_ularge);
+        }
+      }
+
+      uint_type result;
+
+      std::copy(r.cbegin(), r.cbegin() + size_t(k), result.representation().begin());
+
+      return result;
+    }
+  };
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  WIDE_INTEGER_CONSTEXPR auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, false>&                  x,
+                                        const barrett_reducer<uintwide_t<Width2, LimbType, AllocatorType, false>>& reducer) -> uintwide_t<Width2, LimbType, AllocatorType, false>
+  {
+    return reducer.reduce(x);
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  WIDE_INTEGER_CONSTEXPR auto operator%(const uintwide_t<size_t(Width2 * 2U), LimbType, AllocatorType, false>&     x,
+                                        const barrett_reducer<uintwide_t<Width2, LimbType, AllocatorType, false>>& reducer) -> uintwide_t<Width2, LimbType, AllocatorType, false>
+  {
+    return reducer.reduce(x);
+  }
+
+  template<typename OtherIntegralTypeP,
+           typename OtherIntegralTypeM,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto powm(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b,
+                                   const OtherIntegralTypeP& p,
+                                   const OtherIntegralTypeM& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate (b ^ p) % m.
+
+    using local_normal_width_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_double_width_type = typename local_normal_width_type::double_width_type;
+    using local_limb_type         = typename local_normal_width_type::limb_type;
+
+          local_normal_width_type result;
+          local_double_width_type y      (b);
+    const local_double_width_type m_local(m);
+          auto                    p0     (static_cast<local_limb_type>(p));
+
+    if((p0 == 0U) && (p == OtherIntegralTypeP(0)))
+    {
+      result = local_normal_width_type((m != 1U) ? std::uint8_t(1U) : std::uint8_t(0U));
+    }
+    else if((p0 == 1U) && (p == OtherIntegralTypeP(1)))
+    {
+      result = b % m;
+    }
+    else if((p0 == 2U) && (p == OtherIntegralTypeP(2)))
+    {
+      y *= y;
+      y %= m_local;
+
+      result = local_normal_width_type(y);
+    }
+    else if(   ((*m_local.crepresentation().cbegin() & 1U) != 0U)
+            && (!local_double_width_type::is_neg(m_local))
+            && (msb(m_local) < unsinged_fast_type(Width2))
+            && (!local_normal_width_type::is_neg(b)))
+    {
+      // For an odd modulus which fits in the normal width, use Montgomery
+      // multiplication at native width. This avoids both the double-width
+      // multiplication as well as the full Knuth division in each step.
+
+      using local_montgomery_context_type = montgomery_context<Width2, LimbType, AllocatorType>;
+      using local_unsigned_width_type     = typename local_montgomery_context_type::uint_type;
+
+      const local_normal_width_type       m_normal  (m_local);
+      const local_unsigned_width_type     m_unsigned(m_normal);
+      const local_montgomery_context_type ctx       (m_unsigned);
+
+      result = local_normal_width_type(ctx.pow(local_unsigned_width_type(b), p));
+    }
+    else
+    {
+      const detail::powm_double_width_arithmetic<local_double_width_type> arith(m_local);
+
+      y %= m_local;
+
+      result = local_normal_width_type(detail::pow_sliding_window(arith, y, p, 0U));
+    }
+
+    return result;
+  }
+
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto powm_ct(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b,
+                                      const OtherIntegralTypeP&                                    p,
+                                      const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate (b ^ p) % m in constant time for secret values of b and p
+    // with the Montgomery ladder (see montgomery_context::pow_ct).
+    // The modulus m must be odd and positive. It is not secret.
+    // The values of b and p are taken as unsigned.
+
+    using local_montgomery_context_type = montgomery_context<Width2, LimbType, AllocatorType>;
+    using local_unsigned_width_type     = typename local_montgomery_context_type::uint_type;
+
+    const local_montgomery_context_type ctx(static_cast<local_unsigned_width_type>(m));
+
+    return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(ctx.pow_ct(static_cast<local_unsigned_width_type>(b), p));
+  }
+
+  namespace detail {
+
+  template<typename UnsignedShortType>
+  WIDE_INTEGER_CONSTEXPR auto integer_gcd_reduce_short(UnsignedShortType u, UnsignedShortType v) -> UnsignedShortType
+  {
+    // This implementation of GCD reduction is based on an
+    // adaptation of existing code from Boost.Multiprecision.
+
+    for(;;)
+    {
+      if(u > v)
+      {
+        std::swap(u, v);
+      }
+
+      if(u == v)
+      {
+        break;
+      }
+
+      v  -= u;
+      v >>= detail::lsb_helper(v);
+    }
+
+    return u;
+  }
+
+  template<typename UnsignedLargeType>
+  WIDE_INTEGER_CONSTEXPR auto integer_gcd_reduce_large(UnsignedLargeType u, UnsignedLargeType v) -> UnsignedLargeType
+  {
+    // This implementation of GCD reduction is based on an
+    // adaptation of existing code from Boost.Multiprecision.
+
+    using local_ularge_type = UnsignedLargeType;
+    using local_ushort_type = typename detail::uint_type_helper<size_t(std::numeric_limits<local_ularge_type>::digits / 2)>::exact_unsigned_type;
+
+    for(;;)
+    {
+      if(u > v)
+      {
+        std::swap(u, v);
+      }
+
+      if(u == v)
+      {
+        break;
+      }
+
+      if(v <= local_ularge_type((std::numeric_limits<local_ushort_type>::max)()))
+      {
+        u = integer_gcd_reduce_short(local_ushort_type(v),
+                                     local_ushort_type(u));
+
+        break;
+      }
+
+      v -= u;
+
+      while((local_ushort_type(v) & 1U) == 0U)
+      {
+        v >>= 1U;
+      }
+    }
+
+    return u;
+  }
+
+  template<typename LimbIteratorType>
+  WIDE_INTEGER_CONSTEXPR auto gcd_lehmer_top_bits(      LimbIteratorType   p,
+                                                  const unsinged_fast_type count,
+                                                  const unsinged_fast_type h) -> typename detail::uint_type_helper<size_t(std::numeric_limits<typename std::iterator_traits<LimbIteratorType>::value_type>::digits * 2)>::exact_unsigned_type
+  {
+    // Extract the bits from position h upward of the count limbs
+    // at p into a double limb. These must fit in the double limb.
+
+    using local_limb_type        = typename std::iterator_traits<LimbIteratorType>::value_type;
+    using local_double_limb_type = typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+    constexpr auto limb_digits = static_cast<unsinged_fast_type>(std::numeric_limits<local_limb_type>::digits);
+
+    const auto index  = static_cast<size_t>(h / limb_digits);
+    const auto offset = static_cast<unsigned>(h % limb_digits);
+
+    auto result = static_cast<local_double_limb_type>(detail::make_large(*(p + index), (size_t(index + 1U) < size_t(count)) ? *(p + size_t(index + 1U)) : local_limb_type(0U)) >> offset);
+
+    if((offset != 0U) && (size_t(index + 2U) < size_t(count)))
+    {
+      result = static_cast<local_double_limb_type>(result | static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(*(p + size_t(index + 2U))) << static_cast<unsigned>((limb_digits * 2U) - offset)));
+    }
+
+    return result;
+  }
+
+  template<typename DoubleLimbType>
+  WIDE_INTEGER_CONSTEXPR auto gcd_lehmer_quotient(const DoubleLimbType num, const DoubleLimbType den) -> DoubleLimbType
+  {
+    // Most Euclidean quotients are small, so try these without division.
+    return
+      (num < den)
+        ? DoubleLimbType(0U)
+        : ((DoubleLimbType(num - den) < den)
+            ? DoubleLimbType(1U)
+            : ((DoubleLimbType(DoubleLimbType(num - den) - den) < den) ? DoubleLimbType(2U) : DoubleLimbType(num / den)));
+  }
+
+  template<typename LimbIteratorType>
+  WIDE_INTEGER_CONSTEXPR void gcd_lehmer_combine(      LimbIteratorType                                             p,
+                                                       LimbIteratorType                                             q,
+                                                       LimbIteratorType                                             r1,
+                                                       LimbIteratorType                                             r2,
+                                                 const unsinged_fast_type                                           count,
+                                                 const typename std::iterator_traits<LimbIteratorType>::value_type k1,
+                                                 const typename std::iterator_traits<LimbIteratorType>::value_type k2,
+                                                 const typename std::iterator_traits<LimbIteratorType>::value_type k3,
+                                                 const typename std::iterator_traits<LimbIteratorType>::value_type k4)
+  {
+    // Set r1 = k1 p - k2 q and r2 = k3 q - k4 p modulo the width
+    // of count limbs. Each limb of p and q is read before
+    // the results are written, so r1 and r2 may alias p and q.
+
+    using local_limb_type        = typename std::iterator_traits<LimbIteratorType>::value_type;
+    using local_double_limb_type = typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+    auto carry_1p = static_cast<local_limb_type>(0U);
+    auto carry_2q = static_cast<local_limb_type>(0U);
+    auto carry_3q = static_cast<local_limb_type>(0U);
+    auto carry_4p = static_cast<local_limb_type>(0U);
+
+    auto borrow_1 = static_cast<local_limb_type>(0U);
+    auto borrow_2 = static_cast<local_limb_type>(0U);
+
+    for(auto i = static_cast<size_t>(0U); i < static_cast<size_t>(count); ++i)
+    {
+      const local_limb_type pi = *(p + i);
+      const local_limb_type qi = *(q + i);
+
+      const auto t1p = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(k1) * pi) + carry_1p);
+      const auto t2q = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(k2) * qi) + carry_2q);
+      const auto t3q = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(k3) * qi) + carry_3q);
+      const auto t4p = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(k4) * pi) + carry_4p);
+
+      carry_1p = detail::make_hi<local_limb_type>(t1p);
+      carry_2q = detail::make_hi<local_limb_type>(t2q);
+      carry_3q = detail::make_hi<local_limb_type>(t3q);
+      carry_4p = detail::make_hi<local_limb_type>(t4p);
+
+      const auto d1 = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(detail::make_lo<local_limb_type>(t1p)) - detail::make_lo<local_limb_type>(t2q)) - borrow_1);
+      const auto d2 = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(detail::make_lo<local_limb_type>(t3q)) - detail::make_lo<local_limb_type>(t4p)) - borrow_2);
+
+      borrow_1 = static_cast<local_limb_type>((detail::make_hi<local_limb_type>(d1) != 0U) ? 1U : 0U);
+      borrow_2 = static_cast<local_limb_type>((detail::make_hi<local_limb_type>(d2) != 0U) ? 1U : 0U);
+
+      *(r1 + i) = detail::make_lo<local_limb_type>(d1);
+      *(r2 + i) = detail::make_lo<local_limb_type>(d2);
+    }
+  }
+
+  template<typename LimbType>
+  struct gcd_lehmer_matrix
+  {
+    // The magnitudes of the 2x2 cofactor matrix ((A, B), (C, D))
+    // of a Lehmer step. The cofactors A and D are non-negative (and B
+    // and C non-positive) after an even number of Euclidean steps,
+    // and the other way around otherwise.
+    LimbType a;
+    LimbType b;
+    LimbType c;
+    LimbType d;
+    bool     is_odd;
+  };
+
+  template<typename LimbIteratorType>
+  WIDE_INTEGER_CONSTEXPR auto gcd_lehmer_find_matrix(      LimbIteratorType   u,
+                                                           LimbIteratorType   v,
+                                                     const unsinged_fast_type count,
+                                                     const unsinged_fast_type h,
+                                                     const bool               is_exact) -> gcd_lehmer_matrix<typename std::iterator_traits<LimbIteratorType>::value_type>
+  {
+    // Collect the Euclidean quotients of u and v (u >= v, both having
+    // count limbs) from their leading bits x and y (bits h and higher,
+    // which fit in a double limb), as long as these quotients are
+    // determined by x and y alone (see D. E. Knuth, "The Art of Computer
+    // Programming", Vol. 2, Sect. 4.5.2, Algorithm L). If x and y are
+    // exact (h = 0), the quotients are simply those of x and y.
+    // The cofactors of the matrix are limited to one limb. The entry b
+    // of the matrix is zero if not even the first quotient was found.
+
+    using local_limb_type        = typename std::iterator_traits<LimbIteratorType>::value_type;
+    using local_double_limb_type = typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+    constexpr auto limb_max = static_cast<local_double_limb_type>((std::numeric_limits<local_limb_type>::max)());
+
+    auto x = gcd_lehmer_top_bits(u, count, h);
+    auto y = gcd_lehmer_top_bits(v, count, h);
+
+    auto ma = static_cast<local_double_limb_type>(1U);
+    auto mb = static_cast<local_double_limb_type>(0U);
+    auto mc = static_cast<local_double_limb_type>(0U);
+    auto md = static_cast<local_double_limb_type>(1U);
+
+    bool is_odd = false;
+
+    for(;;)
+    {
+      local_double_limb_type q { };
+
+      if(is_exact)
+      {
+        if(y == 0U)
+        {
+          break;
+        }
+
+        q = gcd_lehmer_quotient(x, y);
+      }
+      else
+      {
+        // Bracket the quotient with q1 = (x + A) / (y + C) and q2 = (x + B) / (y + D).
+        // One of these is at most x / y, so q y <= x if they agree.
+        if(is_odd ? ((x < ma) || (y < md)) : ((x < mb) || (y < mc)))
+        {
+          break;
+        }
+
+        const auto num1 = static_cast<local_double_limb_type>(is_odd ? (x - ma) : (x + ma));
+        const auto num2 = static_cast<local_double_limb_type>(is_odd ? (x + mb) : (x - mb));
+        const auto den1 = static_cast<local_double_limb_type>(is_odd ? (y + mc) : (y - mc));
+        const auto den2 = static_cast<local_double_limb_type>(is_odd ? (y - md) : (y + md));
+
+        if((den1 == 0U) || (den2 == 0U))
+        {
+          break;
+        }
+
+        q = gcd_lehmer_quotient(num1, den1);
+
+        if((q == 0U) || (q != gcd_lehmer_quotient(num2, den2)))
+        {
+          break;
+        }
+      }
+
+      if(q > limb_max)
+      {
+        break;
+      }
+
+      const auto mc_next = static_cast<local_double_limb_type>(ma + (q * mc));
+      const auto md_next = static_cast<local_double_limb_type>(mb + (q * md));
+
+      if((mc_next > limb_max) || (md_next > limb_max))
+      {
+        break;
+      }
+
+      const auto y_next = static_cast<local_double_limb_type>(x - (q * y));
+
+      ma = mc; mc = mc_next;
+      mb = md; md = md_next;
+      x  = y;  y  = y_next;
+
+      is_odd = (!is_odd);
+    }
+
+    return gcd_lehmer_matrix<local_limb_type>
+    {
+      static_cast<local_limb_type>(ma),
+      static_cast<local_limb_type>(mb),
+      static_cast<local_limb_type>(mc),
+      static_cast<local_limb_type>(md),
+      is_odd
+    };
+  }
+
+  template<typename LimbIteratorType>
+  WIDE_INTEGER_CONSTEXPR void gcd_lehmer_apply(      LimbIteratorType                                                             u,
+                                                     LimbIteratorType                                                             v,
+                                               const unsinged_fast_type                                                           count,
+                                               const gcd_lehmer_matrix<typename std::iterator_traits<LimbIteratorType>::value_type>& m)
+  {
+    // Set (u, v) = (A u + B v, C u + D v). Both results are known
+    // to be non-negative and less than u, so the products and sums
+    // need only be kept modulo the width of count limbs. The positive
+    // cofactor of each row is the one of the minuend.
+    if(!m.is_odd)
+    {
+      gcd_lehmer_combine(u, v, u, v, count, m.a, m.b, m.d, m.c);
+    }
+    else
+    {
+      gcd_lehmer_combine(v, u, u, v, count, m.b, m.a, m.c, m.d);
+    }
+  }
+
+  template<typename LimbIteratorType>
+  WIDE_INTEGER_CONSTEXPR auto gcd_lehmer_step(      LimbIteratorType   u,
+                                                    LimbIteratorType   v,
+                                              const unsinged_fast_type count,
+                                              const unsinged_fast_type h) -> bool
+  {
+    // One step of Lehmer's GCD algorithm. Return false
+    // if not even the first quotient could be determined.
+
+    const auto m = gcd_lehmer_find_matrix(u, v, count, h, false);
+
+    if(m.b == 0U)
+    {
+      return false;
+    }
+
+    gcd_lehmer_apply(u, v, count, m);
+
+    return true;
+  }
+
+  template<typename LimbIteratorType>
+  WIDE_INTEGER_CONSTEXPR void xgcd_lehmer_cofactors(      LimbIteratorType                                                             s0,
+                                                          LimbIteratorType                                                             s1,
+                                                    const unsinged_fast_type                                                           count,
+                                                    const gcd_lehmer_matrix<typename std::iterator_traits<LimbIteratorType>::value_type>& m)
+  {
+    // The cofactors of consecutive remainders of the Euclidean algorithm
+    // alternate in sign. So their magnitudes s0 and s1 transform
+    // with the magnitudes of the matrix, (s0, s1) = (a s0 + b s1, c s0 + d s1).
+    // The results must fit in count limbs.
+
+    using local_limb_type        = typename std::iterator_traits<LimbIteratorType>::value_type;
+    using local_double_limb_type = typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+    auto carry_0 = static_cast<local_double_limb_type>(0U);
+    auto carry_1 = static_cast<local_double_limb_type>(0U);
+
+    for(auto i = static_cast<size_t>(0U); i < static_cast<size_t>(count); ++i)
+    {
+      const local_limb_type p = *(s0 + i);
+      const local_limb_type q = *(s1 + i);
+
+      // Each sum of two limb products plus a carry of less
+      // than two limbs fits in a double limb.
+      const auto t0 = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(m.a) * p) + carry_0);
+      const auto t1 = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(m.c) * p) + carry_1);
+
+      const auto u0 = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(m.b) * q);
+      const auto u1 = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(m.d) * q);
+
+      const auto r0 = static_cast<local_double_limb_type>(t0 + detail::make_lo<local_limb_type>(u0));
+      const auto r1 = static_cast<local_double_limb_type>(t1 + detail::make_lo<local_limb_type>(u1));
+
+      *(s0 + i) = detail::make_lo<local_limb_type>(r0);
+      *(s1 + i) = detail::make_lo<local_limb_type>(r1);
+
+      carry_0 = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(detail::make_hi<local_limb_type>(r0)) + detail::make_hi<local_limb_type>(u0));
+      carry_1 = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(detail::make_hi<local_limb_type>(r1)) + detail::make_hi<local_limb_type>(u1));
+    }
+  }
+
+  } // namespace detail
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto gcd(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                  const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // This implementation of GCD is an adaptation
+    // of existing code from Boost.Multiprecision.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_ushort_type       = typename local_wide_integer_type::limb_type;
+    using local_ularge_type       = typename local_wide_integer_type::double_limb_type;
+
+    const bool u_is_neg = local_wide_integer_type::is_neg(a);
+    const bool v_is_neg = local_wide_integer_type::is_neg(b);
+
+    local_wide_integer_type u((!u_is_neg) ? a : -a);
+    local_wide_integer_type v((!v_is_neg) ? b : -b);
+
+    local_wide_integer_type result;
+
+    if(u == v)
+    {
+      // This handles cases having (u = v) and also (u = v = 0).
+      result = u;
+    }
+    else if((static_cast<local_ushort_type>(v) == 0U) && (v == 0U))
+    {
+      // This handles cases having (v = 0) with (u != 0).
+      result = u;
+    }
+    else if((static_cast<local_ushort_type>(u) == 0U) && (u == 0U))
+    {
+      // This handles cases having (u = 0) with (v != 0).
+      result = v;
+    }
+    else
+    {
+      // Now we handle cases having (u != 0) and (v != 0).
+
+      // Let shift := lg K, where K is the greatest
+      // power of 2 dividing both u and v.
+
+      const unsinged_fast_type u_shift = lsb(u);
+      const unsinged_fast_type v_shift = lsb(v);
+
+      const unsinged_fast_type left_shift_amount = (std::min)(u_shift, v_shift);
+
+      u >>= u_shift;
+      v >>= v_shift;
+
+      // As long as the larger of u and v spans more than two limbs,
+      // reduce them with Lehmer steps, each of which applies several
+      // Euclidean quotients at once, or else with one long division.
+      constexpr auto limb_digits = static_cast<unsinged_fast_type>(std::numeric_limits<local_ushort_type>::digits);
+
+      if(u < v)
+      {
+        swap(u, v);
+      }
+
+      for(;;)
+      {
+        // Here u >= v. A Lehmer step maps u and v to two consecutive
+        // remainders of the Euclidean algorithm, so u > v after it.
+        const auto u_bits = static_cast<unsinged_fast_type>(msb(u) + 1U);
+
+        if((u_bits <= static_cast<unsinged_fast_type>(limb_digits * 2U)) || v.is_zero())
+        {
+          break;
+        }
+
+        if(!detail::gcd_lehmer_step(u.representation().begin(),
+                                    v.representation().begin(),
+                                    static_cast<unsinged_fast_type>((u_bits + (limb_digits - 1U)) / limb_digits),
+                                    static_cast<unsinged_fast_type>(u_bits - static_cast<unsinged_fast_type>((limb_digits * 2U) - 1U))))
+        {
+          u %= v;
+
+          swap(u, v);
+        }
+      }
+
+      // The GCD of u and v is odd. So make u and v odd again
+      // for the binary reduction below.
+      if(v.is_zero())
+      {
+        v = u;
+      }
+
+      u >>= lsb(u);
+      v >>= lsb(v);
+
+      for(;;)
+      {
+        // Now u and v are both odd, so diff(u, v) is even.
+        // Let u = min(u, v), v = diff(u, v) / 2.
+
+        if(u > v)
+        {
+          swap(u, v);
+        }
+
+        if(u == v)
+        {
+          break;
+        }
+
+        if(msb(v) < static_cast<unsinged_fast_type>(limb_digits * 2U))
+        {
+          if(v <= (std::numeric_limits<local_ushort_type>::max)())
+          {
+            u = detail::integer_gcd_reduce_short(*(v.crepresentation().cbegin() + 0U),
+                                                 *(u.crepresentation().cbegin() + 0U));
+          }
+          else
+          {
+            const local_ularge_type v_large =
+              detail::make_large(*(v.crepresentation().cbegin() + 0U),
+                                 *(v.crepresentation().cbegin() + 1U));
+
+            const local_ularge_type u_large =
+              detail::make_large(*(u.crepresentation().cbegin() + 0U),
+                                 *(u.crepresentation().cbegin() + 1U));
+
+            const local_ularge_type g_large = detail::integer_gcd_reduce_large(v_large, u_large);
+
+            // The double-limb result is set limb by limb, since the
+            // double-limb type need not be convertible to the wide type.
+            u = local_wide_integer_type(static_cast<local_ushort_type>(0U));
+
+            *(u.representation().begin() + 0U) = detail::make_lo<local_ushort_type>(g_large);
+            *(u.representation().begin() + 1U) = detail::make_hi<local_ushort_type>(g_large);
+          }
+
+          break;
+        }
+
+        v  -= u;
+        v >>= lsb(v);
+      }
+
+      result = (u << left_shift_amount);
+    }
+
+    return ((u_is_neg == v_is_neg) ? result : -result);
+  }
+
+  template<typename UnsignedShortType>
+  WIDE_INTEGER_CONSTEXPR auto gcd(const UnsignedShortType& u, const UnsignedShortType& v) -> typename std::enable_if<(   (std::is_integral   <UnsignedShortType>::value)
+                                                                                                                      && (std::is_unsigned   <UnsignedShortType>::value)), UnsignedShortType>::type
+  {
+    UnsignedShortType result;
+
+    if(u > v)
+    {
+      result = gcd(v, u);
+    }
+
+    if(u == v)
+    {
+      // This handles cases having (u = v) and also (u = v = 0).
+      result = u;
+    }
+
+    if(v == 0U)
+    {
+      // This handles cases having (v = 0) with (u != 0).
+      result = u;
+    }
+
+    if(u == 0U)
+    {
+      // This handles cases having (u = 0) with (v != 0).
+      result = v;
+    }
+    else
+    {
+      result = detail::integer_gcd_reduce_short(u, v);
+    }
+
+    return result;
+  }
+
+  namespace detail {
+
+  template<typename IntegerType>
+  WIDE_INTEGER_CONSTEXPR auto lcm_impl(const IntegerType& a, const IntegerType& b) -> IntegerType
+  {
+    using local_integer_type = IntegerType;
+
+    using std::abs;
+
+    const local_integer_type ap = abs(a);
+    const local_integer_type bp = abs(b);
+
+    const bool a_is_greater_than_b = (ap > bp);
+
+    const local_integer_type gcd_of_ab = gcd(a, b);
+
+    return (a_is_greater_than_b ? ap * (bp / gcd_of_ab)
+                                : bp * (ap / gcd_of_ab));
+  }
+
+  } // namespace detail
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto lcm(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                  const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    return detail::lcm_impl(a, b);
+  }
+
+  template<typename UnsignedShortType>
+  WIDE_INTEGER_CONSTEXPR auto lcm(const UnsignedShortType& a, const UnsignedShortType& b) -> typename std::enable_if<(   (std::is_integral<UnsignedShortType>::value)
+                                                                                                                      && (std::is_unsigned<UnsignedShortType>::value)), UnsignedShortType>::type
+  {
+    return detail::lcm_impl(a, b);
+  }
+
+  namespace detail {
+
+  template<typename UnsignedWideIntegerType>
+  WIDE_INTEGER_CONSTEXPR auto xgcd_lehmer(UnsignedWideIntegerType& u,
+                                          UnsignedWideIntegerType& v,
+                                          UnsignedWideIntegerType* s,
+                                          UnsignedWideIntegerType& t) -> bool
+  {
+    // Run the extended Euclidean algorithm on u >= v with the
+    // Lehmer steps of gcd, and track the magnitudes of the cofactors.
+    // Upon return, u holds the GCD g of u and v, and s (if given) and t
+    // hold the magnitudes of the cofactors of the input values of u and v.
+    // The result is false if g = s u - t v, and true if g = t v - s u.
+
+    using local_wide_integer_type = UnsignedWideIntegerType;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    constexpr auto limb_digits     = static_cast<unsinged_fast_type>(std::numeric_limits<local_limb_type>::digits);
+    constexpr auto number_of_limbs = static_cast<unsinged_fast_type>(local_wide_integer_type::number_of_limbs);
+
+    local_wide_integer_type s0(static_cast<local_limb_type>(1U));
+    local_wide_integer_type s1(static_cast<local_limb_type>(0U));
+    local_wide_integer_type t0(static_cast<local_limb_type>(0U));
+    local_wide_integer_type t1(static_cast<local_limb_type>(1U));
+
+    bool is_odd = false;
+
+    while(!v.is_zero())
+    {
+      // The leading bits of u and v are exact when u spans at most two limbs.
+      const auto u_bits   = static_cast<unsinged_fast_type>(msb(u) + 1U);
+      const auto is_exact = (u_bits <= static_cast<unsinged_fast_type>(limb_digits * 2U));
+
+      const auto count = static_cast<unsinged_fast_type>((u_bits + (limb_digits - 1U)) / limb_digits);
+
+      const auto m =
+        gcd_lehmer_find_matrix(u.representation().begin(),
+                               v.representation().begin(),
+                               count,
+                               (is_exact ? static_cast<unsinged_fast_type>(0U) : static_cast<unsinged_fast_type>(u_bits - static_cast<unsinged_fast_type>((limb_digits * 2U) - 1U))),
+                               is_exact);
+
+      if(m.b != 0U)
+      {
+        gcd_lehmer_apply(u.representation().begin(), v.representation().begin(), count, m);
+
+        // The cofactors grow by less than one limb and one bit per step.
+        // They are bounded by the input values, so they never overflow.
+        const auto t_count =
+          (std::min)(number_of_limbs,
+                     static_cast<unsinged_fast_type>(((std::max)(msb(t0), msb(t1)) / limb_digits) + 3U));
+
+        xgcd_lehmer_cofactors(t0.representation().begin(), t1.representation().begin(), t_count, m);
+
+        if(s != nullptr)
+        {
+          const auto s_count =
+            (std::min)(number_of_limbs,
+                       static_cast<unsinged_fast_type>(((std::max)(msb(s0), msb(s1)) / limb_digits) + 3U));
+
+          xgcd_lehmer_cofactors(s0.representation().begin(), s1.representation().begin(), s_count, m);
+        }
+
+        if(m.is_odd)
+        {
+          is_odd = (!is_odd);
+        }
+      }
+      else
+      {
+        // The quotient does not fit in a limb. So take one Euclidean
+        // step with a long division.
+        const auto qr = divmod(u, v);
+
+        u = v;
+        v = qr.second;
+
+        t0 += (qr.first * t1);
+        swap(t0, t1);
+
+        if(s != nullptr)
+        {
+          s0 += (qr.first * s1);
+          swap(s0, s1);
+        }
+
+        is_odd = (!is_odd);
+      }
+    }
+
+    if(s != nullptr)
+    {
+      *s = s0;
+    }
 
-            local_double_limb_type rd1;
-            local_double_limb_type rd2;
-            local_double_limb_type rd3;
-            local_double_limb_type rd4;
-            local_double_limb_type rd5;
-            local_double_limb_type rd6;
+    t = t0;
 
-      // One special case is considered, the case of multiplication
-      // of the form BITS/2 * BITS/2 = BITS. In this case, the algorithm
-      // can be significantly simplified by using only the 'lower-halves'
-      // of the data.
-      if(    (*(a + left_difference_type(INT32_C(7))) == 0U) && (*(b + right_difference_type(INT32_C(7))) == 0U)
-          && (*(a + left_difference_type(INT32_C(6))) == 0U) && (*(b + right_difference_type(INT32_C(6))) == 0U)
-          && (*(a + left_difference_type(INT32_C(5))) == 0U) && (*(b + right_difference_type(INT32_C(5))) == 0U)
-          && (*(a + left_difference_type(INT32_C(4))) == 0U) && (*(b + right_difference_type(INT32_C(4))) == 0U))
+    return is_odd;
+  }
+
+  } // namespace detail
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto xgcd(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                   const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> std::tuple<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  {
+    // Compute the GCD g = gcd(a, b) >= 0 together with the cofactors s and t
+    // having g = s a + t b (Bezout's identity). For unsigned types, negative
+    // cofactors are given in two's complement, so the identity holds modulo
+    // the width of the type.
+
+    using local_wide_integer_type          = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_unsigned_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+
+    const bool a_is_neg = local_wide_integer_type::is_neg(a);
+    const bool b_is_neg = local_wide_integer_type::is_neg(b);
+
+    local_unsigned_wide_integer_type u((!a_is_neg) ? a : -a);
+    local_unsigned_wide_integer_type v((!b_is_neg) ? b : -b);
+
+    const bool is_swapped = (u < v);
+
+    if(is_swapped)
+    {
+      swap(u, v);
+    }
+
+    local_unsigned_wide_integer_type s;
+    local_unsigned_wide_integer_type t;
+
+    const bool is_odd = detail::xgcd_lehmer(u, v, &s, t);
+
+    // Now u = s max(|a|, |b|) - t min(|a|, |b|), or the negative of this
+    // if is_odd is true.
+    const local_unsigned_wide_integer_type s_max = ((!is_odd) ? s : -s);
+    const local_unsigned_wide_integer_type t_min = ((!is_odd) ? -t : t);
+
+    const local_unsigned_wide_integer_type s_a = ((!is_swapped) ? s_max : t_min);
+    const local_unsigned_wide_integer_type t_b = ((!is_swapped) ? t_min : s_max);
+
+    return std::make_tuple(local_wide_integer_type(u),
+                           local_wide_integer_type((!a_is_neg) ? s_a : -s_a),
+                           local_wide_integer_type((!b_is_neg) ? t_b : -t_b));
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto invmod(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                     const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Compute the inverse of a modulo |m| in the range [0, |m|).
+    // The result is zero if a has no inverse, i.e., if gcd(a, m) != 1.
+    // Only the cofactor of a is tracked in the extended Euclidean algorithm.
+
+    using local_wide_integer_type          = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_unsigned_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using local_limb_type                  = typename local_wide_integer_type::limb_type;
+
+    const bool a_is_neg = local_wide_integer_type::is_neg(a);
+
+    local_unsigned_wide_integer_type u((!local_wide_integer_type::is_neg(m)) ? m : -m);
+
+    local_unsigned_wide_integer_type result;
+
+    if(!u.is_zero())
+    {
+      local_unsigned_wide_integer_type v((!a_is_neg) ? a : -a);
+
+      v %= u;
+
+      if(a_is_neg && (!v.is_zero()))
       {
-        rd1   = local_double_limb_type
-                (
-                  detail::make_hi<local_limb_type>(a0b0)
-                )
-                + detail::make_lo<local_limb_type>(a1b0)
-                + detail::make_lo<local_limb_type>(a0b1)
-                ;
+        v = u - v;
+      }
+
+      const local_unsigned_wide_integer_type m_abs(u);
+
+      local_unsigned_wide_integer_type t;
+
+      const bool is_odd = detail::xgcd_lehmer(u, v, static_cast<local_unsigned_wide_integer_type*>(nullptr), t);
+
+      // Now u = gcd(a, m) = +-t a (mod m), where the sign is positive
+      // if is_odd is true.
+      if(u == static_cast<local_limb_type>(1U))
+      {
+        result = ((is_odd || t.is_zero()) ? t : m_abs - t);
+      }
+    }
+
+    return local_wide_integer_type(result);
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto invmod_ct(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                        const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Compute the inverse of a modulo m in constant time for secret values
+    // of a, with the binary algorithm of N. Moeller as in mpn_sec_invert
+    // of GMP. The sequence of operations and memory accesses depends on
+    // the width of the type only. The modulus m must be odd, and
+    // 0 <= a < m is required. The result is zero if a has no inverse.
+
+    // Maintain a = u a_in (mod m) and b = v a_in (mod m), with b odd.
+    // In each iteration, a is halved after subtracting b if a is odd,
+    // with a and b exchanged (and a negated) if this subtraction borrows.
+    // Since each iteration reduces the total bit count of a and b,
+    // 2 * Width2 iterations leave a = 0 and b = gcd(a_in, m).
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    constexpr auto count = static_cast<unsinged_fast_type>(local_wide_integer_type::number_of_limbs);
+
+    local_wide_integer_type ap(a);
+    local_wide_integer_type bp(m);
+    local_wide_integer_type mp(m);
+    local_wide_integer_type up(static_cast<local_limb_type>(1U));
+    local_wide_integer_type vp(static_cast<local_limb_type>(0U));
+
+    // This is (m + 1) / 2, the inverse of two modulo m.
+    local_wide_integer_type m1h((m >> 1U) + static_cast<local_limb_type>(1U));
+
+    for(auto i = static_cast<unsinged_fast_type>(0U); i < static_cast<unsinged_fast_type>(Width2 * 2U); ++i)
+    {
+      const auto odd_mask = detail::cnd_mask(static_cast<local_limb_type>(*ap.crepresentation().cbegin() & static_cast<local_limb_type>(1U)));
+
+      // If a is odd, subtract b from it. If this borrows, then set
+      // b to the old value of a and a to the (positive) difference.
+      const auto swap_mask =
+        detail::cnd_mask(detail::cnd_sub_n(ap.representation().begin(), bp.representation().begin(), count, odd_mask));
+
+      detail::cnd_add_n (bp.representation().begin(), ap.representation().begin(), count, swap_mask);
+      detail::cnd_neg_n (ap.representation().begin(), count, swap_mask);
+      detail::cnd_swap_n(up.representation().begin(), vp.representation().begin(), count, swap_mask);
+
+      // Keep the invariants with u = u - v (mod m) if a was odd.
+      const auto borrow_mask =
+        detail::cnd_mask(detail::cnd_sub_n(up.representation().begin(), vp.representation().begin(), count, odd_mask));
+
+      static_cast<void>(detail::cnd_add_n(up.representation().begin(), mp.representation().begin(), count, borrow_mask));
+
+      // Now a is even. Halve a, and halve u modulo m.
+      const auto u_is_odd = static_cast<local_limb_type>(*up.crepresentation().cbegin() & static_cast<local_limb_type>(1U));
+
+      detail::cnd_shr1_n(ap.representation().begin(), count, static_cast<local_limb_type>(0U));
+      detail::cnd_shr1_n(up.representation().begin(), count, static_cast<local_limb_type>(0U));
+
+      static_cast<void>(detail::cnd_add_n(up.representation().begin(), m1h.representation().begin(), count, detail::cnd_mask(u_is_odd)));
+    }
+
+    // The inverse exists if and only if b = gcd(a_in, m) = 1.
+    return const_time::select(const_time::equal(bp, local_wide_integer_type(static_cast<local_limb_type>(1U))),
+                              vp,
+                              local_wide_integer_type(static_cast<local_limb_type>(0U)));
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto divmod(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                     const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> std::pair<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  {
+    // Compute the quotient and the remainder from one single pass
+    // of the long division. The results are the same as (a / b)
+    // and (a % b), respectively.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    local_wide_integer_type q(a);
+    local_wide_integer_type r;
+
+    q.eval_divmod(b, &r);
+
+    return std::pair<local_wide_integer_type, local_wide_integer_type>(q, r);
+  }
+
+  template<typename UnsignedShortType,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto divmod(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                                     const UnsignedShortType& b) -> typename std::enable_if<(   (std::is_integral<UnsignedShortType>::value)
+                                                                                             && (std::is_unsigned<UnsignedShortType>::value)
+                                                                                             && (std::numeric_limits<UnsignedShortType>::digits <= std::numeric_limits<LimbType>::digits)),
+                                                                                             std::pair<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>, LimbType>>::type
+  {
+    // Compute the quotient and the remainder of the division
+    // by a single limb. The results are the same as (a / b)
+    // and (a % b), respectively.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    const bool a_is_neg = local_wide_integer_type::is_neg(a);
+
+    local_wide_integer_type q((!a_is_neg) ? a : -a);
+
+    auto r = local_limb_type(0U);
+
+    if(b == static_cast<UnsignedShortType>(UINT8_C(0)))
+    {
+      q = (std::numeric_limits<local_wide_integer_type>::max)();
+    }
+    else
+    {
+      local_wide_integer_type remainder;
+
+      q.eval_divide_by_single_limb(static_cast<local_limb_type>(b), 0U, &remainder);
+
+      r = static_cast<local_limb_type>(remainder);
+
+      if(a_is_neg)
+      {
+        q.negate();
+
+        r = static_cast<local_limb_type>(static_cast<local_limb_type>(~r) + 1U);
+      }
+    }
+
+    return std::pair<local_wide_integer_type, local_limb_type>(q, r);
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto export_bytes(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
+                                                 std::uint8_t* first,
+                                                 std::uint8_t* last,
+                                           const bool          msv_first,
+                                           const bool          fixed_width) -> std::uint8_t*
+  {
+    // Write the bytes of the (two's complement) representation of x
+    // to [first, last), most significant byte first or last. Only the
+    // significant bytes are written, or else the whole range is filled
+    // for a fixed width (sign-extended beyond the width of x).
+    // Return the end of the written bytes, or nullptr if they do not fit.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    constexpr auto bytes_per_limb  = static_cast<size_t>(std::numeric_limits<local_limb_type>::digits / 8);
+    constexpr auto bytes_of_width  = static_cast<size_t>(Width2 / 8U);
+
+    const auto& rep = x.crepresentation();
+
+    const auto bytes_available = static_cast<size_t>(last - first);
+
+    auto bytes_significant = bytes_of_width;
+
+    if((!fixed_width) || (bytes_available < bytes_of_width))
+    {
+      while(   (bytes_significant > 1U)
+            && (static_cast<std::uint8_t>(*(rep.cbegin() + static_cast<size_t>((bytes_significant - 1U) / bytes_per_limb)) >> unsigned(((bytes_significant - 1U) % bytes_per_limb) * 8U)) == 0U))
+      {
+        --bytes_significant;
+      }
+
+      if(bytes_available < bytes_significant)
+      {
+        return nullptr;
+      }
+    }
+
+    const size_t bytes_out  = (fixed_width ? bytes_available : bytes_significant);
+    const size_t bytes_copy = (std::min)(bytes_out, bytes_of_width);
+
+    // Whole limbs are written one by one. The compiler can merge the stores
+    // of their bytes into plain or byte-swapped stores of the limbs.
+    size_t i = 0U;
+
+    if(msv_first)
+    {
+      for( ; (i + bytes_per_limb) <= bytes_copy; i += bytes_per_limb)
+      {
+        detail::limb_store_msv_first(first + static_cast<size_t>((bytes_out - i) - bytes_per_limb), *(rep.cbegin() + static_cast<size_t>(i / bytes_per_limb))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+    else
+    {
+      for( ; (i + bytes_per_limb) <= bytes_copy; i += bytes_per_limb)
+      {
+        detail::limb_store_lsv_first(first + i, *(rep.cbegin() + static_cast<size_t>(i / bytes_per_limb))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+
+    const auto byte_pad = static_cast<std::uint8_t>(local_wide_integer_type::is_neg(x) ? UINT8_C(0xFF) : UINT8_C(0));
+
+    for( ; i < bytes_out; ++i)
+    {
+      const auto byte_value =
+        static_cast<std::uint8_t>
+        (
+          (i < bytes_copy) ? static_cast<std::uint8_t>(*(rep.cbegin() + static_cast<size_t>(i / bytes_per_limb)) >> unsigned((i % bytes_per_limb) * 8U))
+                           : byte_pad
+        );
+
+      *(msv_first ? (first + static_cast<size_t>((bytes_out - 1U) - i)) : (first + i)) = byte_value; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    return first + bytes_out; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_CONSTEXPR auto import_bytes(      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
+                                           const std::uint8_t* first,
+                                           const std::uint8_t* last,
+                                           const bool          msv_first) -> bool
+  {
+    // Read the bytes in [first, last), most significant byte first
+    // or last, as an unsigned value into the representation of x.
+    // Bytes beyond the width of x are dropped. Return false, and leave
+    // x unchanged, if any of these is nonzero or, for a signed type,
+    // differs from the sign extension of the most significant byte
+    // within the width (as written by export_bytes with fixed width).
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    constexpr auto bytes_per_limb = static_cast<size_t>(std::numeric_limits<local_limb_type>::digits / 8);
+    constexpr auto bytes_of_width = static_cast<size_t>(Width2 / 8U);
+
+    const auto bytes_in   = static_cast<size_t>(last - first);
+    const auto bytes_copy = (std::min)(bytes_in, bytes_of_width);
+
+    // Check the dropped bytes before anything is written to x.
+    if(bytes_in > bytes_of_width)
+    {
+      const std::uint8_t byte_top = *(msv_first ? (last - bytes_of_width) : (first + static_cast<size_t>(bytes_of_width - 1U))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const auto byte_pad =
+        static_cast<std::uint8_t>
+        (
+          (IsSigned && (static_cast<std::uint8_t>(byte_top & UINT8_C(0x80)) != 0U)) ? UINT8_C(0xFF) : UINT8_C(0)
+        );
+
+      for(auto j = bytes_copy; j < bytes_in; ++j)
+      {
+        if(*(msv_first ? (last - static_cast<size_t>(j + 1U)) : (first + j)) != byte_pad) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        {
+          return false;
+        }
+      }
+    }
+
+    auto& rep = x.representation();
+
+    // Whole limbs are assembled one by one. The compiler can merge the loads
+    // of their bytes into plain or byte-swapped loads of the limbs.
+    size_t i = 0U;
+
+    if(msv_first)
+    {
+      for( ; (i + bytes_per_limb) <= bytes_copy; i += bytes_per_limb)
+      {
+        *(rep.begin() + static_cast<size_t>(i / bytes_per_limb)) = detail::limb_load_msv_first<local_limb_type>(last - static_cast<size_t>(i + bytes_per_limb)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+    else
+    {
+      for( ; (i + bytes_per_limb) <= bytes_copy; i += bytes_per_limb)
+      {
+        *(rep.begin() + static_cast<size_t>(i / bytes_per_limb)) = detail::limb_load_lsv_first<local_limb_type>(first + i); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
+
+    std::fill(rep.begin() + static_cast<size_t>(i / bytes_per_limb), rep.end(), static_cast<local_limb_type>(0U));
+
+    for( ; i < bytes_copy; ++i)
+    {
+      const std::uint8_t byte_value = *(msv_first ? (last - static_cast<size_t>(i + 1U)) : (first + i)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      *(rep.begin() + static_cast<size_t>(i / bytes_per_limb)) |= static_cast<local_limb_type>(static_cast<local_limb_type>(byte_value) << unsigned((i % bytes_per_limb) * 8U));
+    }
+
+    return true;
+  }
+
+  template<const size_t Width2,
+           typename LimbType>
+  class uintwide_view
+  {
+    // A non-owning view of the Width2 bits of an unsigned integer held
+    // in an externally owned, contiguous buffer of limbs (least significant
+    // limb first, each limb in the byte order of the host). Such buffers
+    // can, for instance, reside in memory-mapped files or network packets.
+    // A view of const limbs, such as uintwide_view<512U, const std::uint64_t>,
+    // is read-only. A view of mutable limbs additionally supports in-place
+    // addition, subtraction and shifts. These use the same kernels
+    // as the corresponding operations of uintwide_t.
+
+  public:
+    using limb_type  = typename std::remove_const<LimbType>::type;
+    using pointer    = LimbType*;
+    using value_type = uintwide_t<Width2, limb_type, void, false>;
+
+    static constexpr size_t my_width2       = Width2;
+    static constexpr size_t number_of_limbs = value_type::number_of_limbs;
+    static constexpr bool   is_read_only    = std::is_const<LimbType>::value;
+
+    explicit constexpr uintwide_view(pointer p) : my_data(p) { }
+
+    template<typename OtherAllocatorType,
+             const bool RePhraseIsReadOnly = is_read_only,
+             typename std::enable_if<(!RePhraseIsReadOnly)>::type const* = nullptr>
+    explicit WIDE_INTEGER_CONSTEXPR uintwide_view(uintwide_t<Width2, limb_type, OtherAllocatorType, false>& x)
+      : my_data(x.representation().data()) { }
+
+    template<typename OtherAllocatorType,
+             const bool RePhraseIsReadOnly = is_read_only,
+             typename std::enable_if<RePhraseIsReadOnly>::type const* = nullptr>
+    explicit WIDE_INTEGER_CONSTEXPR uintwide_view(const uintwide_t<Width2, limb_type, OtherAllocatorType, false>& x)
+      : my_data(x.crepresentation().data()) { }
+
+    // A view of mutable limbs converts to a read-only view.
+    template<typename OtherLimbType,
+             typename std::enable_if<(   std::is_same<const OtherLimbType, LimbType>::value
+                                      && (!std::is_const<OtherLimbType>::value))>::type const* = nullptr>
+    constexpr uintwide_view(const uintwide_view<Width2, OtherLimbType>& other) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : my_data(other.data()) { }
+
+    constexpr auto data() const -> pointer { return my_data; }
+
+    // Copy the limbs into an owning integer.
+    template<typename OtherAllocatorType>
+    explicit WIDE_INTEGER_CONSTEXPR operator uintwide_t<Width2, limb_type, OtherAllocatorType, false>() const
+    {
+      uintwide_t<Width2, limb_type, OtherAllocatorType, false> x;
+
+      std::copy(my_data, my_data + number_of_limbs, x.representation().begin()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      return x;
+    }
+
+    // Convert the low limbs to a built-in integral type (modulo its range).
+    template<typename IntegralType,
+             typename std::enable_if<(   std::is_integral<IntegralType>::value
+                                      && (!std::is_same<IntegralType, bool>::value))>::type const* = nullptr>
+    explicit WIDE_INTEGER_CONSTEXPR operator IntegralType() const
+    {
+      using local_unsigned_type = typename std::make_unsigned<IntegralType>::type;
+
+      constexpr auto limb_digits = static_cast<unsinged_fast_type>(std::numeric_limits<limb_type>::digits);
+
+      auto u = static_cast<local_unsigned_type>(*my_data);
+
+      for(auto i = static_cast<unsinged_fast_type>(1U);
+               (i < static_cast<unsinged_fast_type>(number_of_limbs)) && ((i * limb_digits) < static_cast<unsinged_fast_type>(std::numeric_limits<local_unsigned_type>::digits));
+             ++i)
+      {
+        u = static_cast<local_unsigned_type>(u | static_cast<local_unsigned_type>(static_cast<local_unsigned_type>(*(my_data + size_t(i))) << unsigned(i * limb_digits))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      return static_cast<IntegralType>(u);
+    }
+
+    explicit WIDE_INTEGER_CONSTEXPR operator bool() const { return (!is_zero()); }
+
+    WIDE_INTEGER_CONSTEXPR auto is_zero() const -> bool
+    {
+      auto i = static_cast<size_t>(0U);
+
+      while((i < number_of_limbs) && (*(my_data + i) == limb_type(0U))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        ++i;
+      }
+
+      return (i == number_of_limbs);
+    }
+
+    template<typename OtherLimbType>
+    WIDE_INTEGER_CONSTEXPR auto compare(const uintwide_view<Width2, OtherLimbType>& other) const -> std::int_fast8_t
+    {
+      return value_type::compare_ranges(my_data, other.data(), unsinged_fast_type(number_of_limbs));
+    }
+
+    template<typename OtherAllocatorType>
+    WIDE_INTEGER_CONSTEXPR auto compare(const uintwide_t<Width2, limb_type, OtherAllocatorType, false>& other) const -> std::int_fast8_t
+    {
+      return value_type::compare_ranges(my_data, other.crepresentation().data(), unsinged_fast_type(number_of_limbs));
+    }
 
-        rd2   = local_double_limb_type
-                (
-                  detail::make_hi<local_limb_type>(rd1)
-                )
-                + detail::make_lo<local_limb_type>(a2b0)
-                + detail::make_lo<local_limb_type>(a1b1)
-                + detail::make_lo<local_limb_type>(a0b2)
-                + detail::make_hi<local_limb_type>(a1b0)
-                + detail::make_hi<local_limb_type>(a0b1)
-                ;
+    // Implement comparison operators with views and with owning integers.
+    template<typename OtherType> WIDE_INTEGER_CONSTEXPR auto operator==(const OtherType& other) const -> bool { return (compare(other) == std::int_fast8_t( 0)); }
+    template<typename OtherType> WIDE_INTEGER_CONSTEXPR auto operator< (const OtherType& other) const -> bool { return (compare(other) == std::int_fast8_t(-1)); }
+    template<typename OtherType> WIDE_INTEGER_CONSTEXPR auto operator> (const OtherType& other) const -> bool { return (compare(other) == std::int_fast8_t( 1)); }
+    template<typename OtherType> WIDE_INTEGER_CONSTEXPR auto operator!=(const OtherType& other) const -> bool { return (compare(other) != std::int_fast8_t( 0)); }
+    template<typename OtherType> WIDE_INTEGER_CONSTEXPR auto operator<=(const OtherType& other) const -> bool { return (compare(other) <= std::int_fast8_t( 0)); }
+    template<typename OtherType> WIDE_INTEGER_CONSTEXPR auto operator>=(const OtherType& other) const -> bool { return (compare(other) >= std::int_fast8_t( 0)); }
 
-        rd3   = local_double_limb_type
-                (
-                  detail::make_hi<local_limb_type>(rd2)
-                )
-                + detail::make_lo<local_limb_type>(a3b0)
-                + detail::make_lo<local_limb_type>(a2b1)
-                + detail::make_lo<local_limb_type>(a1b2)
-                + detail::make_lo<local_limb_type>(a0b3)
-                + detail::make_hi<local_limb_type>(a2b0)
-                + detail::make_hi<local_limb_type>(a1b1)
-                + detail::make_hi<local_limb_type>(a0b2)
-                ;
+    // Copy the limbs of an owning integer into the viewed buffer.
+    template<typename OtherAllocatorType,
+             const bool RePhraseIsReadOnly = is_read_only,
+             typename std::enable_if<(!RePhraseIsReadOnly)>::type const* = nullptr>
+    WIDE_INTEGER_CONSTEXPR auto assign(const uintwide_t<Width2, limb_type, OtherAllocatorType, false>& x) -> uintwide_view&
+    {
+      std::copy(x.crepresentation().cbegin(), x.crepresentation().cend(), my_data);
 
-        rd4   = local_double_limb_type
-                (
-                  detail::make_hi<local_limb_type>(rd3)
-                )
-                + detail::make_lo<local_limb_type>(a3b1)
-                + detail::make_lo<local_limb_type>(a2b2)
-                + detail::make_lo<local_limb_type>(a1b3)
-                + detail::make_hi<local_limb_type>(a3b0)
-                + detail::make_hi<local_limb_type>(a2b1)
-                + detail::make_hi<local_limb_type>(a1b2)
-                + detail::make_hi<local_limb_type>(a0b3)
-                ;
+      return *this;
+    }
 
-        rd5   = local_double_limb_type
-                (
-                  detail::make_hi<local_limb_type>(rd4)
-                )
-                + detail::make_lo<local_limb_type>(a3b2)
-                + detail::make_lo<local_limb_type>(a2b3)
-                + detail::make_hi<local_limb_type>(a3b1)
-                + detail::make_hi<local_limb_type>(a2b2)
-                + detail::make_hi<local_limb_type>(a1b3)
-                ;
+    template<typename OtherLimbType,
+             const bool RePhraseIsReadOnly = is_read_only,
+             typename std::enable_if<(!RePhraseIsReadOnly)>::type const* = nullptr>
+    WIDE_INTEGER_CONSTEXPR auto operator+=(const uintwide_view<Width2, OtherLimbType>& other) -> uintwide_view&
+    {
+      static_cast<void>(value_type::eval_add_n(my_data, my_data, other.data(), unsinged_fast_type(number_of_limbs)));
 
-        rd6   = local_double_limb_type
-                (
-                  detail::make_hi<local_limb_type>(rd5)
-                )
-                + detail::make_lo<local_limb_type>(a3b3)
-                + detail::make_hi<local_limb_type>(a3b2)
-                + detail::make_hi<local_limb_type>(a2b3)
-                ;
+      return *this;
+    }
 
-        *(r + result_difference_type(INT32_C(7)))
-              = local_limb_type
-                (
-                    detail::make_hi<local_limb_type>(rd6)
-                  + detail::make_hi<local_limb_type>(a3b3)
-                )
-                ;
+    template<typename OtherAllocatorType,
+             const bool RePhraseIsReadOnly = is_read_only,
+             typename std::enable_if<(!RePhraseIsReadOnly)>::type const* = nullptr>
+    WIDE_INTEGER_CONSTEXPR auto operator+=(const uintwide_t<Width2, limb_type, OtherAllocatorType, false>& other) -> uintwide_view&
+    {
+      static_cast<void>(value_type::eval_add_n(my_data, my_data, other.crepresentation().data(), unsinged_fast_type(number_of_limbs)));
+
+      return *this;
+    }
+
+    template<typename OtherLimbType,
+             const bool RePhraseIsReadOnly = is_read_only,
+             typename std::enable_if<(!RePhraseIsReadOnly)>::type const* = nullptr>
+    WIDE_INTEGER_CONSTEXPR auto operator-=(const uintwide_view<Width2, OtherLimbType>& other) -> uintwide_view&
+    {
+      static_cast<void>(value_type::eval_subtract_n(my_data, my_data, other.data(), unsinged_fast_type(number_of_limbs)));
+
+      return *this;
+    }
+
+    template<typename OtherAllocatorType,
+             const bool RePhraseIsReadOnly = is_read_only,
+             typename std::enable_if<(!RePhraseIsReadOnly)>::type const* = nullptr>
+    WIDE_INTEGER_CONSTEXPR auto operator-=(const uintwide_t<Width2, limb_type, OtherAllocatorType, false>& other) -> uintwide_view&
+    {
+      static_cast<void>(value_type::eval_subtract_n(my_data, my_data, other.crepresentation().data(), unsinged_fast_type(number_of_limbs)));
+
+      return *this;
+    }
+
+    template<typename UnsignedIntegralType,
+             const bool RePhraseIsReadOnly = is_read_only,
+             typename std::enable_if<(   (!RePhraseIsReadOnly)
+                                      && std::is_integral<UnsignedIntegralType>::value
+                                      && (!std::is_signed<UnsignedIntegralType>::value))>::type const* = nullptr>
+    WIDE_INTEGER_CONSTEXPR auto operator<<=(const UnsignedIntegralType n) -> uintwide_view&
+    {
+      if(n == 0U)
+      {
+        ;
+      }
+      else if(unsinged_fast_type(n) >= my_width2)
+      {
+        std::fill(my_data, my_data + number_of_limbs, limb_type(0U)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       }
       else
       {
-        const local_double_limb_type a4b0 = *(a + left_difference_type(INT32_C(4))) * local_double_limb_type(*(b + right_difference_type(INT32_C(0))));
-        const local_double_limb_type a0b4 = *(a + left_difference_type(INT32_C(0))) * local_double_limb_type(*(b + right_difference_type(INT32_C(4))));
-
-        const local_double_limb_type a5b0 = *(a + left_difference_type(INT32_C(5))) * local_double_limb_type(*(b + right_difference_type(INT32_C(0))));
-        const local_double_limb_type a4b1 = *(a + left_difference_type(INT32_C(4))) * local_double_limb_type(*(b + right_difference_type(INT32_C(1))));
+        value_type::eval_shl_n(my_data,
+                               unsinged_fast_type(number_of_limbs),
+                               unsinged_fast_type(unsinged_fast_type(n) / unsinged_fast_type(std::numeric_limits<limb_type>::digits)),
+                               std::uint_fast16_t(unsinged_fast_type(n) % unsinged_fast_type(std::numeric_limits<limb_type>::digits)));
+      }
 
-        const local_double_limb_type a1b4 = *(a + left_difference_type(INT32_C(1))) * local_double_limb_type(*(b + right_difference_type(INT32_C(4))));
-        const local_double_limb_type a0b5 = *(a + left_difference_type(INT32_C(0))) * local_double_limb_type(*(b + right_difference_type(INT32_C(5))));
+      return *this;
+    }
 
-        const local_double_limb_type a6b0 = *(a + left_difference_type(INT32_C(6))) * local_double_limb_type(*(b + right_difference_type(INT32_C(0))));
-        const local_double_limb_type a5b1 = *(a + left_difference_type(INT32_C(5))) * local_double_limb_type(*(b + right_difference_type(INT32_C(1))));
+    template<typename UnsignedIntegralType,
+             const bool RePhraseIsReadOnly = is_read_only,
+             typename std::enable_if<(   (!RePhraseIsReadOnly)
+                                      && std::is_integral<UnsignedIntegralType>::value
+                                      && (!std::is_signed<UnsignedIntegralType>::value))>::type const* = nullptr>
+    WIDE_INTEGER_CONSTEXPR auto operator>>=(const UnsignedIntegralType n) -> uintwide_view&
+    {
+      if(n == 0U)
+      {
+        ;
+      }
+      else if(unsinged_fast_type(n) >= my_width2)
+      {
+        std::fill(my_data, my_data + number_of_limbs, limb_type(0U)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+      else
+      {
+        value_type::eval_shr_n(my_data,
+                               unsinged_fast_type(number_of_limbs),
+                               unsinged_fast_type(unsinged_fast_type(n) / unsinged_fast_type(std::numeric_limits<limb_type>::digits)),
+                               std::uint_fast16_t(unsinged_fast_type(n) % unsinged_fast_type(std::numeric_limits<limb_type>::digits)),
+                               false);
+      }
 
-        const local_double_limb_type a4b2 = *(a + left_difference_type(INT32_C(4))) * local_double_limb_type(*(b + right_difference_type(INT32_C(2))));
-        const local_double_limb_type a2b4 = *(a + left_difference_type(INT32_C(2))) * local_double_limb_type(*(b + right_difference_type(INT32_C(4))));
+      return *this;
+    }
 
-        const local_double_limb_type a1b5 = *(a + left_difference_type(INT32_C(1))) * local_double_limb_type(*(b + right_difference_type(INT32_C(5))));
-        const local_double_limb_type a0b6 = *(a + left_difference_type(INT32_C(0))) * local_double_limb_type(*(b + right_difference_type(INT32_C(6))));
+  private:
+    pointer my_data;
+  };
 
-        rd1   = local_double_limb_type
-                (
-                  detail::make_hi<local_limb_type>(a0b0)
-                )
-                + detail::make_lo<local_limb_type>(a1b0)
-                + detail::make_lo<local_limb_type>(a0b1)
-                ;
+  // Comparison operators with an owning integer on the left-hand side.
+  template<const size_t Width2, typename LimbType, typename AllocatorType> WIDE_INTEGER_CONSTEXPR auto operator==(const uintwide_t<Width2, typename uintwide_view<Width2, LimbType>::limb_type, AllocatorType, false>& u, const uintwide_view<Width2, LimbType>& v) -> bool { return (v.compare(u) == std::int_fast8_t( 0)); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType> WIDE_INTEGER_CONSTEXPR auto operator< (const uintwide_t<Width2, typename uintwide_view<Width2, LimbType>::limb_type, AllocatorType, false>& u, const uintwide_view<Width2, LimbType>& v) -> bool { return (v.compare(u) == std::int_fast8_t( 1)); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType> WIDE_INTEGER_CONSTEXPR auto operator> (const uintwide_t<Width2, typename uintwide_view<Width2, LimbType>::limb_type, AllocatorType, false>& u, const uintwide_view<Width2, LimbType>& v) -> bool { return (v.compare(u) == std::int_fast8_t(-1)); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType> WIDE_INTEGER_CONSTEXPR auto operator!=(const uintwide_t<Width2, typename uintwide_view<Width2, LimbType>::limb_type, AllocatorType, false>& u, const uintwide_view<Width2, LimbType>& v) -> bool { return (v.compare(u) != std::int_fast8_t( 0)); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType> WIDE_INTEGER_CONSTEXPR auto operator<=(const uintwide_t<Width2, typename uintwide_view<Width2, LimbType>::limb_type, AllocatorType, false>& u, const uintwide_view<Width2, LimbType>& v) -> bool { return (v.compare(u) >= std::int_fast8_t( 0)); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType> WIDE_INTEGER_CONSTEXPR auto operator>=(const uintwide_t<Width2, typename uintwide_view<Width2, LimbType>::limb_type, AllocatorType, false>& u, const uintwide_view<Width2, LimbType>& v) -> bool { return (v.compare(u) <= std::int_fast8_t( 0)); }
 
-        rd2   = local_double_limb_type
-                (
-                  detail::make_hi<local_limb_type>(rd1)
-                )
-                + detail::make_lo<local_limb_type>(a2b0)
-                + detail::make_lo<local_limb_type>(a1b1)
-                + detail::make_lo<local_limb_type>(a0b2)
-                + detail::make_hi<local_limb_type>(a1b0)
-                + detail::make_hi<local_limb_type>(a0b1)
-                ;
+  template<const size_t Width2,
+           typename LimbType>
+  WIDE_INTEGER_CONSTEXPR auto lsb(const uintwide_view<Width2, LimbType>& x) -> unsinged_fast_type
+  {
+    // Calculate the position of the least-significant bit.
 
-        rd3   = local_double_limb_type
-                (
-                  detail::make_hi<local_limb_type>(rd2)
-                )
-                + detail::make_lo<local_limb_type>(a3b0)
-                + detail::make_lo<local_limb_type>(a2b1)
-                + detail::make_lo<local_limb_type>(a1b2)
-                + detail::make_lo<local_limb_type>(a0b3)
-                + detail::make_hi<local_limb_type>(a2b0)
-                + detail::make_hi<local_limb_type>(a1b1)
-                + detail::make_hi<local_limb_type>(a0b2)
-                ;
+    using local_view_type = uintwide_view<Width2, LimbType>;
+    using local_limb_type = typename local_view_type::limb_type;
 
-        rd4   = local_double_limb_type
-                (
-                  detail::make_hi<local_limb_type>(rd3)
-                )
-                + detail::make_lo<local_limb_type>(a4b0)
-                + detail::make_lo<local_limb_type>(a3b1)
-                + detail::make_lo<local_limb_type>(a2b2)
-                + detail::make_lo<local_limb_type>(a1b3)
-                + detail::make_lo<local_limb_type>(a0b4)
-                + detail::make_hi<local_limb_type>(a3b0)
-                + detail::make_hi<local_limb_type>(a2b1)
-                + detail::make_hi<local_limb_type>(a1b2)
-                + detail::make_hi<local_limb_type>(a0b3)
-                ;
+    auto bpos = unsinged_fast_type(0U);
 
-        rd5   = local_double_limb_type
-                (
-                  detail::make_hi<local_limb_type>(rd4)
-                )
-                + detail::make_lo<local_limb_type>(a5b0)
-                + detail::make_lo<local_limb_type>(a4b1)
-                + detail::make_lo<local_limb_type>(a3b2)
-                + detail::make_lo<local_limb_type>(a2b3)
-                + detail::make_lo<local_limb_type>(a1b4)
-                + detail::make_lo<local_limb_type>(a0b5)
-                + detail::make_hi<local_limb_type>(a4b0)
-                + detail::make_hi<local_limb_type>(a3b1)
-                + detail::make_hi<local_limb_type>(a2b2)
-                + detail::make_hi<local_limb_type>(a1b3)
-                + detail::make_hi<local_limb_type>(a0b4)
-                ;
+    for(auto i = static_cast<unsinged_fast_type>(0U); i < static_cast<unsinged_fast_type>(local_view_type::number_of_limbs); ++i)
+    {
+      const local_limb_type limb = *(x.data() + size_t(i)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-        rd6   = local_double_limb_type
-                (
-                  detail::make_hi<local_limb_type>(rd5)
-                )
-                + detail::make_lo<local_limb_type>(a6b0)
-                + detail::make_lo<local_limb_type>(a5b1)
-                + detail::make_lo<local_limb_type>(a4b2)
-                + detail::make_lo<local_limb_type>(a3b3)
-                + detail::make_lo<local_limb_type>(a2b4)
-                + detail::make_lo<local_limb_type>(a1b5)
-                + detail::make_lo<local_limb_type>(a0b6)
-                + detail::make_hi<local_limb_type>(a5b0)
-                + detail::make_hi<local_limb_type>(a4b1)
-                + detail::make_hi<local_limb_type>(a3b2)
-                + detail::make_hi<local_limb_type>(a2b3)
-                + detail::make_hi<local_limb_type>(a1b4)
-                + detail::make_hi<local_limb_type>(a0b5)
-                ;
+      if(limb != 0U)
+      {
+        bpos =   detail::lsb_helper(limb)
+               + unsinged_fast_type(unsinged_fast_type(std::numeric_limits<local_limb_type>::digits) * i);
 
-        *(r + result_difference_type(INT32_C(7)))
-              = local_limb_type
-                (
-                    detail::make_hi<local_limb_type>(rd6)
-                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(7))) * local_double_limb_type(*(b + right_difference_type(INT32_C(0)))))
-                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(6))) * local_double_limb_type(*(b + right_difference_type(INT32_C(1)))))
-                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(5))) * local_double_limb_type(*(b + right_difference_type(INT32_C(2)))))
-                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(4))) * local_double_limb_type(*(b + right_difference_type(INT32_C(3)))))
-                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(3))) * local_double_limb_type(*(b + right_difference_type(INT32_C(4)))))
-                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(2))) * local_double_limb_type(*(b + right_difference_type(INT32_C(5)))))
-                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(1))) * local_double_limb_type(*(b + right_difference_type(INT32_C(6)))))
-                  + static_cast<local_limb_type>    (*(a + left_difference_type(INT32_C(0))) * local_double_limb_type(*(b + right_difference_type(INT32_C(7)))))
-                  + detail::make_hi<local_limb_type>(a6b0)
-                  + detail::make_hi<local_limb_type>(a5b1)
-                  + detail::make_hi<local_limb_type>(a4b2)
-                  + detail::make_hi<local_limb_type>(a3b3)
-                  + detail::make_hi<local_limb_type>(a2b4)
-                  + detail::make_hi<local_limb_type>(a1b5)
-                  + detail::make_hi<local_limb_type>(a0b6)
-                )
-                ;
+        break;
       }
-
-      *(r + result_difference_type(INT32_C(0))) = static_cast<local_limb_type>(a0b0);
-      *(r + result_difference_type(INT32_C(1))) = static_cast<local_limb_type>(rd1);
-      *(r + result_difference_type(INT32_C(2))) = static_cast<local_limb_type>(rd2);
-      *(r + result_difference_type(INT32_C(3))) = static_cast<local_limb_type>(rd3);
-      *(r + result_difference_type(INT32_C(4))) = static_cast<local_limb_type>(rd4);
-      *(r + result_difference_type(INT32_C(5))) = static_cast<local_limb_type>(rd5);
-      *(r + result_difference_type(INT32_C(6))) = static_cast<local_limb_type>(rd6);
     }
-    #endif
 
-    template<typename ResultIterator,
-             typename InputIteratorLeft,
-             typename InputIteratorRight,
-             const size_t RePhraseWidth2 = Width2,
-             typename std::enable_if<(   (uintwide_t<RePhraseWidth2, LimbType, AllocatorType>::number_of_limbs != size_t(UINT32_C(4)))
-    #if defined(WIDE_INTEGER_HAS_MUL_8_BY_8_UNROLL)
-                                      && (uintwide_t<RePhraseWidth2, LimbType, AllocatorType>::number_of_limbs != size_t(UINT32_C(8)))
-    #endif
-                                     )>::type const* = nullptr>
-    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_lo_part(      ResultIterator     r,
-                                                                             InputIteratorLeft  a,
-                                                                             InputIteratorRight b,
-                                                                       const unsinged_fast_type count)
-    {
-      static_assert
-      (
-           (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
-        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits),
-        "Error: Internals require same widths for left-right-result limb_types at the moment"
-      );
+    return bpos;
+  }
 
-      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+  template<const size_t Width2,
+           typename LimbType>
+  WIDE_INTEGER_CONSTEXPR auto msb(const uintwide_view<Width2, LimbType>& x) -> unsinged_fast_type
+  {
+    // Calculate the position of the most-significant bit.
 
-      using local_double_limb_type =
-        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+    using local_view_type = uintwide_view<Width2, LimbType>;
+    using local_limb_type = typename local_view_type::limb_type;
 
-      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
-      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
-      using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+    auto bpos = unsinged_fast_type(0U);
 
-      std::fill_n(r, count, local_limb_type(0U));
+    for(auto i = static_cast<unsinged_fast_type>(local_view_type::number_of_limbs); i != 0U; --i)
+    {
+      const local_limb_type limb = *(x.data() + size_t(i - 1U)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-      for(unsinged_fast_type i = 0U; i < count; ++i)
+      if(limb != 0U)
       {
-        if(*(a + left_difference_type(i)) != local_limb_type(0U))
-        {
-          local_double_limb_type carry = 0U;
-
-          for(unsinged_fast_type j = 0U; j < unsinged_fast_type(count - i); ++j)
-          {
-            carry = local_double_limb_type(carry + local_double_limb_type(local_double_limb_type(*(a + left_difference_type(i))) * *(b + right_difference_type(j))));
-            carry = local_double_limb_type(carry + *(r + result_difference_type(i + j)));
+        bpos =   detail::msb_helper(limb)
+               + unsinged_fast_type(unsinged_fast_type(std::numeric_limits<local_limb_type>::digits) * (i - 1U));
 
-            *(r + result_difference_type(i + j)) = local_limb_type(carry);
-            carry                                = detail::make_hi<local_limb_type>(carry);
-          }
-        }
+        break;
       }
     }
 
-    template<typename ResultIterator,
-             typename InputIteratorLeft,
-             typename InputIteratorRight>
-    static WIDE_INTEGER_CONSTEXPR void eval_multiply_n_by_n_to_2n(      ResultIterator     r,
-                                                                        InputIteratorLeft  a,
-                                                                        InputIteratorRight b,
-                                                                  const unsinged_fast_type count)
-    {
-      static_assert
-      (
-           (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
-        && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits),
-        "Error: Internals require same widths for left-right-result limb_types at the moment"
-      );
+    return bpos;
+  }
 
-      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+  template<const size_t Width2,
+           typename LimbType>
+  WIDE_INTEGER_CONSTEXPR auto operator%(const uintwide_view<Width2, LimbType>&                                       u,
+                                        const limb_divisor<typename uintwide_view<Width2, LimbType>::limb_type>& d) -> typename uintwide_view<Width2, LimbType>::limb_type
+  {
+    // The remainder of the viewed value divided by the single-limb
+    // divisor d having a precomputed reciprocal. The limbs are only read.
+    return d.remainder(u.data(), unsinged_fast_type(uintwide_view<Width2, LimbType>::number_of_limbs));
+  }
 
-      using local_double_limb_type =
-        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+  template<typename UnsignedIntegralType,
+           const size_t Width2,
+           typename LimbType>
+  WIDE_INTEGER_CONSTEXPR auto operator%(const uintwide_view<Width2, LimbType>& u, const UnsignedIntegralType& v) -> typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
+                                                                                                                                            && (!std::is_signed<UnsignedIntegralType>::value)
+                                                                                                                                            && (std::numeric_limits<UnsignedIntegralType>::digits <= std::numeric_limits<typename uintwide_view<Width2, LimbType>::limb_type>::digits)), typename uintwide_view<Width2, LimbType>::limb_type>::type
+  {
+    // A one-off divisor uses the double-limb hardware division.
+    // For a reused divisor, take the overload with limb_divisor.
+    using local_limb_type = typename uintwide_view<Width2, LimbType>::limb_type;
 
-      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
-      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
-      using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
+    const auto d = static_cast<local_limb_type>(v);
 
-      std::fill_n(r, (count * 2U), local_limb_type(0U));
+    auto r = local_limb_type(0U);
 
-      for(unsinged_fast_type i = 0U; i < count; ++i)
+    if(d != local_limb_type(0U))
+    {
+      for(auto i = uintwide_view<Width2, LimbType>::number_of_limbs; i != 0U; --i)
       {
-        if(*(a + left_difference_type(i)) != local_limb_type(0U))
-        {
-          unsinged_fast_type j = 0U;
+        r = static_cast<local_limb_type>(detail::make_large<local_limb_type>(*(u.data() + size_t(i - 1U)), r) % d); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+    }
 
-          local_double_limb_type carry = 0U;
+    return r;
+  }
 
-          for( ; j < count; ++j)
-          {
-            carry    = local_double_limb_type(carry + local_double_limb_type(local_double_limb_type(*(a + left_difference_type(i))) * *(b + right_difference_type(j))));
-            carry    = local_double_limb_type(carry + *(r + result_difference_type(i + j)));
+  #if !defined(WIDE_INTEGER_DISABLE_TO_CHARS)
+  template<const size_t Width2,
+           typename LimbType>
+  WIDE_INTEGER_CONSTEXPR auto to_chars(char* first,
+                                       char* last,
+                                       const uintwide_view<Width2, LimbType>& x,
+                                       const int base = 10) -> to_chars_result
+  {
+    // The conversion divides a working copy of the value.
+    return to_chars(first, last, static_cast<typename uintwide_view<Width2, LimbType>::value_type>(x), base);
+  }
+  #endif
 
-            *(r + result_difference_type(i + j)) = local_limb_type(carry);
-            carry                                = detail::make_hi<local_limb_type>(carry);
-          }
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  class uniform_int_distribution
+  {
+  private:
+    using unsigned_result_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using local_limb_type      = typename unsigned_result_type::limb_type;
 
-          *(r + result_difference_type(i + j)) = local_limb_type(carry);
-        }
-      }
-    }
+  public:
+    using result_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
-    template<typename ResultIterator,
-             typename InputIteratorLeft>
-    static WIDE_INTEGER_CONSTEXPR auto eval_multiply_1d(      ResultIterator                                               r,
-                                                              InputIteratorLeft                                            a,
-                                                        const typename std::iterator_traits<InputIteratorLeft>::value_type b,
-                                                        const unsinged_fast_type                                           count) -> limb_type
+    struct param_type
     {
-      static_assert
-      (
-        (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits),
-        "Error: Internals require same widths for left-right-result limb_types at the moment"
-      );
-
-      using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+    public:
+      explicit param_type(const result_type& p_a = (std::numeric_limits<result_type>::min)(), // NOLINT(modernize-pass-by-value)
+                          const result_type& p_b = (std::numeric_limits<result_type>::max)()) // NOLINT(modernize-pass-by-value)
+        : param_a(p_a),
+          param_b(p_b)
+      {
+        update_range();
+      }
 
-      using local_double_limb_type =
-        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+      ~param_type() = default;
 
-      using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
-      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+      param_type(const param_type& other_params) : param_a            (other_params.param_a),
+                                                   param_b            (other_params.param_b),
+                                                   param_range        (other_params.param_range),
+                                                   param_is_full_range(other_params.param_is_full_range) { }
 
-      local_double_limb_type carry = 0U;
+      param_type(param_type&& other_params) noexcept : param_a            (other_params.param_a),
+                                                       param_b            (other_params.param_b),
+                                                       param_range        (other_params.param_range),
+                                                       param_is_full_range(other_params.param_is_full_range) { }
 
-      if(b == 0U)
-      {
-        std::fill(r, r + count, limb_type(0U));
-      }
-      else
+      auto operator=(const param_type& other_params) -> param_type&
       {
-        for(unsinged_fast_type i = 0U ; i < count; ++i)
+        if(this != &other_params)
         {
-          carry = local_double_limb_type(carry + local_double_limb_type(local_double_limb_type(*(a + left_difference_type(i))) * b));
-
-          *(r + result_difference_type(i)) = local_limb_type(carry);
-          carry                            = detail::make_hi<local_limb_type>(carry);
+          param_a             = other_params.param_a;
+          param_b             = other_params.param_b;
+          param_range         = other_params.param_range;
+          param_is_full_range = other_params.param_is_full_range;
         }
+
+        return *this;
       }
 
-      return local_limb_type(carry);
-    }
+      auto operator=(param_type&& other_params) noexcept -> param_type&
+      {
+        param_a             = other_params.param_a;
+        param_b             = other_params.param_b;
+        param_range         = other_params.param_range;
+        param_is_full_range = other_params.param_is_full_range;
 
-    template<typename InputIteratorLeft>
-    static WIDE_INTEGER_CONSTEXPR
-    void eval_multiply_kara_propagate_carry(      InputIteratorLeft                                            t,
-                                            const unsinged_fast_type                                           n,
-                                            const typename std::iterator_traits<InputIteratorLeft>::value_type carry)
-    {
-      using local_limb_type = typename std::iterator_traits<InputIteratorLeft>::value_type;
+        return *this;
+      }
 
-      using local_double_limb_type =
-        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+      constexpr auto get_a() const -> result_type { return param_a; }
+      constexpr auto get_b() const -> result_type { return param_b; }
 
-      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+      void set_a(const result_type& p_a) { param_a = p_a; update_range(); }
+      void set_b(const result_type& p_b) { param_b = p_b; update_range(); }
 
-      unsinged_fast_type i = 0U;
+    private:
+      result_type param_a;
+      result_type param_b;
 
-      local_limb_type carry_out = carry;
+      // The distance (b - a), evaluated once for the
+      // generation of many values, and whether it spans
+      // the full range of the type.
+      unsigned_result_type param_range;
+      bool                 param_is_full_range { };
 
-      while((i < n) && (carry_out != local_limb_type(0U)))
+      auto update_range() -> void
       {
-        const local_double_limb_type uv_as_ularge = local_double_limb_type(*(t + left_difference_type(i))) + carry_out;
+        param_range         = unsigned_result_type(param_b) - unsigned_result_type(param_a);
+        param_is_full_range = (param_range == (std::numeric_limits<unsigned_result_type>::max)());
+      }
 
-        carry_out = detail::make_hi<local_limb_type>(uv_as_ularge);
+      friend class uniform_int_distribution;
 
-        *(t + left_difference_type(i)) = local_limb_type(uv_as_ularge);
+      friend inline constexpr auto operator==(const param_type& lhs,
+                                              const param_type& rhs) -> bool
+      {
+        return (   (lhs.param_a == rhs.param_a)
+                && (lhs.param_b == rhs.param_b));
+      }
 
-        ++i;
+      friend inline constexpr auto operator!=(const param_type& lhs,
+                                              const param_type& rhs) -> bool
+      {
+        return (   (lhs.param_a != rhs.param_a)
+                || (lhs.param_b != rhs.param_b));
       }
-    }
+    };
 
-    template<typename InputIteratorLeft>
-    static WIDE_INTEGER_CONSTEXPR
-    void eval_multiply_kara_propagate_borrow(      InputIteratorLeft  t,
-                                             const unsinged_fast_type n,
-                                             const bool               has_borrow)
-    {
-      using local_limb_type = typename std::iterator_traits<InputIteratorLeft>::value_type;
+    uniform_int_distribution() : my_params() { }
 
-      using local_double_limb_type =
-        typename detail::uint_type_helper<size_t(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+    explicit uniform_int_distribution(const result_type& p_a,
+                                      const result_type& p_b = (std::numeric_limits<result_type>::max)())
+        : my_params(param_type(p_a, p_b)) { }
 
-      using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
+    explicit uniform_int_distribution(const param_type& other_params)
+      : my_params(other_params) { }
 
-      unsinged_fast_type i = 0U;
+    uniform_int_distribution(const uniform_int_distribution& other_distribution) = delete;
 
-      bool has_borrow_out = has_borrow;
+    uniform_int_distribution(uniform_int_distribution&& other) noexcept : my_params(other.my_params) { }
 
-      while((i < n) && (has_borrow_out))
+    ~uniform_int_distribution() = default;
+
+    auto operator=(const uniform_int_distribution& other) -> uniform_int_distribution&
+    {
+      if(this != &other)
       {
-        auto uv_as_ularge = local_double_limb_type(*(t + left_difference_type(i)));
+        my_params = other.my_params;
+      }
 
-        if(has_borrow_out)
-        {
-          --uv_as_ularge;
-        }
+      return *this;
+    }
 
-        has_borrow_out = (detail::make_hi<local_limb_type>(uv_as_ularge) != local_limb_type(0U));
+    auto operator=(uniform_int_distribution&& other) noexcept -> uniform_int_distribution&
+    {
+      my_params = other.my_params;
 
-        *(t + left_difference_type(i)) = local_limb_type(uv_as_ularge);
+      return *this;
+    }
 
-        ++i;
-      }
+    void param(const param_type& new_params)
+    {
+      my_params = new_params;
     }
 
-    template<typename ResultIterator,
-             typename InputIteratorLeft,
-             typename InputIteratorRight,
-             typename InputIteratorTemp>
-    static WIDE_INTEGER_CONSTEXPR
-    void eval_multiply_kara_n_by_n_to_2n(      ResultIterator     r, // NOLINT(misc-no-recursion)
-                                         const InputIteratorLeft  a,
-                                         const InputIteratorRight b,
-                                         const unsinged_fast_type n,
-                                               InputIteratorTemp  t)
+    auto param() const -> const param_type& { return my_params; }
+
+    auto a() const -> result_type { return my_params.get_a(); }
+    auto b() const -> result_type { return my_params.get_b(); }
+
+    template<typename GeneratorType,
+             const int GeneratorResultBits = std::numeric_limits<typename GeneratorType::result_type>::digits>
+    WIDE_INTEGER_CONSTEXPR auto operator()(GeneratorType& generator) -> result_type
     {
-      if(n <= unsinged_fast_type(UINT32_C(48)))
-      {
-        static_cast<void>(t);
+      return generate<GeneratorType, GeneratorResultBits>(generator, my_params);
+    }
 
-        eval_multiply_n_by_n_to_2n(r, a, b, n);
-      }
-      else
-      {
-        static_assert
-        (
-             (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorLeft>::value_type>::digits)
-          && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorRight>::value_type>::digits)
-          && (std::numeric_limits<typename std::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename std::iterator_traits<InputIteratorTemp>::value_type>::digits),
-          "Error: Internals require same widths for left-right-result limb_types at the moment"
-        );
+    template<typename GeneratorType,
+             const int GeneratorResultBits = std::numeric_limits<typename GeneratorType::result_type>::digits>
+    WIDE_INTEGER_CONSTEXPR auto operator()(      GeneratorType& input_generator,
+                                           const param_type&    input_params) -> result_type
+    {
+      return generate<GeneratorType, GeneratorResultBits>(input_generator, input_params);
+    }
+
+    // Fill [first, last) with random numbers. The range of the
+    // generator results and the distribution parameters are
+    // evaluated once, and no random bits are discarded between
+    // consecutive values.
+    template<typename ForwardIteratorType,
+             typename GeneratorType,
+             const int GeneratorResultBits = std::numeric_limits<typename GeneratorType::result_type>::digits>
+    WIDE_INTEGER_CONSTEXPR auto generate_n(ForwardIteratorType first,
+                                           ForwardIteratorType last,
+                                           GeneratorType&      input_generator) -> void
+    {
+      generate_n<ForwardIteratorType, GeneratorType, GeneratorResultBits>(first, last, input_generator, my_params);
+    }
 
-        using local_limb_type = typename std::iterator_traits<ResultIterator>::value_type;
+    template<typename ForwardIteratorType,
+             typename GeneratorType,
+             const int GeneratorResultBits = std::numeric_limits<typename GeneratorType::result_type>::digits>
+    WIDE_INTEGER_CONSTEXPR auto generate_n(      ForwardIteratorType first,
+                                                 ForwardIteratorType last,
+                                                 GeneratorType&      input_generator,
+                                           const param_type&         input_params) -> void
+    {
+      bit_source<GeneratorType> source(input_generator, generator_value_bits<GeneratorType, GeneratorResultBits>());
 
-        using result_difference_type = typename std::iterator_traits<ResultIterator>::difference_type;
-        using left_difference_type   = typename std::iterator_traits<InputIteratorLeft>::difference_type;
-        using right_difference_type  = typename std::iterator_traits<InputIteratorRight>::difference_type;
-        using temp_difference_type   = typename std::iterator_traits<InputIteratorTemp>::difference_type;
+      for( ; first != last; ++first)
+      {
+        *first = generate_from(source, input_params);
+      }
+    }
 
-        // Based on "Algorithm 1.3 KaratsubaMultiply", Sect. 1.3.2, page 5
-        // of R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic",
-        // Cambridge University Press (2011).
+  private:
+    param_type my_params;
 
-        // The Karatsuba multipliation computes the product of u*v as:
-        // [b^N + b^(N/2)] a1*b1 + [b^(N/2)](a1 - a0)(b0 - b1) + [b^(N/2) + 1] a0*b0
+    template<typename GeneratorType>
+    class bit_source
+    {
+    public:
+      // Hand out the random bits of the generator results limb
+      // by limb. The bits left over from one limb are used for
+      // the next one, also across the values of generate_n.
 
-        // Here we visualize u and v in two components 0,1 corresponding
-        // to the high and low order parts, respectively.
+      WIDE_INTEGER_CONSTEXPR bit_source(GeneratorType& generator, const unsigned value_bits)
+        : my_generator (generator),
+          my_value_bits(value_bits) { }
 
-        // Step 1
-        // Calculate a1*b1 and store it in the upper part of r.
-        // Calculate a0*b0 and store it in the lower part of r.
-        // copy r to t0.
+      WIDE_INTEGER_CONSTEXPR auto next_limb() -> local_limb_type
+      {
+        constexpr auto limb_digits = static_cast<unsigned>(std::numeric_limits<local_limb_type>::digits);
 
-        // Step 2
-        // Add a1*b1 (which is t2) to the middle two-quarters of r (which is r1)
-        // Add a0*b0 (which is t0) to the middle two-quarters of r (which is r1)
+        auto limb = static_cast<local_limb_type>(UINT8_C(0));
 
-        // Step 3
-        // Calculate |a1-a0| in t0 and note the sign (i.e., the borrow flag)
+        for(auto filled = static_cast<unsigned>(UINT8_C(0)); filled < limb_digits; )
+        {
+          if(my_pool_bits == 0U)
+          {
+            const auto value = static_cast<std::uint64_t>(static_cast<std::uint64_t>(my_generator()) - static_cast<std::uint64_t>((GeneratorType::min)()));
 
-        // Step 4
-        // Calculate |b0-b1| in t1 and note the sign (i.e., the borrow flag)
+            my_pool      = ((my_value_bits < 64U) ? static_cast<std::uint64_t>(value & ((UINT64_C(1) << my_value_bits) - 1U)) : value);
+            my_pool_bits = my_value_bits;
+          }
 
-        // Step 5
-        // Call kara mul to calculate |a1-a0|*|b0-b1| in (t2),
-        // while using temporary storage in t4 along the way.
+          const unsigned take = (std::min)(my_pool_bits, static_cast<unsigned>(limb_digits - filled));
 
-        // Step 6
-        // Check the borrow signs. If a1-a0 and b0-b1 have the same signs,
-        // then add |a1-a0|*|b0-b1| to r1, otherwise subtract it from r1.
+          limb = static_cast<local_limb_type>(limb | static_cast<local_limb_type>(static_cast<local_limb_type>(my_pool) << filled));
 
-        const unsinged_fast_type  nh = n / 2U;
+          my_pool       = ((take < 64U) ? static_cast<std::uint64_t>(my_pool >> take) : static_cast<std::uint64_t>(UINT8_C(0)));
+          my_pool_bits -= take;
+          filled       += take;
+        }
 
-        const InputIteratorLeft   a0 = a + left_difference_type(0);
-        const InputIteratorLeft   a1 = a + left_difference_type(nh);
+        return limb;
+      }
 
-        const InputIteratorRight  b0 = b + right_difference_type(0);
-        const InputIteratorRight  b1 = b + right_difference_type(nh);
+    private:
+      GeneratorType& my_generator;
+      const unsigned my_value_bits;
+      std::uint64_t  my_pool      { };
+      unsigned       my_pool_bits { };
+    };
 
-              ResultIterator      r0 = r + result_difference_type(0);
-              ResultIterator      r1 = r + result_difference_type(nh);
-              ResultIterator      r2 = r + result_difference_type(n);
-              ResultIterator      r3 = r + result_difference_type(n + nh);
+    template<typename GeneratorType,
+             const int GeneratorResultBits>
+    static WIDE_INTEGER_CONSTEXPR auto generator_value_bits() -> unsigned
+    {
+      // The number of random bits taken from each generator result:
+      // the bits spanned by the range of the generator, but at most
+      // GeneratorResultBits. For a generator whose range is not
+      // a power of two, such as std::minstd_rand, the result
+      // minus the minimum is truncated to the lower bits.
+      const auto span = static_cast<std::uint64_t>(static_cast<std::uint64_t>((GeneratorType::max)()) - static_cast<std::uint64_t>((GeneratorType::min)()));
 
-              InputIteratorTemp   t0 = t + temp_difference_type(0);
-              InputIteratorTemp   t1 = t + temp_difference_type(nh);
-              InputIteratorTemp   t2 = t + temp_difference_type(n);
-              InputIteratorTemp   t4 = t + temp_difference_type(n + n);
+      const unsigned span_bits =
+        ((span == (std::numeric_limits<std::uint64_t>::max)())
+          ? 64U
+          : static_cast<unsigned>(detail::msb_helper(static_cast<std::uint64_t>(span + 1U))));
 
-        // Step 1
-        //   a1*b1 -> r2
-        //   a0*b0 -> r0
-        //   r -> t0
-        eval_multiply_kara_n_by_n_to_2n(r2, a1, b1, nh, t0);
-        eval_multiply_kara_n_by_n_to_2n(r0, a0, b0, nh, t0);
-        std::copy(r0, r0 + (2U * n), t0);
+      return (std::max)(1U, (std::min)(span_bits, static_cast<unsigned>(GeneratorResultBits)));
+    }
 
-        local_limb_type carry;
+    template<typename GeneratorType>
+    static WIDE_INTEGER_CONSTEXPR auto generate_from(bit_source<GeneratorType>& source,
+                                                     const param_type&          input_params) -> result_type
+    {
+      // Generate random numbers r, where a <= r <= b.
 
-        // Step 2
-        //   r1 += a1*b1
-        //   r1 += a0*b0
-        carry = eval_add_n(r1, r1, t2, n);
-        eval_multiply_kara_propagate_carry(r3, nh, carry);
-        carry = eval_add_n(r1, r1, t0, n);
-        eval_multiply_kara_propagate_carry(r3, nh, carry);
+      const unsigned_result_type& range = input_params.param_range;
 
-        // Step 3
-        //   |a1-a0| -> t0
-        const std::int_fast8_t cmp_result_a1a0 = compare_ranges(a1, a0, nh);
+      unsigned_result_type result(std::uint8_t(0U));
 
-        if(cmp_result_a1a0 == 1)
-        {
-          static_cast<void>(eval_subtract_n(t0, a1, a0, nh));
-        }
-        else if(cmp_result_a1a0 == -1)
+      if(input_params.param_is_full_range)
+      {
+        // The full range is filled limb by limb.
+        for(auto it = result.representation().begin(); it != result.representation().end(); ++it) // NOLINT(llvm-qualified-auto,readability-qualified-auto)
         {
-          static_cast<void>(eval_subtract_n(t0, a0, a1, nh));
+          *it = source.next_limb();
         }
+      }
+      else
+      {
+        // Fill only the limbs of (b - a) and mask them to the bits
+        // of (b - a). Reject values above (b - a), which happens for
+        // less than half of the attempts, so that r is unbiased.
+        constexpr auto limb_digits = static_cast<unsinged_fast_type>(std::numeric_limits<local_limb_type>::digits);
 
-        // Step 4
-        //   |b0-b1| -> t1
-        const std::int_fast8_t cmp_result_b0b1 = compare_ranges(b0, b1, nh);
-
-        if(cmp_result_b0b1 == 1)
-        {
-          static_cast<void>(eval_subtract_n(t1, b0, b1, nh));
-        }
-        else if(cmp_result_b0b1 == -1)
-        {
-          static_cast<void>(eval_subtract_n(t1, b1, b0, nh));
-        }
+        const auto range_bits = static_cast<unsinged_fast_type>(range.is_zero() ? 1U : static_cast<unsinged_fast_type>(msb(range) + 1U));
+        const auto limb_count = static_cast<size_t>((range_bits + (limb_digits - 1U)) / limb_digits);
+        const auto top_bits   = static_cast<unsinged_fast_type>(range_bits - static_cast<unsinged_fast_type>((limb_count - 1U) * limb_digits));
 
-        // Step 5
-        //   |a1-a0|*|b0-b1| -> t2
-        eval_multiply_kara_n_by_n_to_2n(t2, t0, t1, nh, t4);
+        const auto top_mask =
+          static_cast<local_limb_type>
+          (
+            (top_bits < limb_digits) ? static_cast<local_limb_type>(static_cast<local_limb_type>(static_cast<local_limb_type>(1U) << top_bits) - 1U)
+                                     : (std::numeric_limits<local_limb_type>::max)()
+          );
 
-        // Step 6
-        //   either r1 += |a1-a0|*|b0-b1|
-        //   or     r1 -= |a1-a0|*|b0-b1|
-        if((cmp_result_a1a0 * cmp_result_b0b1) == 1)
+        do
         {
-          carry = eval_add_n(r1, r1, t2, n);
+          auto it = result.representation().begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
 
-          eval_multiply_kara_propagate_carry(r3, nh, carry);
-        }
-        else if((cmp_result_a1a0 * cmp_result_b0b1) == -1)
-        {
-          const bool has_borrow = eval_subtract_n(r1, r1, t2, n);
+          for(auto i = static_cast<size_t>(0U); i < limb_count; ++i)
+          {
+            *it++ = source.next_limb();
+          }
 
-          eval_multiply_kara_propagate_borrow(r3, nh, has_borrow);
+          *(it - 1) = static_cast<local_limb_type>(*(it - 1) & top_mask);
         }
+        while(result > range);
+
+        result += unsigned_result_type(input_params.param_a);
       }
+
+      return result_type(result);
     }
 
-    WIDE_INTEGER_CONSTEXPR void eval_divide_knuth(const uintwide_t& other, // NOLINT(readability-function-cognitive-complexity)
-                                                        uintwide_t* remainder)
+    template<typename GeneratorType,
+             const int GeneratorResultBits = std::numeric_limits<typename GeneratorType::result_type>::digits>
+    WIDE_INTEGER_CONSTEXPR auto generate(      GeneratorType& input_generator,
+                                         const param_type&    input_params) const -> result_type
     {
-      // Use Knuth's long division algorithm.
-      // The loop-ordering of indices in Knuth's original
-      // algorithm has been reversed due to the data format
-      // used here. Several optimizations and combinations
-      // of logic have been carried out in the source code.
+      bit_source<GeneratorType> source(input_generator, generator_value_bits<GeneratorType, GeneratorResultBits>());
 
-      // See also:
-      // D.E. Knuth, "The Art of Computer Programming, Volume 2:
-      // Seminumerical Algorithms", Addison-Wesley (1998),
-      // Section 4.3.1 Algorithm D and Exercise 16.
+      return generate_from(source, input_params);
+    }
+  };
 
-      using local_uint_index_type = unsinged_fast_type;
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto operator==(const uniform_int_distribution<Width2, LimbType, AllocatorType, IsSigned>& lhs,
+                            const uniform_int_distribution<Width2, LimbType, AllocatorType, IsSigned>& rhs) -> bool
+  {
+    return (lhs.param() == rhs.param());
+  }
 
-      auto u_offset = local_uint_index_type(0U);
-      auto v_offset = local_uint_index_type(0U);
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto operator!=(const uniform_int_distribution<Width2, LimbType, AllocatorType, IsSigned>& lhs,
+                            const uniform_int_distribution<Width2, LimbType, AllocatorType, IsSigned>& rhs) -> bool
+  {
+    return (lhs.param() != rhs.param());
+  }
 
-      // Compute the offsets for u and v.
-      for(auto i = local_uint_index_type(0U); (i < number_of_limbs) && (*(      values.cbegin() + size_t(local_uint_index_type(number_of_limbs - 1U) - i)) == limb_type(0U)); ++i) { ++u_offset; }
-      for(auto i = local_uint_index_type(0U); (i < number_of_limbs) && (*(other.values.cbegin() + size_t(local_uint_index_type(number_of_limbs - 1U) - i)) == limb_type(0U)); ++i) { ++v_offset; }
+  namespace detail {
 
-      if(v_offset == local_uint_index_type(number_of_limbs))
-      {
-        // The denominator is zero. Set the maximum value and return.
-        // This also catches (0 / 0) and sets the maximum value for it.
-        operator=(limits_helper_max(IsSigned));
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto prime_small_checks(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& np, // NOLINT(readability-function-cognitive-complexity)
+                          bool&                                                        is_prime) -> bool
+  {
+    // Decide the primality of the positive np if it is even
+    // or less than or equal to 227, or if it has a prime factor
+    // less than or equal to 227. The return value tells whether
+    // primality has been decided, with the result in is_prime.
 
-        if(remainder != nullptr)
-        {
-          *remainder = uintwide_t(std::uint8_t(0U));
-        }
-      }
-      else if(u_offset == local_uint_index_type(number_of_limbs))
-      {
-        // The numerator is zero. Do nothing and return.
+    // Note: Some comments in this subroutine use the Wolfram Language(TM).
+    // These can be exercised at the web links to WolframAlpha(R) provided
 
-        if(remainder != nullptr)
-        {
-          *remainder = uintwide_t(std::uint8_t(0U));
-        }
-      }
-      else
-      {
-        const auto result_of_compare_left_with_right = compare(other);
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
 
-        const bool left_is_less_than_right = (result_of_compare_left_with_right == INT8_C(-1));
-        const bool left_is_equal_to_right  = (result_of_compare_left_with_right == INT8_C( 0));
+    {
+      const local_limb_type n0(np);
 
-        if(left_is_less_than_right)
-        {
-          // If the denominator is larger than the numerator,
-          // then the result of the division is zero.
-          if(remainder != nullptr)
-          {
-            *remainder = *this;
-          }
+      if((n0 & 1U) == 0U)
+      {
+        // Not prime because n is even, except for the
+        // trivial special case of (n = 2).
+        is_prime = ((n0 == local_limb_type(UINT8_C(2))) && (np == local_limb_type(UINT8_C(2))));
 
-          operator=(std::uint8_t(0U));
-        }
-        else if(left_is_equal_to_right)
-        {
-          // If the denominator is equal to the numerator,
-          // then the result of the division is one.
-          operator=(std::uint8_t(1U));
+        return true;
+      }
 
-          if(remainder != nullptr)
-          {
-            *remainder = uintwide_t(std::uint8_t(0U));
-          }
-        }
-        else if(v_offset == local_uint_index_type(number_of_limbs - 1U))
-        {
-          // The denominator has one single limb.
-          // Use a one-dimensional division algorithm.
-          const limb_type short_denominator = *other.values.cbegin();
+      if((n0 <= local_limb_type(UINT8_C(227))) && (np <= local_limb_type(UINT8_C(227))))
+      {
+        // Exclude pure small primes from 3...227.
+        // Table[Prime[i], {i, 2, 49}] =
+        // {
+        //     3,   5,   7,  11,  13,  17,  19,  23,
+        //    29,  31,  37,  41,  43,  47,  53,  59,
+        //    61,  67,  71,  73,  79,  83,  89,  97,
+        //   101, 103, 107, 109, 113, 127, 131, 137,
+        //   139, 149, 151, 157, 163, 167, 173, 179,
+        //   181, 191, 193, 197, 199, 211, 223, 227
+        // }
+        // See also:
+        // https://www.wolframalpha.com/input/?i=Table%5BPrime%5Bi%5D%2C+%7Bi%2C+2%2C+49%7D%5D
 
-          eval_divide_by_single_limb(short_denominator, u_offset, remainder);
-        }
-        else
-        {
-          // We will now use the Knuth long division algorithm.
+        constexpr std::array<local_limb_type, 48U> small_primes = 
+        {{
+          UINT8_C(  3), UINT8_C(  5), UINT8_C(  7), UINT8_C( 11), UINT8_C( 13), UINT8_C( 17), UINT8_C( 19), UINT8_C( 23),
+          UINT8_C( 29), UINT8_C( 31), UINT8_C( 37), UINT8_C( 41), UINT8_C( 43), UINT8_C( 47), UINT8_C( 53), UINT8_C( 59),
+          UINT8_C( 61), UINT8_C( 67), UINT8_C( 71), UINT8_C( 73), UINT8_C( 79), UINT8_C( 83), UINT8_C( 89), UINT8_C( 97),
+          UINT8_C(101), UINT8_C(103), UINT8_C(107), UINT8_C(109), UINT8_C(113), UINT8_C(127), UINT8_C(131), UINT8_C(137),
+          UINT8_C(139), UINT8_C(149), UINT8_C(151), UINT8_C(157), UINT8_C(163), UINT8_C(167), UINT8_C(173), UINT8_C(179),
+          UINT8_C(181), UINT8_C(191), UINT8_C(193), UINT8_C(197), UINT8_C(199), UINT8_C(211), UINT8_C(223), UINT8_C(227)
+        }};
 
-          // Compute the normalization factor d.
-          const auto d =
-            limb_type(double_limb_type(  double_limb_type(double_limb_type(1U) << unsigned(std::numeric_limits<limb_type>::digits))
-                                       / double_limb_type(double_limb_type(*(other.values.cbegin() + size_t(local_uint_index_type(number_of_limbs - 1U) - v_offset))) + limb_type(1U))));
+        is_prime = std::binary_search(small_primes.cbegin(),
+                                      small_primes.cend(),
+                                      n0);
 
-          // Step D1(b), normalize u -> u * d = uu.
-          // Step D1(c): normalize v -> v * d = vv.
+        return true;
+      }
+    }
 
-          using uu_array_type =
-            typename std::conditional<std::is_same<AllocatorType, void>::value,
-                                      detail::fixed_static_array <limb_type, number_of_limbs + 1U>,
-                                      detail::fixed_dynamic_array<limb_type,
-                                                                  number_of_limbs + 1U,
-                                                                  typename std::allocator_traits<typename std::conditional<std::is_same<AllocatorType, void>::value,
-                                                                                                                           std::allocator<void>,
-                                                                                                                           AllocatorType>::type>::template rebind_alloc<limb_type>>>::type;
+    // Check small factors.
 
-          uu_array_type       uu;
-          representation_type vv;
+    // Exclude small prime factors from { 3 ...  53 }.
+    // Product[Prime[i], {i, 2, 16}] = 16294579238595022365
+    // See also: https://www.wolframalpha.com/input/?i=Product%5BPrime%5Bi%5D%2C+%7Bi%2C+2%2C+16%7D%5D
+    {
+      constexpr std::uint64_t pp0 = UINT64_C(16294579238595022365);
 
-          if(d > limb_type(1U))
-          {
-            *(uu.begin() + size_t(local_uint_index_type(number_of_limbs) - u_offset)) =
-              eval_multiply_1d(uu.data(), values.data(), d, number_of_limbs - u_offset);
+      const std::uint64_t m0(np % pp0);
 
-            static_cast<void>(eval_multiply_1d(vv.data(), other.values.data(), d, number_of_limbs - v_offset));
-          }
-          else
-          {
-            std::copy(values.cbegin(), values.cend(), uu.begin());
+      if(detail::integer_gcd_reduce_large(m0, pp0) != 1U)
+      {
+        is_prime = false;
 
-            *(uu.begin() + size_t(local_uint_index_type(number_of_limbs) - u_offset)) = limb_type(0U);
+        return true;
+      }
+    }
 
-            vv = other.values;
-          }
+    // Exclude small prime factors from { 59 ... 101 }.
+    // Product[Prime[i], {i, 17, 26}] = 7145393598349078859
+    // See also: https://www.wolframalpha.com/input/?i=Product%5BPrime%5Bi%5D%2C+%7Bi%2C+17%2C+26%7D%5D
+    {
+      constexpr std::uint64_t pp1 = UINT64_C(7145393598349078859);
 
-          // Step D2: Initialize j.
-          // Step D7: Loop on j from m to 0.
+      const std::uint64_t m1(np % pp1);
 
-          const auto n   = local_uint_index_type(number_of_limbs - v_offset);
-          const auto m   = local_uint_index_type(number_of_limbs - u_offset) - n;
-          const auto vj0 = local_uint_index_type((number_of_limbs - 1U) - v_offset);
+      if(detail::integer_gcd_reduce_large(m1, pp1) != 1U)
+      {
+        is_prime = false;
 
-          for(auto j = local_uint_index_type(0U); j <= m; ++j)
-          {
-            // Step D3 [Calculate q_hat].
-            //   if u[j] == v[j0]
-            //     set q_hat = b - 1
-            //   else
-            //     set q_hat = (u[j] * b + u[j + 1]) / v[1]
+        return true;
+      }
+    }
 
-            const auto uj     = local_uint_index_type(local_uint_index_type(local_uint_index_type(local_uint_index_type(number_of_limbs + 1U) - 1U) - u_offset) - j);
-            const auto u_j_j1 = double_limb_type(double_limb_type(double_limb_type(*(uu.cbegin() + size_t(uj))) << unsigned(std::numeric_limits<limb_type>::digits)) + *(uu.cbegin() + size_t(uj - 1U)));
+    // Exclude small prime factors from { 103 ... 149 }.
+    // Product[Prime[i], {i, 27, 35}] = 6408001374760705163
+    // See also: https://www.wolframalpha.com/input/?i=Product%5BPrime%5Bi%5D%2C+%7Bi%2C+27%2C+35%7D%5D
+    {
+      constexpr std::uint64_t pp2 = UINT64_C(6408001374760705163);
 
-            limb_type q_hat = ((*(uu.cbegin() + size_t(uj)) == *(vv.cbegin() + size_t(vj0)))
-              ? (std::numeric_limits<limb_type>::max)()
-              : limb_type(u_j_j1 / *(vv.cbegin() + size_t(vj0))));
+      const std::uint64_t m2(np % pp2);
 
-            // Decrease q_hat if necessary.
-            // This means that q_hat must be decreased if the
-            // expression [(u[uj] * b + u[uj - 1] - q_hat * v[vj0 - 1]) * b]
-            // exceeds the range of uintwide_t.
+      if(detail::integer_gcd_reduce_large(m2, pp2) != 1U)
+      {
+        is_prime = false;
 
-            for(auto t = double_limb_type(u_j_j1 - double_limb_type(q_hat * double_limb_type(*(vv.cbegin() + size_t(vj0))))); ; --q_hat, t = double_limb_type(t + *(vv.cbegin() + size_t(vj0))))
-            {
-              if(   (detail::make_hi<limb_type>(t) != limb_type(0U))
-                 || (   double_limb_type(double_limb_type(*(vv.cbegin() + size_t(vj0 - 1U))) * q_hat)
-                     <= double_limb_type(double_limb_type(t << unsigned(std::numeric_limits<limb_type>::digits)) + *(uu.cbegin() + size_t(uj - 2U)))))
-              {
-                break;
-              }
-            }
+        return true;
+      }
+    }
 
-            // Step D4: Multiply and subtract.
-            // Replace u[j, ... j + n] by u[j, ... j + n] - q_hat * v[1, ... n].
+    // Exclude small prime factors from { 151 ... 191 }.
+    // Product[Prime[i], {i, 36, 43}] = 690862709424854779
+    // See also: https://www.wolframalpha.com/input/?i=Product%5BPrime%5Bi%5D%2C+%7Bi%2C+36%2C+43%7D%5D
+    {
+      constexpr std::uint64_t pp3 = UINT64_C(690862709424854779);
 
-            // Set nv = q_hat * (v[1, ... n]).
-            uu_array_type nv;
+      const std::uint64_t m3(np % pp3);
 
-            *(nv.begin() + size_t(n)) = eval_multiply_1d(nv.data(), vv.data(), q_hat, n);
+      if(detail::integer_gcd_reduce_large(m3, pp3) != 1U)
+      {
+        is_prime = false;
 
-            const bool has_borrow =
-              eval_subtract_n(uu.data() + size_t(local_uint_index_type(uj - n)),
-                              uu.data() + size_t(local_uint_index_type(uj - n)),
-                              nv.data(),
-                              n + 1U);
+        return true;
+      }
+    }
 
+    // Exclude small prime factors from { 193 ... 227 }.
+    // Product[Prime[i], {i, 44, 49}] = 80814592450549
+    // See also: https://www.wolframalpha.com/input/?i=Product%5BPrime%5Bi%5D%2C+%7Bi%2C+44%2C+49%7D%5D
+    {
+      constexpr std::uint64_t pp4 = UINT64_C(80814592450549);
 
-            // Get the result data.
-            *(values.begin() + size_t(m - j)) = limb_type(q_hat - (has_borrow ? 1U : 0U));
+      const std::uint64_t m4(np % pp4);
 
-            // Step D5: Test the remainder.
-            // Set the result value: Set result.m_data[m - j] = q_hat.
-            // Use the condition (u[j] < 0), in other words if the borrow
-            // is non-zero, then step D6 needs to be carried out.
+      if(detail::integer_gcd_reduce_large(m4, pp4) != 1U)
+      {
+        is_prime = false;
 
-            if(has_borrow)
-            {
-              // Step D6: Add back.
-              // Add v[1, ... n] back to u[j, ... j + n],
-              // and decrease the result by 1.
+        return true;
+      }
+    }
 
-              static_cast<void>(eval_add_n(uu.data() + size_t(local_uint_index_type(uj - n)),
-                                           uu.data() + size_t(local_uint_index_type(uj - n)),
-                                           vv.data(),
-                                           n));
-            }
-          }
+    return false;
+  }
 
-          // Clear the data elements that have not
-          // been computed in the division algorithm.
-          std::fill(values.begin() + local_uint_index_type(m + 1U), values.end(), limb_type(0U));
+  template<typename DistributionType,
+           typename GeneratorType,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto miller_rabin_rounds(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& np, // NOLINT(readability-function-cognitive-complexity)
+                           const unsinged_fast_type                                     number_of_trials,
+                           DistributionType&                                            distribution,
+                           GeneratorType&                                               generator) -> bool
+  {
+    // The Fermat test and the random Miller-Rabin trials. The
+    // candidate np is positive, odd and greater than 228.
 
-          if(remainder != nullptr)
-          {
-            if(d == 1U)
-            {
-              std::copy(uu.cbegin(),
-                        uu.cbegin() + size_t(local_uint_index_type(number_of_limbs - v_offset)),
-                        remainder->values.begin());
-            }
-            else
-            {
-              auto previous_u = limb_type(0U);
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
 
-              for(auto rl = singed_fast_type(n - 1U), ul = singed_fast_type(number_of_limbs - (v_offset + 1U)); rl >= 0; --rl, --ul)
-              {
-                const auto t =
-                  double_limb_type(  *(uu.cbegin() + size_t(ul))
-                                   + double_limb_type(double_limb_type(previous_u) << unsigned(std::numeric_limits<limb_type>::digits)));
+    const local_wide_integer_type nm1(np - 1U);
 
-                *(remainder->values.begin() + size_t(rl)) = limb_type(double_limb_type(t / d));
-                previous_u                                = limb_type(double_limb_type(t - double_limb_type(double_limb_type(d) * *(remainder->values.cbegin() + size_t(rl)))));
-              }
-            }
+    {
+      // Perform a single Fermat test which will
+      // exclude many non-prime candidates.
 
-            std::fill(remainder->values.begin() + size_t(n),
-                      remainder->values.end(),
-                      limb_type(0U));
-          }
-        }
+      const local_wide_integer_type fn = powm(local_wide_integer_type(local_limb_type(228U)), nm1, np);
+
+      const auto fn0 = static_cast<local_limb_type>(fn);
+
+      if((fn0 != 1U) && (fn != 1U))
+      {
+        return false;
       }
     }
 
-    WIDE_INTEGER_CONSTEXPR void shl(const unsinged_fast_type offset,
-                                    const std::uint_fast16_t left_shift_amount)
-    {
-      if(offset > 0U)
-      {
-        std::copy_backward(values.data(),
-                           values.data() + size_t(number_of_limbs - offset),
-                           values.data() + size_t(number_of_limbs));
+    const unsinged_fast_type k = lsb(nm1);
 
-        std::fill(values.begin(), values.begin() + size_t(offset), limb_type(0U));
-      }
+    const local_wide_integer_type q = nm1 >> k;
 
-      using local_integral_type = unsinged_fast_type;
+    using local_param_type = typename DistributionType::param_type;
 
-      if(left_shift_amount != local_integral_type(0U))
-      {
-        auto part_from_previous_value = limb_type(0U);
+    const local_param_type params(local_wide_integer_type(2U), np - 2U);
 
-        for(unsinged_fast_type i = offset; i < unsinged_fast_type(number_of_limbs); ++i)
-        {
-          const limb_type t = *(values.cbegin() + size_t(i));
+    // The repeated squarings modulo n use a precomputed Barrett reducer.
+    using local_unsigned_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using local_unsigned_double_width_type = typename local_unsigned_wide_integer_type::double_width_type;
 
-          *(values.begin() + size_t(i)) =
-            limb_type(limb_type(t << local_integral_type(left_shift_amount)) | part_from_previous_value);
+    const local_unsigned_wide_integer_type                  np_unsigned(np);
+    const barrett_reducer<local_unsigned_wide_integer_type> reducer    (np_unsigned);
 
-          part_from_previous_value =
-            limb_type(t >> local_integral_type(unsinged_fast_type(std::numeric_limits<limb_type>::digits - left_shift_amount)));
-        }
-      }
-    }
+    bool is_probably_prime = true;
 
-    WIDE_INTEGER_CONSTEXPR void shr(const unsinged_fast_type offset,
-                                    const std::uint_fast16_t right_shift_amount)
-    {
-      if(offset > 0U)
-      {
-        std::copy(values.begin() + size_t(offset),
-                  values.begin() + size_t(number_of_limbs),
-                  values.begin());
+    unsinged_fast_type i = 0U;
 
-        std::fill(values.end() - size_t(offset),
-                  values.end(),
-                  (!is_neg(*this)) ? limb_type(0U) : limb_type((std::numeric_limits<limb_type>::max)()));
-      }
+    local_wide_integer_type x;
+    local_wide_integer_type y;
 
-      using local_integral_type = unsinged_fast_type;
+    // Execute the random trials.
+    do
+    {
+      x = distribution(generator, params);
+      y = powm(x, q, np);
 
-      if(right_shift_amount != local_integral_type(0U))
+      unsinged_fast_type j = 0U;
+
+      while(y != nm1)
       {
-        limb_type part_from_previous_value =
-          (!is_neg(*this))
-            ? limb_type(0U)
-            : limb_type((std::numeric_limits<limb_type>::max)() << std::uint_fast16_t(std::uint_fast16_t(std::numeric_limits<limb_type>::digits) - right_shift_amount));
+        const local_limb_type y0(y);
 
-        for(auto i = singed_fast_type((number_of_limbs - 1U) - offset); i >= singed_fast_type(0); --i)
+        if((y0 == 1U) && (y == 1U))
         {
-          const limb_type t = *(values.cbegin() + size_t(i));
+          // Reaching one without passing through n - 1
+          // (other than in the first step) proves n composite.
+          is_probably_prime = (j == 0U);
 
-          *(values.begin() + size_t(i)) = limb_type(limb_type(t >> local_integral_type(right_shift_amount)) | part_from_previous_value);
+          break;
+        }
 
-          part_from_previous_value = limb_type(t << local_integral_type(unsinged_fast_type(std::numeric_limits<limb_type>::digits - right_shift_amount)));
+        ++j;
+
+        if(j == k)
+        {
+          is_probably_prime = false;
+
+          break;
         }
+
+        local_unsigned_double_width_type y2 = local_unsigned_wide_integer_type(y);
+
+        y2 *= y2;
+
+        y = reducer.reduce(y2);
       }
+
+      ++i;
     }
+    while((i < number_of_trials) && is_probably_prime);
 
-    // Read string function.
-    WIDE_INTEGER_CONSTEXPR auto rd_string(const char* str_input) -> bool // NOLINT(readability-function-cognitive-complexity)
-    {
-      std::fill(values.begin(), values.end(), limb_type(0U));
+    // The prime candidate is probably prime in the sense
+    // of the very high probability resulting from Miller-Rabin.
+    return is_probably_prime;
+  }
+
+  } // namespace detail
+
+  template<typename DistributionType,
+           typename GeneratorType,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto miller_rabin(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& n, // NOLINT(readability-function-cognitive-complexity)
+                    const unsinged_fast_type                                     number_of_trials,
+                    DistributionType&                                            distribution,
+                    GeneratorType&                                               generator) -> bool
+  {
+    // This Miller-Rabin primality test is loosely based on
+    // an adaptation of some code from Boost.Multiprecision.
+    // The Boost.Multiprecision code can be found here:
+    // https://www.boost.org/doc/libs/1_76_0/libs/multiprecision/doc/html/boost_multiprecision/tut/primetest.html
 
-      const unsinged_fast_type str_length = detail::strlen_unsafe(str_input);
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
-      std::uint_fast8_t base = UINT8_C(10);
+    const local_wide_integer_type np((local_wide_integer_type::is_neg(n) == false) ? n : -n);
 
-      unsinged_fast_type pos = 0U;
+    {
+      bool is_prime { };
 
-      // Detect: Is there a plus sign?
-      // And if there is a plus sign, skip over the plus sign.
-      if((str_length > 0U) && (str_input[0U] == char('+'))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      if(detail::prime_small_checks(np, is_prime))
       {
-        ++pos;
+        return is_prime;
       }
+    }
 
-      bool str_has_neg_sign = false;
+    // Since we have already excluded all small factors
+    // up to and including 227, n is greater than 227.
+    return detail::miller_rabin_rounds(np, number_of_trials, distribution, generator);
+  }
 
-      // Detect: Is there a minus sign?
-      // And if there is a minus sign, skip over the minus sign.
-      if((str_length > 0U) && (str_input[0U] == char('-'))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      {
-        str_has_neg_sign = true;
+  namespace detail {
 
-        ++pos;
-      }
+  inline auto jacobi_symbol(std::uint32_t a, std::uint32_t n) -> int
+  {
+    // The Jacobi symbol (a/n) for odd n, see Algorithm 2.3.5 in
+    // R. Crandall and C. Pomerance, "Prime Numbers", 2nd Ed.
+    int result = 1;
 
-      // Perform a dynamic detection of the base.
-      if(str_length > (pos + 0U))
-      {
-        const bool might_be_oct_or_hex = ((str_input[pos + 0U] == char('0')) && (str_length > (pos + 1U))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    a %= n;
 
-        if(might_be_oct_or_hex)
-        {
-          if((str_input[pos + 1U] >= char('0')) && (str_input[pos + 1U] <= char('8'))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-          {
-            // The input format is octal.
-            base = UINT8_C(8);
+    while(a != 0U)
+    {
+      while((a & 1U) == 0U)
+      {
+        a >>= 1U;
 
-            pos += 1U;
-          }
-          else if((str_input[pos + 1U] == char('x')) || (str_input[pos + 1U] == char('X'))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-          {
-            // The input format is hexadecimal.
-            base = UINT8_C(16);
+        const std::uint32_t n_mod_8 = (n & 7U);
 
-            pos += 2U;
-          }
-        }
-        else if((str_input[pos + 0U] >= char('0')) && (str_input[pos + 0U] <= char('9'))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if((n_mod_8 == 3U) || (n_mod_8 == 5U))
         {
-          // The input format is decimal.
-          ;
+          result = -result;
         }
       }
 
-      bool char_is_valid = true;
+      std::swap(a, n);
 
-      for( ; ((pos < str_length) && char_is_valid); ++pos)
+      if(((a & 3U) == 3U) && ((n & 3U) == 3U))
       {
-        const auto c = std::uint8_t(str_input[pos]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        result = -result;
+      }
 
-        // TBD: Handle other digit delimiters in addition to apostrophe.
-        const bool char_is_apostrophe = (c == char(39));
+      a %= n;
+    }
 
-        if(!char_is_apostrophe)
-        {
-          if(base == UINT8_C(8))
-          {
-            std::uint8_t uc_oct { };
+    return ((n == 1U) ? result : 0);
+  }
 
-            if  ((c >= char('0')) && (c <= char('8'))) { uc_oct = std::uint8_t(c - std::uint8_t(UINT8_C(0x30))); }
-            else                                       { uc_oct = std::uint8_t('\0'); char_is_valid = false; }
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  auto jacobi_symbol(const std::int32_t d, const uintwide_t<Width2, LimbType, AllocatorType, false>& n) -> int
+  {
+    // The Jacobi symbol (d/n) for small odd d and odd n,
+    // obtained from (n mod |d| / |d|) by quadratic reciprocity.
+    const auto d_abs   = static_cast<std::uint32_t>((d < 0) ? -d : d);
+    const auto n_mod_4 = static_cast<std::uint32_t>(static_cast<std::uint32_t>(static_cast<LimbType>(n)) & 3U);
 
-            if(char_is_valid)
-            {
-              operator<<=(3);
+    int result = jacobi_symbol(static_cast<std::uint32_t>(n % d_abs), d_abs);
 
-              *values.begin() |= uc_oct;
-            }
-          }
-          else if(base == UINT8_C(10))
-          {
-            std::uint8_t uc_dec { };
+    if(((d_abs & 3U) == 3U) && (n_mod_4 == 3U))
+    {
+      result = -result;
+    }
 
-            if   ((c >= std::uint8_t('0')) && (c <= std::uint8_t('9'))) { uc_dec = std::uint8_t(c - std::uint8_t(UINT8_C(0x30))); }
-            else                                                        { uc_dec = std::uint8_t('\0'); char_is_valid = false; }
+    // Use (-1/n) = -1 for n = 3 (mod 4).
+    if((d < 0) && (n_mod_4 == 3U))
+    {
+      result = -result;
+    }
 
-            if(char_is_valid)
-            {
-              mul_by_limb(limb_type(UINT8_C(10)));
+    return result;
+  }
 
-              operator+=(uc_dec);
-            }
-          }
-          else if(base == UINT8_C(16))
-          {
-            std::uint8_t uc_hex { };
+  template<typename UnsignedIntegralType>
+  auto mod_add(const UnsignedIntegralType& a, const UnsignedIntegralType& b, const UnsignedIntegralType& m) -> UnsignedIntegralType
+  {
+    // Calculate (a + b) mod m for a, b < m, also if a + b overflows.
+    UnsignedIntegralType s(a + b);
 
-            if     ((c >= std::uint8_t('a')) && (c <= std::uint8_t('f'))) { uc_hex = std::uint8_t(c - std::uint8_t(UINT8_C(  87))); }
-            else if((c >= std::uint8_t('A')) && (c <= std::uint8_t('F'))) { uc_hex = std::uint8_t(c - std::uint8_t(UINT8_C(  55))); }
-            else if((c >= std::uint8_t('0')) && (c <= std::uint8_t('9'))) { uc_hex = std::uint8_t(c - std::uint8_t(UINT8_C(0x30))); }
-            else                                                          { uc_hex = std::uint8_t('\0'); char_is_valid = false; }
+    if((s < a) || (s >= m))
+    {
+      s -= m;
+    }
 
-            if(char_is_valid)
-            {
-              operator<<=(4);
+    return s;
+  }
 
-              *values.begin() |= uc_hex;
-            }
-          }
-        }
-      }
+  template<typename UnsignedIntegralType>
+  auto mod_sub(const UnsignedIntegralType& a, const UnsignedIntegralType& b, const UnsignedIntegralType& m) -> UnsignedIntegralType
+  {
+    // Calculate (a - b) mod m for a, b < m.
+    return ((a >= b) ? UnsignedIntegralType(a - b) : UnsignedIntegralType(m - (b - a)));
+  }
 
-      if(str_has_neg_sign)
-      {
-        negate();
-      }
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  auto strong_probable_prime_base_2(const montgomery_context<Width2, LimbType, AllocatorType>& ctx) -> bool
+  {
+    // The strong probable prime test to base 2 for the odd modulus n of ctx.
+    using local_uint_type = typename montgomery_context<Width2, LimbType, AllocatorType>::uint_type;
 
-      return char_is_valid;
-    }
+    const local_uint_type& n = ctx.modulus();
 
-    WIDE_INTEGER_CONSTEXPR void bitwise_not()
+    const local_uint_type nm1(n - 1U);
+
+    const unsinged_fast_type s = lsb(nm1);
+
+    // The Montgomery representations of 1 and of n - 1 = -1.
+    const local_uint_type& one = ctx.one();
+    const local_uint_type  minus_one(n - one);
+
+    local_uint_type x = pow_sliding_window(ctx, mod_add(one, one, n), local_uint_type(nm1 >> s), 0U);
+
+    if((x == one) || (x == minus_one))
     {
-      for(unsinged_fast_type i = 0U; i < number_of_limbs; ++i)
-      {
-        *(values.begin() + size_t(i)) = limb_type(~(*(values.cbegin() + size_t(i))));
-      }
+      return true;
     }
 
-    WIDE_INTEGER_CONSTEXPR void preincrement()
+    for(auto r = static_cast<unsinged_fast_type>(1U); r < s; ++r)
     {
-      // Implement pre-increment.
-      unsinged_fast_type i = 0U;
+      x = ctx.sqr(x);
 
-      for( ; (i < unsinged_fast_type(values.size() - 1U)) && (++(*(values.begin() + size_t(i))) == limb_type(0U)); ++i)
+      if(x == minus_one)
       {
-        ;
+        return true;
       }
 
-      if(i == unsinged_fast_type(values.size() - 1U))
+      if(x == one)
       {
-        ++(*(values.begin() + size_t(i)));
+        return false;
       }
     }
 
-    WIDE_INTEGER_CONSTEXPR void predecrement()
+    return false;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  auto strong_lucas_probable_prime(const montgomery_context<Width2, LimbType, AllocatorType>& ctx) -> bool // NOLINT(readability-function-cognitive-complexity)
+  {
+    // The strong Lucas probable prime test for the odd modulus n of ctx,
+    // which is greater than 227. The parameters are found with Selfridge's
+    // method A: D is the first of 5, -7, 9, -11, ... with (D/n) = -1,
+    // P = 1 and Q = (1 - D)/4. See R. Baillie and S.S. Wagstaff, Jr.,
+    // "Lucas Pseudoprimes", Math. Comp. 35 (1980), 1391-1417.
+
+    using local_uint_type = typename montgomery_context<Width2, LimbType, AllocatorType>::uint_type;
+
+    const local_uint_type& n = ctx.modulus();
+
+    auto d = static_cast<std::int32_t>(INT8_C(5));
+
+    for(auto count = static_cast<unsigned>(UINT8_C(0)); ; ++count)
     {
-      // Implement pre-decrement.
-      unsinged_fast_type i = 0U;
+      const int j = jacobi_symbol(d, n);
 
-      for( ; (i < unsinged_fast_type(values.size() - 1U)) && ((*(values.begin() + size_t(i)))-- == limb_type(0U)); ++i)
+      if(j == -1)
       {
-        ;
+        break;
       }
 
-      if(i == unsinged_fast_type(values.size() - 1U))
+      if(j == 0)
       {
-        --(*(values.begin() + size_t(i)));
+        // The candidate shares a factor with |D| < n.
+        return false;
+      }
+
+      if(count == 8U)
+      {
+        // If n is a square, (D/n) = -1 is never found.
+        const local_uint_type r = sqrt(n);
+
+        if((r * r) == n)
+        {
+          return false;
+        }
       }
+
+      d = ((d > 0) ? static_cast<std::int32_t>(-(d + 2)) : static_cast<std::int32_t>(-(d - 2)));
     }
-  };
 
-  // Define some convenient unsigned wide integer types.
-  using uint64_t    = uintwide_t<size_t(UINT32_C(   64)), std::uint16_t>;
-  using uint128_t   = uintwide_t<size_t(UINT32_C(  128)), std::uint32_t>;
-  using uint256_t   = uintwide_t<size_t(UINT32_C(  256)), std::uint32_t>;
-  using uint512_t   = uintwide_t<size_t(UINT32_C(  512)), std::uint32_t>;
-  using uint1024_t  = uintwide_t<size_t(UINT32_C( 1024)), std::uint32_t>;
-  using uint2048_t  = uintwide_t<size_t(UINT32_C( 2048)), std::uint32_t>;
-  using uint4096_t  = uintwide_t<size_t(UINT32_C( 4096)), std::uint32_t>;
-  using uint8192_t  = uintwide_t<size_t(UINT32_C( 8192)), std::uint32_t>;
-  using uint16384_t = uintwide_t<size_t(UINT32_C(16384)), std::uint32_t>;
-  using uint32768_t = uintwide_t<size_t(UINT32_C(32768)), std::uint32_t>;
-  using uint65536_t = uintwide_t<size_t(UINT32_C(65536)), std::uint32_t>;
+    // The Montgomery representation of Q.
+    const std::int32_t q = (1 - d) / 4;
 
-  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
-  static_assert(std::is_trivially_copyable<uint64_t   >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint128_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint256_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint512_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint1024_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint2048_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint4096_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint8192_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint16384_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint32768_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint65536_t>::value, "uintwide_t must be trivially copyable.");
+    const local_uint_type q_abs = ctx.to_montgomery(local_uint_type(static_cast<std::uint32_t>((q < 0) ? -q : q)));
+    const local_uint_type q_m   = ((q < 0) ? local_uint_type(n - q_abs) : q_abs);
 
-  static_assert(std::is_standard_layout<uint64_t   >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint128_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint256_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint512_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint1024_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint2048_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint4096_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint8192_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint16384_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint32768_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint65536_t>::value, "uintwide_t must have standard layout.");
-  #endif
+    // Here n + 1 does not overflow, since the maximum of the
+    // type (with even width) is divisible by 3 and n is not.
+    const local_uint_type np1(n + 1U);
 
-  using  int64_t    = uintwide_t<size_t(UINT32_C(   64)), std::uint16_t, void, true>;
-  using  int128_t   = uintwide_t<size_t(UINT32_C(  128)), std::uint32_t, void, true>;
-  using  int256_t   = uintwide_t<size_t(UINT32_C(  256)), std::uint32_t, void, true>;
-  using  int512_t   = uintwide_t<size_t(UINT32_C(  512)), std::uint32_t, void, true>;
-  using  int1024_t  = uintwide_t<size_t(UINT32_C( 1024)), std::uint32_t, void, true>;
-  using  int2048_t  = uintwide_t<size_t(UINT32_C( 2048)), std::uint32_t, void, true>;
-  using  int4096_t  = uintwide_t<size_t(UINT32_C( 4096)), std::uint32_t, void, true>;
-  using  int8192_t  = uintwide_t<size_t(UINT32_C( 8192)), std::uint32_t, void, true>;
-  using  int16384_t = uintwide_t<size_t(UINT32_C(16384)), std::uint32_t, void, true>;
-  using  int32768_t = uintwide_t<size_t(UINT32_C(32768)), std::uint32_t, void, true>;
-  using  int65536_t = uintwide_t<size_t(UINT32_C(65536)), std::uint32_t, void, true>;
+    const unsinged_fast_type s = lsb(np1);
 
-  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
-  static_assert(std::is_trivially_copyable<int64_t   >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int128_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int256_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int512_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int1024_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int2048_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int4096_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int8192_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int16384_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int32768_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int65536_t>::value, "uintwide_t must be trivially copyable.");
+    const local_uint_type dd(np1 >> s);
 
-  static_assert(std::is_standard_layout<int64_t   >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int128_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int256_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int512_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int1024_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int2048_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int4096_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int8192_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int16384_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int32768_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int65536_t>::value, "uintwide_t must have standard layout.");
-  #endif
+    // Calculate V(dd), V(dd + 1) and Q^dd with the Lucas chain
+    // V(2k) = V(k)^2 - 2Q^k and V(2k + 1) = V(k) V(k + 1) - P Q^k,
+    // in Montgomery representation and with P = 1.
+    local_uint_type v_k  (mod_add(ctx.one(), ctx.one(), n));
+    local_uint_type v_kp1(ctx.one());
+    local_uint_type q_k  (ctx.one());
 
-  // Insert a base class for numeric_limits<> support.
-  // This class inherits from std::numeric_limits<unsigned int>
-  // in order to provide limits for a non-specific unsigned type.
+    for(auto i = static_cast<unsinged_fast_type>(msb(dd) + 1U); i-- > 0U; )
+    {
+      const local_uint_type v_2kp1 = mod_sub(ctx.mul(v_k, v_kp1), q_k, n);
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits_uintwide_t_base
-    : public std::numeric_limits<typename std::conditional<(!IsSigned), unsigned int, signed int>::type>
-  {
-  private:
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+      if(exponent_test_bit(dd, i))
+      {
+        const local_uint_type q_kp1 = ctx.mul(q_k, q_m);
 
-  public:
-    static constexpr int digits          = (!IsSigned)
-                                             ? static_cast<int>(local_wide_integer_type::my_width2)
-                                             : static_cast<int>(local_wide_integer_type::my_width2 - 1U);
+        v_k   = v_2kp1;
+        v_kp1 = mod_sub(ctx.sqr(v_kp1), mod_add(q_kp1, q_kp1, n), n);
+        q_k   = ctx.mul(q_k, q_kp1);
+      }
+      else
+      {
+        v_kp1 = v_2kp1;
+        v_k   = mod_sub(ctx.sqr(v_k), mod_add(q_k, q_k, n), n);
+        q_k   = ctx.sqr(q_k);
+      }
+    }
+
+    // Since D U(k) = 2 V(k + 1) - P V(k) and D is coprime to n,
+    // U(dd) = 0 (mod n) exactly when 2 V(dd + 1) = V(dd) (mod n).
+    if((mod_add(v_kp1, v_kp1, n) == v_k) || (v_k == 0U))
+    {
+      return true;
+    }
+
+    for(auto r = static_cast<unsinged_fast_type>(1U); r < s; ++r)
+    {
+      v_k = mod_sub(ctx.sqr(v_k), mod_add(q_k, q_k, n), n);
+
+      if(v_k == 0U)
+      {
+        return true;
+      }
 
-    static constexpr int digits10        = static_cast<int>((std::uintmax_t(digits)       * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
-    static constexpr int max_digits10    = digits10;
-    static constexpr int max_exponent    = digits;
-    static constexpr int max_exponent10  = static_cast<int>((std::uintmax_t(max_exponent) * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
+      q_k = ctx.sqr(q_k);
+    }
 
-    static constexpr auto (max) () -> local_wide_integer_type { return local_wide_integer_type::limits_helper_max   (IsSigned); }
-    static constexpr auto (min) () -> local_wide_integer_type { return local_wide_integer_type::limits_helper_min   (IsSigned); }
-    static constexpr auto lowest() -> local_wide_integer_type { return local_wide_integer_type::limits_helper_lowest(IsSigned); }
-  };
+    return false;
+  }
 
-  template<class T>
-  struct is_integral : public std::is_integral<T> { };
+  } // namespace detail
 
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  struct is_integral<math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
-    : public std::integral_constant<bool, true> { };
+  auto baillie_psw(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& n) -> bool
+  {
+    // The Baillie-PSW test combines a strong probable prime test
+    // to base 2 with a strong Lucas probable prime test. It needs
+    // no random numbers and no composite passing it is known
+    // (it has been verified to be exact below 2^64).
 
-  } // namespace wide_integer
-  } // namespace math
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_uint_type         = uintwide_t<Width2, LimbType, AllocatorType, false>;
 
-  WIDE_INTEGER_NAMESPACE_END
+    const local_wide_integer_type np((local_wide_integer_type::is_neg(n) == false) ? n : -n);
 
-  namespace std
-  {
-    // Specialization of std::numeric_limits<uintwide_t>.
-    template<const WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t Width2,
-             typename LimbType,
-             typename AllocatorType,
-             const bool IsSigned>
-    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
-      : public WIDE_INTEGER_NAMESPACE::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
-  } // namespace std
+    {
+      bool is_prime { };
 
-  WIDE_INTEGER_NAMESPACE_BEGIN
-  namespace math { namespace wide_integer {
+      if(detail::prime_small_checks(np, is_prime))
+      {
+        return is_prime;
+      }
+    }
 
-  // Non-member binary add, sub, mul, div, mod of (uintwide_t op uintwide_t).
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator- (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator* (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator% (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(v); }
+    const montgomery_context<Width2, LimbType, AllocatorType> ctx((local_uint_type(np)));
 
-  // Non-member binary logic operations of (uintwide_t op uintwide_t).
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator| (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator& (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(v); }
+    return (   detail::strong_probable_prime_base_2(ctx)
+            && detail::strong_lucas_probable_prime (ctx));
+  }
 
-  // Non-member binary add, sub, mul, div, mod of (uintwide_t op IntegralType).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<const size_t PrimeCount>
+  class small_prime_table
+  {
+  public:
+    // The odd primes 3, 5, 7, ... used for trial division in
+    // find_next_prime and miller_rabin_batch. The primes are also
+    // grouped into products that fit in 32 bits, so that a wide
+    // integer is reduced once per group rather than once per prime.
+    // The table is large (several kilobytes for thousands of primes)
+    // and is intended to be constructed once, for instance as static.
+
+    using value_type = std::uint32_t;
+    using size_type  = size_t;
 
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
-  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<(   ( std::is_integral<IntegralType>::value)
-                                                                                                                                              && (!std::is_unsigned<IntegralType>::value)),
-                                                                                                                                              uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type
-  { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+    static_assert(PrimeCount > static_cast<size_type>(UINT8_C(0)),
+                  "Error: The small prime table must contain at least one prime");
 
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
-  WIDE_INTEGER_CONSTEXPR auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<(   (std::is_integral<IntegralType>::value)
-                                                                                                                                                           && (std::is_unsigned<IntegralType>::value)
-                                                                                                                                                           && (std::numeric_limits<IntegralType>::digits <= std::numeric_limits<LimbType>::digits)),
-                                                                                                                                                           typename uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::limb_type>::type
-  {
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    small_prime_table()
+    {
+      auto candidate = static_cast<value_type>(UINT8_C(3));
 
-    const bool u_is_neg = local_wide_integer_type::is_neg(u);
+      for(auto i = static_cast<size_type>(0U); i < PrimeCount; candidate += 2U)
+      {
+        bool is_prime = true;
 
-    local_wide_integer_type remainder;
+        for(auto j = static_cast<size_type>(0U);
+                 (j < i) && ((static_cast<std::uint64_t>(my_primes[j]) * my_primes[j]) <= candidate);
+               ++j)
+        {
+          if((candidate % my_primes[j]) == 0U)
+          {
+            is_prime = false;
 
-    local_wide_integer_type((!u_is_neg) ? u : -u).eval_divide_by_single_limb(v, 0U, &remainder);
+            break;
+          }
+        }
 
-    using local_limb_type = typename local_wide_integer_type::limb_type;
+        if(is_prime)
+        {
+          my_primes[i] = candidate;
 
-    auto u_rem = local_limb_type(remainder);
+          ++i;
+        }
+      }
 
-    return ((!u_is_neg) ? u_rem : local_limb_type(local_limb_type(~u_rem) + 1U));
-  }
+      auto product = static_cast<std::uint64_t>(UINT8_C(1));
 
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
-  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<(   (std::is_integral<IntegralType>::value)
-                                                                                                                                              && (std::is_unsigned<IntegralType>::value)
-                                                                                                                                              && (std::numeric_limits<IntegralType>::digits > std::numeric_limits<LimbType>::digits)),
-                                                                                                                                              uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type
-  { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+      for(auto i = static_cast<size_type>(0U); i < PrimeCount; ++i)
+      {
+        if((product * my_primes[i]) > (std::numeric_limits<value_type>::max)())
+        {
+          my_products  [my_group_count] = static_cast<value_type>(product);
+          my_group_ends[my_group_count] = i;
 
-  // Non-member binary add, sub, mul, div, mod of (IntegralType op uintwide_t).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(v); }
+          ++my_group_count;
 
-  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-  // Non-member binary add, sub, mul, div, mod of (uintwide_t op FloatingPointType).
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+          product = 1U;
+        }
 
-  // Non-member binary add, sub, mul, div, mod of (FloatingPointType op uintwide_t).
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator+=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator-=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator*=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator/=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator%=(v); }
-  #endif
+        product *= my_primes[i];
+      }
 
-  // Non-member binary logic operations of (uintwide_t op IntegralType).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator|(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator&(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+      my_products  [my_group_count] = static_cast<value_type>(product);
+      my_group_ends[my_group_count] = PrimeCount;
 
-  // Non-member binary binary logic operations of (IntegralType op uintwide_t).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator|(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator&(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(v); }
+      ++my_group_count;
+    }
 
-  // Non-member shift functions of (uintwide_t shift IntegralType).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<<(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType n) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator<<=(n); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>>(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType n) -> typename std::enable_if<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator>>=(n); }
+    static constexpr auto size() -> size_type { return PrimeCount; }
 
-  // Non-member comparison functions of (uintwide_t cmp uintwide_t).
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator==(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator!=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator> (v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator< (v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator>=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator<=(v); }
+    auto operator[](const size_type i) const -> value_type { return my_primes[i]; }
 
-  // Non-member comparison functions of (uintwide_t cmp IntegralType).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return u.operator==(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return u.operator!=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return u.operator> (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return u.operator< (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return u.operator>=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return u.operator<=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+    auto cbegin() const -> const value_type* { return my_primes.data(); }
+    auto cend  () const -> const value_type* { return my_primes.data() + PrimeCount; }
 
-  // Non-member comparison functions of (IntegralType cmp uintwide_t).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator==(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator!=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator> (v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator< (v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator>=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_integral<IntegralType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator<=(v); }
+    auto largest() const -> value_type { return my_primes[PrimeCount - 1U]; }
 
-  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-  // Non-member comparison functions of (uintwide_t cmp FloatingPointType).
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return u.operator==(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return u.operator!=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return u.operator> (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return u.operator< (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return u.operator>=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return u.operator<=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+    auto group_count() const -> size_type { return my_group_count; }
 
-  // Non-member comparison functions of (FloatingPointType cmp uintwide_t).
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator==(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator!=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator> (v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator< (v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator>=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value, bool>::type { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator<=(v); }
-  #endif
+    auto group_product(const size_type g) const -> value_type { return my_products[g]; }
+    auto group_end    (const size_type g) const -> size_type  { return my_group_ends[g]; }
 
-  #if !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+  private:
+    detail::fixed_static_array<value_type, PrimeCount> my_primes     { };
+    detail::fixed_static_array<value_type, PrimeCount> my_products   { };
+    detail::fixed_static_array<size_type,  PrimeCount> my_group_ends { };
 
-  // I/O streaming functions.
-  template<typename char_type,
-           typename traits_type,
-           const size_t Width2,
+    size_type my_group_count { };
+  };
+
+  namespace detail {
+
+  template<const size_t Width2,
            typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  auto operator<<(std::basic_ostream<char_type, traits_type>& out,
-                  const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_ostream<char_type, traits_type>&
+           typename AllocatorType>
+  auto prime_table_group_remainder(const uintwide_t<Width2, LimbType, AllocatorType, false>& n,
+                                   const std::uint32_t                                       product) -> std::uint32_t
   {
-    std::basic_ostringstream<char_type, traits_type> ostr;
+    // Horner's scheme in digits of at most 32 bits, so that the
+    // running remainder shifted by one digit fits in 64 bits.
+    constexpr auto limb_digits = static_cast<unsigned>(std::numeric_limits<LimbType>::digits);
+    constexpr auto digit_shift = static_cast<unsigned>((limb_digits < 32U) ? limb_digits : 32U);
+    constexpr auto digit_count = static_cast<unsigned>(limb_digits / digit_shift);
+    constexpr auto digit_mask  = static_cast<std::uint64_t>((UINT64_C(1) << digit_shift) - 1U);
 
-    const std::ios::fmtflags my_flags = out.flags();
-
-    const bool show_pos     = ((my_flags & std::ios::showpos)   == std::ios::showpos);
-    const bool show_base    = ((my_flags & std::ios::showbase)  == std::ios::showbase);
-    const bool is_uppercase = ((my_flags & std::ios::uppercase) == std::ios::uppercase);
+    auto r = static_cast<std::uint64_t>(UINT8_C(0));
 
-    std::uint_fast8_t base_rep { };
+    for(auto ri = n.crepresentation().crbegin(); ri != n.crepresentation().crend(); ++ri)
+    {
+      for(auto d = digit_count; d > 0U; --d)
+      {
+        const auto digit = static_cast<std::uint64_t>((static_cast<std::uint64_t>(*ri) >> ((d - 1U) * digit_shift)) & digit_mask);
 
-    if     ((my_flags & std::ios::oct) == std::ios::oct) { base_rep = UINT8_C( 8); }
-    else if((my_flags & std::ios::hex) == std::ios::hex) { base_rep = UINT8_C(16); }
-    else                                                 { base_rep = UINT8_C(10); }
+        r = static_cast<std::uint64_t>(((r << digit_shift) | digit) % product);
+      }
+    }
 
-    const auto field_width = unsinged_fast_type(out.width());
-    const auto fill_char   = static_cast<char>(out.fill());
+    return static_cast<std::uint32_t>(r);
+  }
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+  template<const size_t PrimeCount,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  auto prime_table_has_factor(const uintwide_t<Width2, LimbType, AllocatorType, false>& n,
+                              const small_prime_table<PrimeCount>&                      table) -> bool
+  {
+    auto i = static_cast<size_t>(0U);
 
-    if(base_rep == UINT8_C(8))
+    for(auto g = static_cast<size_t>(0U); g < table.group_count(); ++g)
     {
-      std::array<char, local_wide_integer_type::wr_string_max_buffer_size_oct> str_result { };
-      str_result.fill(char('\0'));
-
-      x.wr_string(str_result.data(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char);
+      const std::uint32_t r = prime_table_group_remainder(n, table.group_product(g));
 
-      static_cast<void>(ostr << str_result.data());
+      for( ; i < table.group_end(g); ++i)
+      {
+        if((r % table[i]) == 0U)
+        {
+          return true;
+        }
+      }
     }
-    else if(base_rep == UINT8_C(10))
-    {
-      std::array<char, local_wide_integer_type::wr_string_max_buffer_size_dec> str_result { };
-      str_result.fill(char('\0'));
 
-      x.wr_string(str_result.data(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char);
+    return false;
+  }
 
-      static_cast<void>(ostr << str_result.data());
-    }
-    else if(base_rep == UINT8_C(16))
-    {
-      std::array<char, local_wide_integer_type::wr_string_max_buffer_size_hex> str_result { };
-      str_result.fill(char('\0'));
+  template<const size_t PrimeCount,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  auto prime_table_residues(const uintwide_t<Width2, LimbType, AllocatorType, false>& n,
+                            const small_prime_table<PrimeCount>&                      table,
+                            fixed_static_array<std::uint32_t, PrimeCount>&            residues) -> void
+  {
+    auto i = static_cast<size_t>(0U);
 
-      x.wr_string(str_result.data(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char);
+    for(auto g = static_cast<size_t>(0U); g < table.group_count(); ++g)
+    {
+      const std::uint32_t r = prime_table_group_remainder(n, table.group_product(g));
 
-      static_cast<void>(ostr << str_result.data());
+      for( ; i < table.group_end(g); ++i)
+      {
+        residues[i] = static_cast<std::uint32_t>(r % table[i]);
+      }
     }
-
-    return (out << ostr.str());
   }
 
-  template<typename char_type,
-           typename traits_type,
+  template<typename DistributionType,
+           typename GeneratorType,
+           const size_t PrimeCount,
            const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  auto operator>>(std::basic_istream<char_type, traits_type>& in,
-                  uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_istream<char_type, traits_type>&
+  auto miller_rabin_with_table(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& n,
+                               const unsinged_fast_type                                     number_of_trials,
+                               DistributionType&                                            distribution,
+                               GeneratorType&                                               generator,
+                               const small_prime_table<PrimeCount>&                         table) -> bool
   {
-    std::string str_in;
+    // Miller-Rabin with trial division by the whole prime table
+    // in place of the fixed small-prime checks of miller_rabin.
 
-    in >> str_in;
+    using local_wide_integer_type          = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_unsigned_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using local_prime_type                 = typename small_prime_table<PrimeCount>::value_type;
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    const local_unsigned_wide_integer_type np((local_wide_integer_type::is_neg(n) == false) ? n : -n);
 
-    x = local_wide_integer_type(str_in.c_str());
+    if((static_cast<LimbType>(np) & 1U) == 0U)
+    {
+      return (np == 2U);
+    }
 
-    return in;
+    if(np <= table.largest())
+    {
+      return std::binary_search(table.cbegin(), table.cend(), static_cast<local_prime_type>(np));
+    }
+
+    if(np <= static_cast<local_prime_type>(UINT8_C(227)))
+    {
+      // The table is shorter than the fixed checks of miller_rabin.
+      return miller_rabin(local_wide_integer_type(np), number_of_trials, distribution, generator);
+    }
+
+    if(prime_table_has_factor(np, table))
+    {
+      return false;
+    }
+
+    return miller_rabin_rounds(local_wide_integer_type(np), number_of_trials, distribution, generator);
   }
 
-  #endif
+  class parallel_index
+  {
+  public:
+    // An index shared by the workers of a parallel loop.
+    // It is a plain index when threads are disabled.
+
+    explicit parallel_index(const std::size_t value) : my_value(value) { }
+
+    parallel_index(const parallel_index&) = delete;
+    parallel_index(parallel_index&&) noexcept = delete;
+
+    ~parallel_index() = default;
+
+    auto operator=(const parallel_index&) -> parallel_index& = delete;
+    auto operator=(parallel_index&&) noexcept -> parallel_index& = delete;
 
-  } // namespace wide_integer
-  } // namespace math
+    auto fetch_increment() -> std::size_t { return my_value++; }
 
-  // Implement various number-theoretical tools.
+    auto load() const -> std::size_t { return my_value; }
 
-  namespace math { namespace wide_integer {
+    auto store_min(const std::size_t value) -> void
+    {
+      #if defined(WIDE_INTEGER_HAS_THREADS)
+      std::size_t expected = my_value.load();
 
-  namespace detail {
+      while((value < expected) && (!my_value.compare_exchange_weak(expected, value))) { ; }
+      #else
+      my_value = (std::min)(my_value, value);
+      #endif
+    }
 
-  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-  namespace my_own {
+  private:
+    #if defined(WIDE_INTEGER_HAS_THREADS)
+    std::atomic<std::size_t> my_value;
+    #else
+    std::size_t my_value;
+    #endif
+  };
 
-  template<typename FloatingPointType> WIDE_INTEGER_CONSTEXPR auto frexp(FloatingPointType x, int* expptr) -> typename std::enable_if<((std::is_floating_point<FloatingPointType>::value) && (std::numeric_limits<FloatingPointType>::is_iec559)), FloatingPointType>::type
+  inline auto parallel_thread_count(const unsigned requested, const std::size_t work_count) -> unsigned
   {
-    using local_floating_point_type = FloatingPointType;
+    // A requested count of zero selects the hardware concurrency.
+    #if defined(WIDE_INTEGER_HAS_THREADS)
+    const unsigned hardware_count = std::thread::hardware_concurrency();
 
-    const bool x_is_neg = (x < local_floating_point_type(0.0L));
+    const unsigned thread_count = ((requested != 0U) ? requested : ((hardware_count != 0U) ? hardware_count : 1U));
 
-    local_floating_point_type f = (x_is_neg ? -x : x);
+    return static_cast<unsigned>((std::max)(static_cast<std::size_t>(1U), (std::min)(static_cast<std::size_t>(thread_count), work_count)));
+    #else
+    static_cast<void>(requested);
+    static_cast<void>(work_count);
 
-    int e2 = 0;
+    return 1U;
+    #endif
+  }
 
-    constexpr long double two_pow32 =
-      static_cast<long double>(0x10000) * static_cast<long double>(0x10000);
+  } // namespace detail
 
-    while(f >= local_floating_point_type(two_pow32))
+  namespace parallel {
+
+  class thread_pool
+  {
+  public:
+    // A persistent pool of worker threads for the parallel algorithms.
+    // A thread count of zero selects the hardware concurrency. The thread
+    // which calls run takes part in the work as worker zero, so a pool of
+    // size n starts n - 1 threads. The chunks of a job are split evenly
+    // among the workers. Each worker processes its own chunks from the
+    // front, and a worker which has run out of chunks steals the back half
+    // of the remaining chunks of another worker. Jobs are run one at a time.
+    // A job which is started from within a job runs on the calling thread.
+    // If a chunk throws, the chunks which have not yet started are dropped
+    // and the first exception is rethrown by run on the calling thread.
+
+    explicit thread_pool(const unsigned thread_count = 0U)
+      : my_worker_count(detail::parallel_thread_count(thread_count, static_cast<std::size_t>(UINT16_C(256))))
+      #if defined(WIDE_INTEGER_HAS_THREADS)
+      , my_ranges(static_cast<std::size_t>(my_worker_count))
+      #endif
     {
-      // TBD: Maybe optimize this exponent reduction
-      // with a more clever kind of binary searching.
+      #if defined(WIDE_INTEGER_HAS_THREADS)
+      try
+      {
+        my_threads.reserve(static_cast<std::size_t>(my_worker_count - 1U));
 
-      f   = local_floating_point_type(f / local_floating_point_type(two_pow32));
-      e2 += int(INT32_C(32));
+        for(auto worker_index = static_cast<unsigned>(1U); worker_index < my_worker_count; ++worker_index)
+        {
+          my_threads.emplace_back([this, worker_index]() { worker_loop(worker_index); });
+        }
+      }
+      catch(...)
+      {
+        // The destructor is not run for a pool which fails
+        // to construct, so join the threads already started.
+        stop_and_join();
+
+        throw;
+      }
+      #endif
     }
 
-    constexpr long double one_ldbl(1.0L);
+    thread_pool(const thread_pool&) = delete;
+    thread_pool(thread_pool&&) noexcept = delete;
 
-    while(f >= local_floating_point_type(one_ldbl))
+    ~thread_pool()
     {
-      constexpr long double two_ldbl(2.0L);
+      #if defined(WIDE_INTEGER_HAS_THREADS)
+      stop_and_join();
+      #endif
+    }
 
-      f = local_floating_point_type(f / local_floating_point_type(two_ldbl));
+    auto operator=(const thread_pool&) -> thread_pool& = delete;
+    auto operator=(thread_pool&&) noexcept -> thread_pool& = delete;
 
-      ++e2;
-    }
+    auto size() const -> unsigned { return my_worker_count; }
 
-    if(expptr != nullptr)
+    template<typename ChunkFunctionType>
+    auto run(const std::size_t chunk_count, ChunkFunctionType& chunk_function) -> void
     {
-      *expptr = e2;
-    }
+      // Call chunk_function(i) for each chunk index 0 <= i < chunk_count
+      // and return when all of the calls have finished.
+      #if defined(WIDE_INTEGER_HAS_THREADS)
+      if((my_worker_count > 1U) && (chunk_count > 1U) && (!is_inside_job()))
+      {
+        const std::lock_guard<std::mutex> job_lock(my_job_mutex);
 
-    return ((!x_is_neg) ? f : -f);
-  }
+        for(auto worker_index = static_cast<unsigned>(0U); worker_index < my_worker_count; ++worker_index)
+        {
+          const std::lock_guard<std::mutex> range_lock(my_ranges[worker_index].my_mutex);
 
-  template<typename FloatingPointType> WIDE_INTEGER_CONSTEXPR auto frexp(FloatingPointType x, int* expptr) -> typename std::enable_if<((std::is_floating_point<FloatingPointType>::value) && (!std::numeric_limits<FloatingPointType>::is_iec559)), FloatingPointType>::type
-  {
-    using std::frexp;
+          my_ranges[worker_index].my_begin = static_cast<std::size_t>((chunk_count * static_cast<std::size_t>(worker_index))      / my_worker_count);
+          my_ranges[worker_index].my_end   = static_cast<std::size_t>((chunk_count * static_cast<std::size_t>(worker_index + 1U)) / my_worker_count);
+        }
 
-    return frexp(x, expptr);
-  }
+        {
+          const std::lock_guard<std::mutex> state_lock(my_state_mutex);
 
-  template<typename FloatingPointType> WIDE_INTEGER_CONSTEXPR auto isfinite(FloatingPointType x) -> typename std::enable_if<((std::is_floating_point<FloatingPointType>::value) && (std::numeric_limits<FloatingPointType>::is_iec559)), bool>::type
-  {
-    using local_floating_point_type = FloatingPointType;
+          my_job_context   = static_cast<void*>(&chunk_function);
+          my_job_invoke    = &invoke_chunk_function<ChunkFunctionType>;
+          my_job_exception = nullptr;
+          my_busy_count    = my_worker_count - 1U;
 
-    bool x_is_finite = true;
+          ++my_generation;
+        }
 
-    const bool x_is_nan = (x != x);
+        my_start_condition.notify_all();
 
-    if(x_is_nan)
-    {
-      x_is_finite = false;
-    }
-    else
-    {
-      const bool x_is_inf_pos = (x > (std::numeric_limits<local_floating_point_type>::max)());
-      const bool x_is_inf_neg = (x < (std::numeric_limits<local_floating_point_type>::lowest)());
+        {
+          const inside_job_guard guard;
 
-      if(x_is_inf_pos || x_is_inf_neg)
+          work(0U);
+        }
+
+        // Always wait for the workers, since they
+        // use the chunk function of this call.
+        std::exception_ptr job_exception { };
+
+        {
+          std::unique_lock<std::mutex> state_lock(my_state_mutex);
+
+          my_done_condition.wait(state_lock, [this]() { return (my_busy_count == 0U); });
+
+          std::swap(job_exception, my_job_exception);
+        }
+
+        if(job_exception)
+        {
+          std::rethrow_exception(job_exception);
+        }
+
+        return;
+      }
+      #endif
+
+      for(auto chunk_index = static_cast<std::size_t>(0U); chunk_index < chunk_count; ++chunk_index)
       {
-        x_is_finite = false;
+        chunk_function(chunk_index);
       }
     }
 
-    return x_is_finite;
-  }
-
-  template<typename FloatingPointType> WIDE_INTEGER_CONSTEXPR auto isfinite(FloatingPointType x) -> typename std::enable_if<((std::is_floating_point<FloatingPointType>::value) && (!std::numeric_limits<FloatingPointType>::is_iec559)), bool>::type
-  {
-    using std::isfinite;
+    static auto default_pool() -> thread_pool&
+    {
+      // The pool used by the parallel algorithms
+      // unless another pool is given explicitly.
+      static thread_pool pool;
 
-    return isfinite(x);
-  }
+      return pool;
+    }
 
-  } // namespace my_own
-  #endif
+  private:
+    const unsigned my_worker_count;
 
-  template<typename UnsignedIntegralType>
-  inline WIDE_INTEGER_CONSTEXPR auto lsb_helper(const UnsignedIntegralType& u) -> unsinged_fast_type
-  {
-    // Compile-time checks.
-    static_assert((   (std::is_integral<UnsignedIntegralType>::value)
-                   && (std::is_unsigned<UnsignedIntegralType>::value)),
-                   "Error: Please check the characteristics of UnsignedIntegralType");
+    #if defined(WIDE_INTEGER_HAS_THREADS)
+    struct chunk_range
+    {
+      std::mutex  my_mutex { };
+      std::size_t my_begin { };
+      std::size_t my_end   { };
+    };
 
-    unsinged_fast_type result = 0U;
+    std::vector<chunk_range> my_ranges;
+    std::vector<std::thread> my_threads { };
 
-    UnsignedIntegralType mask(u);
+    std::mutex              my_job_mutex { };
+    std::mutex              my_state_mutex { };
+    std::condition_variable my_start_condition { };
+    std::condition_variable my_done_condition { };
 
-    // This assumes that at least one bit is set.
-    // Otherwise saturation of the index will occur.
+    void*              my_job_context   { nullptr };
+    void               (*my_job_invoke)(void*, std::size_t) { nullptr };
+    std::exception_ptr my_job_exception { };
+    std::size_t        my_generation    { };
+    unsigned           my_busy_count    { };
+    bool               my_stop          { false };
 
-    // Naive and basic LSB search.
-    // TBD: This could be improved with a binary search
-    // on the lowest bit position of the fundamental type.
-    while((unsinged_fast_type(mask) & 1U) == 0U)
+    class inside_job_guard
     {
-      mask >>= 1U;
+    public:
+      // Mark the calling thread as running a job
+      // and restore the previous state on exit.
+      inside_job_guard() : my_previous(is_inside_job()) { is_inside_job() = true; }
 
-      ++result;
-    }
+      inside_job_guard(const inside_job_guard&) = delete;
+      inside_job_guard(inside_job_guard&&) noexcept = delete;
 
-    return result;
-  }
+      ~inside_job_guard() { is_inside_job() = my_previous; }
 
-  template<typename UnsignedIntegralType>
-  inline WIDE_INTEGER_CONSTEXPR auto msb_helper(const UnsignedIntegralType& u) -> unsinged_fast_type
-  {
-    // Compile-time checks.
-    static_assert((   (std::is_integral<UnsignedIntegralType>::value)
-                   && (std::is_unsigned<UnsignedIntegralType>::value)),
-                   "Error: Please check the characteristics of UnsignedIntegralType");
+      auto operator=(const inside_job_guard&) -> inside_job_guard& = delete;
+      auto operator=(inside_job_guard&&) noexcept -> inside_job_guard& = delete;
 
-    using local_unsigned_integral_type = UnsignedIntegralType;
+    private:
+      const bool my_previous;
+    };
 
-    singed_fast_type i { };
+    template<typename ChunkFunctionType>
+    static auto invoke_chunk_function(void* context, const std::size_t chunk_index) -> void
+    {
+      (*static_cast<ChunkFunctionType*>(context))(chunk_index);
+    }
 
-    // TBD: This could potentially be improved with a binary
-    // search for the highest bit position in the type.
+    static auto is_inside_job() -> bool&
+    {
+      thread_local bool inside_job = false;
 
-    for(i = singed_fast_type(std::numeric_limits<local_unsigned_integral_type>::digits - 1); i >= 0; --i)
+      return inside_job;
+    }
+
+    auto take_own_chunk(const unsigned worker_index, std::size_t& chunk_index) -> bool
     {
-      if((u & UnsignedIntegralType(local_unsigned_integral_type(1U) << i)) != 0U)
+      chunk_range& own = my_ranges[worker_index];
+
+      const std::lock_guard<std::mutex> range_lock(own.my_mutex);
+
+      if(own.my_begin < own.my_end)
       {
-        break;
-      }
-    }
+        chunk_index = own.my_begin;
 
-    return unsinged_fast_type((std::max)(singed_fast_type(0), i));
-  }
+        ++own.my_begin;
 
-  template<>
-  inline WIDE_INTEGER_CONSTEXPR auto msb_helper<std::uint32_t>(const std::uint32_t& u) -> unsinged_fast_type
-  {
-    unsinged_fast_type r(0);
+        return true;
+      }
 
-    std::uint32_t x = u;
+      return false;
+    }
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if((x & UINT32_C(0xFFFF0000)) != UINT32_C(0)) { x = std::uint32_t(x >> unsigned(UINT32_C(16))); r = unsinged_fast_type(r | UINT32_C(16)); }
-    if((x & UINT32_C(0x0000FF00)) != UINT32_C(0)) { x = std::uint32_t(x >> unsigned(UINT32_C( 8))); r = unsinged_fast_type(r | UINT32_C( 8)); }
-    if((x & UINT32_C(0x000000F0)) != UINT32_C(0)) { x = std::uint32_t(x >> unsigned(UINT32_C( 4))); r = unsinged_fast_type(r | UINT32_C( 4)); }
-    if((x & UINT32_C(0x0000000C)) != UINT32_C(0)) { x = std::uint32_t(x >> unsigned(UINT32_C( 2))); r = unsinged_fast_type(r | UINT32_C( 2)); }
-    if((x & UINT32_C(0x00000002)) != UINT32_C(0)) {                                                 r = unsinged_fast_type(r | UINT32_C( 1)); }
+    auto steal_chunks(const unsigned worker_index, std::size_t& chunk_index) -> bool
+    {
+      for(auto offset = static_cast<unsigned>(1U); offset < my_worker_count; ++offset)
+      {
+        chunk_range& victim = my_ranges[(worker_index + offset) % my_worker_count];
 
-    return unsinged_fast_type(r);
-  }
+        std::size_t stolen_begin { };
+        std::size_t stolen_end   { };
 
-  template<>
-  inline WIDE_INTEGER_CONSTEXPR auto msb_helper<std::uint16_t>(const std::uint16_t& u) -> unsinged_fast_type
-  {
-    unsinged_fast_type r(0);
+        {
+          const std::lock_guard<std::mutex> range_lock(victim.my_mutex);
 
-    std::uint16_t x = u;
+          if(victim.my_begin == victim.my_end)
+          {
+            continue;
+          }
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if((x & UINT16_C(0xFF00)) != UINT16_C(0)) { x = std::uint16_t(x >> unsigned(UINT16_C(8))); r = unsinged_fast_type(r | UINT16_C(8)); } // NOLINT(hicpp-signed-bitwise)
-    if((x & UINT16_C(0x00F0)) != UINT16_C(0)) { x = std::uint16_t(x >> unsigned(UINT16_C(4))); r = unsinged_fast_type(r | UINT16_C(4)); } // NOLINT(hicpp-signed-bitwise)
-    if((x & UINT16_C(0x000C)) != UINT16_C(0)) { x = std::uint16_t(x >> unsigned(UINT16_C(2))); r = unsinged_fast_type(r | UINT16_C(2)); } // NOLINT(hicpp-signed-bitwise)
-    if((x & UINT16_C(0x0002)) != UINT16_C(0)) {                                                r = unsinged_fast_type(r | UINT16_C(1)); } // NOLINT(hicpp-signed-bitwise)
+          stolen_end   = victim.my_end;
+          stolen_begin = static_cast<std::size_t>(stolen_end - ((stolen_end - victim.my_begin) + 1U) / 2U);
 
-    return unsinged_fast_type(r);
-  }
+          victim.my_end = stolen_begin;
+        }
 
-  template<>
-  inline WIDE_INTEGER_CONSTEXPR auto msb_helper<std::uint8_t>(const std::uint8_t& u) -> unsinged_fast_type
-  {
-    unsinged_fast_type r(0);
+        // Keep the first stolen chunk and make
+        // the others available to be stolen again.
+        chunk_range& own = my_ranges[worker_index];
 
-    std::uint8_t x = u;
+        const std::lock_guard<std::mutex> range_lock(own.my_mutex);
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if((x & UINT8_C(0xF0)) != UINT8_C(0)) { x = std::uint8_t(x >> 4U); r = unsinged_fast_type(r | UINT8_C(4)); } // NOLINT(hicpp-signed-bitwise)
-    if((x & UINT8_C(0x0C)) != UINT8_C(0)) { x = std::uint8_t(x >> 2U); r = unsinged_fast_type(r | UINT8_C(2)); } // NOLINT(hicpp-signed-bitwise)
-    if((x & UINT8_C(0x02)) != UINT8_C(0)) {                            r = unsinged_fast_type(r | UINT8_C(1)); } // NOLINT(hicpp-signed-bitwise)
+        own.my_begin = static_cast<std::size_t>(stolen_begin + 1U);
+        own.my_end   = stolen_end;
 
-    return unsinged_fast_type(r);
-  }
+        chunk_index = stolen_begin;
 
-  } // namespace detail
+        return true;
+      }
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  WIDE_INTEGER_CONSTEXPR void swap(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
-                                   uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& y)
-  {
-    if(&x != &y)
-    {
-      using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+      return false;
+    }
 
-      const local_wide_integer_type tmp_x(x);
+    auto drop_chunks() -> void
+    {
+      for(auto& range : my_ranges)
+      {
+        const std::lock_guard<std::mutex> range_lock(range.my_mutex);
 
-      x = y;
-      y = tmp_x;
+        range.my_begin = range.my_end;
+      }
     }
-  }
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  inline WIDE_INTEGER_CONSTEXPR auto lsb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsinged_fast_type
-  {
-    // Calculate the position of the least-significant bit.
-    // Use a linear search starting from the least significant limbs.
+    auto work(const unsigned worker_index) -> void
+    {
+      std::size_t chunk_index { };
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_value_type        = typename local_wide_integer_type::limb_type;
+      while(take_own_chunk(worker_index, chunk_index) || steal_chunks(worker_index, chunk_index))
+      {
+        try
+        {
+          my_job_invoke(my_job_context, chunk_index);
+        }
+        catch(...)
+        {
+          {
+            const std::lock_guard<std::mutex> state_lock(my_state_mutex);
 
-    auto bpos = unsinged_fast_type(0U);
+            if(!my_job_exception)
+            {
+              my_job_exception = std::current_exception();
+            }
+          }
 
-    for(auto it = (x.crepresentation()).cbegin(); it != (x.crepresentation()).cend(); ++it) // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+          drop_chunks();
+        }
+      }
+    }
+
+    auto stop_and_join() -> void
     {
-      if((*it & (std::numeric_limits<local_value_type>::max)()) != 0U)
       {
-        const auto offset = unsinged_fast_type(it - x.crepresentation().cbegin());
+        const std::lock_guard<std::mutex> state_lock(my_state_mutex);
+
+        my_stop = true;
+      }
 
-        bpos =   detail::lsb_helper(*it)
-               + unsinged_fast_type(unsinged_fast_type(std::numeric_limits<local_value_type>::digits) * offset);
+      my_start_condition.notify_all();
 
-        break;
+      for(auto& t : my_threads)
+      {
+        t.join();
       }
     }
 
-    return bpos;
-  }
+    auto worker_loop(const unsigned worker_index) -> void
+    {
+      const inside_job_guard guard;
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  WIDE_INTEGER_CONSTEXPR auto msb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsinged_fast_type
-  {
-    // Calculate the position of the most-significant bit.
-    // Use a linear search starting from the most significant limbs.
+      std::size_t generation_seen { };
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_value_type        = typename local_wide_integer_type::limb_type;
+      for(;;)
+      {
+        {
+          std::unique_lock<std::mutex> state_lock(my_state_mutex);
 
-    auto bpos = unsinged_fast_type(0U);
+          my_start_condition.wait(state_lock, [this, &generation_seen]() { return (my_stop || (my_generation != generation_seen)); });
 
-    for(auto ri = x.crepresentation().crbegin(); ri != x.crepresentation().crend(); ++ri)
-    {
-      if((*ri & (std::numeric_limits<local_value_type>::max)()) != 0U)
-      {
-        const unsinged_fast_type offset = unsinged_fast_type((x.crepresentation().crend() - 1U) - ri);
+          if(my_stop)
+          {
+            return;
+          }
 
-        bpos =   detail::msb_helper(*ri)
-               + unsinged_fast_type(unsinged_fast_type(std::numeric_limits<local_value_type>::digits) * offset);
+          generation_seen = my_generation;
+        }
 
-        break;
+        work(worker_index);
+
+        {
+          const std::lock_guard<std::mutex> state_lock(my_state_mutex);
+
+          --my_busy_count;
+
+          if(my_busy_count == 0U)
+          {
+            my_done_condition.notify_one();
+          }
+        }
       }
     }
+    #endif
+  };
 
-    return bpos;
-  }
+  } // namespace parallel
 
-  template<const size_t Width2,
+  template<typename DistributionType,
+           typename GeneratorType,
+           const size_t PrimeCount,
+           const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  constexpr auto abs(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  auto find_next_prime(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& n, // NOLINT(readability-function-cognitive-complexity)
+                       const unsinged_fast_type                                     number_of_trials,
+                       DistributionType&                                            distribution,
+                       GeneratorType&                                               generator,
+                       const small_prime_table<PrimeCount>&                         table,
+                       const unsigned                                               thread_count) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
   {
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    // Find the smallest probable prime greater than or equal to n,
+    // or zero if there is none up to the maximum of the type.
 
-    return ((local_wide_integer_type::is_neg(x) == false) ? x : -x);
-  }
+    // Odd candidates are sieved in intervals against the prime table.
+    // The residues of the interval start modulo the primes are computed
+    // once and then carried from one interval to the next. The surviving
+    // candidates are handed out to the workers in increasing order, and
+    // the remaining candidates of the interval are cancelled as soon as
+    // a prime has been found. The workers run as the chunks of a job of
+    // the default thread pool, whose size limits the thread count. Worker
+    // zero uses the generator and the distribution of the caller, while
+    // the other workers use their own distributions and generators seeded
+    // from the caller's generator.
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  WIDE_INTEGER_CONSTEXPR auto sqrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
-  {
-    // Calculate the square root.
+    using local_wide_integer_type          = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_unsigned_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using local_prime_type                 = typename small_prime_table<PrimeCount>::value_type;
+    using local_seed_type                  = typename GeneratorType::result_type;
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    constexpr auto sieve_size = static_cast<size_t>(UINT16_C(4096));
 
-    local_wide_integer_type s;
+    const local_unsigned_wide_integer_type n_max((std::numeric_limits<local_wide_integer_type>::max)());
 
-    if(m.is_zero() || local_wide_integer_type::is_neg(m))
+    local_unsigned_wide_integer_type n0 =
+      ((local_wide_integer_type::is_neg(n) || (n < 2U)) ? local_unsigned_wide_integer_type(2U)
+                                                        : local_unsigned_wide_integer_type(n));
+
+    // Candidates up to the largest prime of the table are looked up directly.
+    const local_prime_type small_limit = (std::max)(table.largest(), static_cast<local_prime_type>(UINT8_C(227)));
+
+    for( ; n0 <= small_limit; ++n0)
     {
-      s = local_wide_integer_type(std::uint_fast8_t(0U));
+      if(detail::miller_rabin_with_table(local_wide_integer_type(n0), number_of_trials, distribution, generator, table))
+      {
+        return local_wide_integer_type(n0);
+      }
     }
-    else
+
+    if((static_cast<LimbType>(n0) & 1U) == 0U)
     {
-      // Obtain the initial guess via algorithms
-      // involving the position of the msb.
-      const unsinged_fast_type msb_pos = msb(m);
+      // The maximum of the type is odd, so this does not overflow.
+      ++n0;
+    }
 
-      // Obtain the initial value.
-      const unsinged_fast_type left_shift_amount =
-        ((unsinged_fast_type(msb_pos % 2U) == 0U)
-          ? 1U + unsinged_fast_type((msb_pos + 0U) / 2U)
-          : 1U + unsinged_fast_type((msb_pos + 1U) / 2U));
+    detail::fixed_static_array<std::uint32_t, PrimeCount> residues;
 
-      local_wide_integer_type u(local_wide_integer_type(std::uint_fast8_t(1U)) << left_shift_amount);
+    detail::prime_table_residues(n0, table, residues);
 
-      // Perform the iteration for the square root.
-      // See Algorithm 1.13 SqrtInt, Sect. 1.5.1
-      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-      // Cambridge University Press, 2011.
+    for(;;)
+    {
+      // The number of odd candidates n0 + 2k in this interval,
+      // limited by the maximum of the type.
+      const local_unsigned_wide_integer_type remaining_steps = (n_max - n0) / 2U;
 
-      for(unsinged_fast_type i = 0U; i < unsinged_fast_type(UINT8_C(64)); ++i)
+      const bool is_last_interval = (remaining_steps < (sieve_size - 1U));
+
+      const size_t candidate_count = (is_last_interval ? static_cast<size_t>(static_cast<size_t>(remaining_steps) + 1U) : sieve_size);
+
+      detail::fixed_static_array<std::uint8_t, sieve_size> is_composite(sieve_size, static_cast<std::uint8_t>(UINT8_C(0)));
+
+      for(auto j = static_cast<size_t>(0U); j < PrimeCount; ++j)
       {
-        s = u;
+        // Solve n0 + 2k = 0 (mod p) for k, with 1/2 = (p + 1)/2 (mod p).
+        const auto p = static_cast<std::uint64_t>(table[j]);
 
-        u = (s + (m / s)) >> 1;
+        for(auto k = static_cast<std::uint64_t>((((p - residues[j]) % p) * ((p + 1U) / 2U)) % p); k < candidate_count; k += p)
+        {
+          is_composite[static_cast<size_t>(k)] = static_cast<std::uint8_t>(UINT8_C(1));
+        }
+      }
 
-        if(u >= s)
+      detail::fixed_static_array<size_t, sieve_size> survivors;
+
+      auto survivor_count = static_cast<size_t>(0U);
+
+      for(auto k = static_cast<size_t>(0U); k < candidate_count; ++k)
+      {
+        if(is_composite[k] == static_cast<std::uint8_t>(UINT8_C(0)))
         {
-          break;
+          survivors[survivor_count] = k;
+
+          ++survivor_count;
         }
       }
-    }
 
-    return s;
-  }
+      detail::parallel_index next_index (static_cast<std::size_t>(0U));
+      detail::parallel_index prime_index(static_cast<std::size_t>(survivor_count));
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  WIDE_INTEGER_CONSTEXPR auto cbrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> // NOLINT(misc-no-recursion)
-  {
-    // Calculate the cube root.
+      const local_seed_type seed = generator();
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+      auto worker =
+        [&](const std::size_t worker_index)
+        {
+          GeneratorType    local_generator   (static_cast<local_seed_type>(seed + static_cast<local_seed_type>(worker_index)));
+          DistributionType local_distribution;
 
-    local_wide_integer_type s;
+          GeneratorType&    worker_generator    = ((worker_index == 0U) ? generator    : local_generator);
+          DistributionType& worker_distribution = ((worker_index == 0U) ? distribution : local_distribution);
 
-    if(local_wide_integer_type::is_neg(m))
-    {
-      s = -cbrt(-m);
-    }
-    else if(m.is_zero())
-    {
-      s = local_wide_integer_type(std::uint_fast8_t(0U));
+          for(;;)
+          {
+            const std::size_t index = next_index.fetch_increment();
+
+            if((index >= survivor_count) || (index > prime_index.load()))
+            {
+              break;
+            }
+
+            const local_wide_integer_type candidate(n0 + local_unsigned_wide_integer_type(static_cast<size_t>(survivors[static_cast<size_t>(index)] * 2U)));
+
+            if(detail::miller_rabin_rounds(candidate, number_of_trials, worker_distribution, worker_generator))
+            {
+              prime_index.store_min(index);
+            }
+          }
+        };
+
+      parallel::thread_pool& pool = parallel::thread_pool::default_pool();
+
+      pool.run(static_cast<std::size_t>((std::min)(detail::parallel_thread_count(thread_count, survivor_count), pool.size())), worker);
+
+      if(prime_index.load() < survivor_count)
+      {
+        return local_wide_integer_type(n0 + local_unsigned_wide_integer_type(static_cast<size_t>(survivors[static_cast<size_t>(prime_index.load())] * 2U)));
+      }
+
+      if(is_last_interval)
+      {
+        return local_wide_integer_type(0U);
+      }
+
+      // Advance to the next interval and update the residues.
+      n0 += static_cast<size_t>(sieve_size * 2U);
+
+      for(auto j = static_cast<size_t>(0U); j < PrimeCount; ++j)
+      {
+        const auto p = static_cast<std::uint64_t>(table[j]);
+
+        residues[j] = static_cast<std::uint32_t>((residues[j] + ((sieve_size * UINT64_C(2)) % p)) % p);
+      }
     }
-    else
-    {
-      // Obtain the initial guess via algorithms
-      // involving the position of the msb.
-      const unsinged_fast_type msb_pos = msb(m);
+  }
 
-      // Obtain the initial value.
-      const unsinged_fast_type msb_pos_mod_3 = msb_pos % 3;
+  template<typename RandomAccessInputIteratorType,
+           typename RandomAccessOutputIteratorType,
+           typename DistributionType,
+           typename GeneratorType,
+           const size_t PrimeCount>
+  auto miller_rabin_batch(RandomAccessInputIteratorType        first,
+                          RandomAccessInputIteratorType        last,
+                          RandomAccessOutputIteratorType       result,
+                          const unsinged_fast_type             number_of_trials,
+                          DistributionType&                    distribution,
+                          GeneratorType&                       generator,
+                          const small_prime_table<PrimeCount>& table,
+                          const unsigned                       thread_count) -> RandomAccessOutputIteratorType
+  {
+    // Test each candidate in [first, last) and store the result for
+    // the i'th candidate in result[i]. The candidates are checked for
+    // factors from the prime table before the Miller-Rabin trials, and
+    // they are handed out to the workers one at a time. The results are
+    // written concurrently, so the output range must not be bit-packed
+    // (such as the range of a std::vector<bool>).
 
-      const unsinged_fast_type left_shift_amount =
-        ((msb_pos_mod_3 == 0U)
-          ? 1U + unsinged_fast_type((msb_pos +                  0U ) / 3U)
-          : 1U + unsinged_fast_type((msb_pos + (3U - msb_pos_mod_3)) / 3U));
+    using local_seed_type = typename GeneratorType::result_type;
 
-      local_wide_integer_type u(local_wide_integer_type(std::uint_fast8_t(1U)) << left_shift_amount);
+    const auto candidate_count = static_cast<std::size_t>(std::distance(first, last));
 
-      // Perform the iteration for the k'th root.
-      // See Algorithm 1.14 RootInt, Sect. 1.5.2
-      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-      // Cambridge University Press, 2011.
+    detail::parallel_index next_index(static_cast<std::size_t>(0U));
 
-      const unsinged_fast_type three_minus_one(3U - 1U);
+    const local_seed_type seed = generator();
 
-      for(unsinged_fast_type i = 0U; i < unsinged_fast_type(UINT8_C(64)); ++i)
+    auto worker =
+      [&](const std::size_t worker_index)
       {
-        s = u;
+        GeneratorType    local_generator   (static_cast<local_seed_type>(seed + static_cast<local_seed_type>(worker_index)));
+        DistributionType local_distribution;
 
-        local_wide_integer_type m_over_s_pow_3_minus_one = m;
+        GeneratorType&    worker_generator    = ((worker_index == 0U) ? generator    : local_generator);
+        DistributionType& worker_distribution = ((worker_index == 0U) ? distribution : local_distribution);
 
-        for(unsinged_fast_type j = 0U; j < 3U - 1U; ++j)
+        for(;;)
         {
-          // Use a loop here to divide by s^(3 - 1) because
-          // without a loop, s^(3 - 1) is likely to overflow.
+          const std::size_t index = next_index.fetch_increment();
 
-          m_over_s_pow_3_minus_one /= s;
-        }
+          if(index >= candidate_count)
+          {
+            break;
+          }
 
-        u = ((s * three_minus_one) + m_over_s_pow_3_minus_one) / 3U;
+          using local_difference_type = typename std::iterator_traits<RandomAccessInputIteratorType>::difference_type;
 
-        if(u >= s)
-        {
-          break;
+          result[static_cast<local_difference_type>(index)] =
+            detail::miller_rabin_with_table(first[static_cast<local_difference_type>(index)],
+                                            number_of_trials,
+                                            worker_distribution,
+                                            worker_generator,
+                                            table);
         }
-      }
-    }
+      };
 
-    return s;
+    parallel::thread_pool& pool = parallel::thread_pool::default_pool();
+
+    pool.run(static_cast<std::size_t>((std::min)(detail::parallel_thread_count(thread_count, candidate_count), pool.size())), worker);
+
+    return result + static_cast<typename std::iterator_traits<RandomAccessOutputIteratorType>::difference_type>(candidate_count);
   }
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  WIDE_INTEGER_CONSTEXPR auto rootk(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m, const std::uint_fast8_t k) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  namespace detail {
+
+  template<typename LimbType,
+           const size_t LaneCount,
+           const size_t LimbCount>
+  struct batch_kernels_portable
   {
-    // Calculate the k'th root.
+    // Kernels for the limb-major layout of uintwide_batch, in which
+    // limb i of lane k is stored at index (i * LaneCount) + k.
+    // The kernels work on the lanes [first, last), so that the
+    // vector kernels can leave the lanes beyond their last full vector
+    // to these. The inner loops run across the independent lanes
+    // and are, as such, readily vectorized by the compiler.
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using limb_type = LimbType;
 
-    local_wide_integer_type s;
+    using double_limb_type =
+      typename uint_type_helper<static_cast<size_t>(std::numeric_limits<limb_type>::digits * 2)>::exact_unsigned_type;
 
-    if(k < 2U)
-    {
-      s = m;
-    }
-    else if(k == 2U)
+    static constexpr auto limb_digits = static_cast<unsigned>(std::numeric_limits<limb_type>::digits);
+
+    static auto add(      limb_type* r,
+                    const limb_type* u,
+                    const limb_type* v,
+                    const size_t     first,
+                    const size_t     last) -> void
     {
-      s = sqrt(m);
+      // Set r = u + v, where r may be the same as u or v.
+      std::array<limb_type, LaneCount> carry { };
+
+      for(auto i = static_cast<size_t>(0U); i < LimbCount; ++i)
+      {
+              limb_type* pr = r + (i * LaneCount);
+        const limb_type* pu = u + (i * LaneCount);
+        const limb_type* pv = v + (i * LaneCount);
+
+        for(auto k = first; k < last; ++k)
+        {
+          const auto s = static_cast<limb_type>(pu[k] + pv[k]);
+          const auto t = static_cast<limb_type>(s + carry[k]);
+
+          carry[k] = static_cast<limb_type>(static_cast<unsigned>(s < pu[k]) | static_cast<unsigned>(t < s));
+
+          pr[k] = t;
+        }
+      }
     }
-    else if(k == 3U)
+
+    static auto sub(      limb_type* r,
+                    const limb_type* u,
+                    const limb_type* v,
+                    const size_t     first,
+                    const size_t     last) -> void
     {
-      s = cbrt(m);
+      // Set r = u - v, where r may be the same as u or v.
+      std::array<limb_type, LaneCount> borrow { };
+
+      for(auto i = static_cast<size_t>(0U); i < LimbCount; ++i)
+      {
+              limb_type* pr = r + (i * LaneCount);
+        const limb_type* pu = u + (i * LaneCount);
+        const limb_type* pv = v + (i * LaneCount);
+
+        for(auto k = first; k < last; ++k)
+        {
+          const auto d = static_cast<limb_type>(pu[k] - pv[k]);
+          const auto t = static_cast<limb_type>(d - borrow[k]);
+
+          borrow[k] = static_cast<limb_type>(static_cast<unsigned>(pu[k] < pv[k]) | static_cast<unsigned>(d < borrow[k]));
+
+          pr[k] = t;
+        }
+      }
     }
-    else
+
+    static auto mul_lo(      limb_type* r,
+                       const limb_type* u,
+                       const limb_type* v,
+                       const size_t     first,
+                       const size_t     last) -> void
     {
-      if(m.is_zero() || local_wide_integer_type::is_neg(m))
+      // Set r to the lower LimbCount limbs of u * v,
+      // where r is neither u nor v.
+      for(auto i = static_cast<size_t>(0U); i < LimbCount; ++i)
       {
-        s = local_wide_integer_type(std::uint_fast8_t(0U));
+        std::fill(r + ((i * LaneCount) + first), r + ((i * LaneCount) + last), static_cast<limb_type>(0U));
       }
-      else
+
+      std::array<limb_type, LaneCount> carry;
+
+      for(auto i = static_cast<size_t>(0U); i < LimbCount; ++i)
       {
-        // Obtain the initial guess via algorithms
-        // involving the position of the msb.
-        const unsinged_fast_type msb_pos = msb(m);
+        std::fill(carry.begin() + first, carry.begin() + last, static_cast<limb_type>(0U));
 
-        // Obtain the initial value.
-        const unsinged_fast_type msb_pos_mod_k = msb_pos % k;
+        const limb_type* pu = u + (i * LaneCount);
 
-        const unsinged_fast_type left_shift_amount =
-          ((msb_pos_mod_k == 0U)
-            ? 1U + unsinged_fast_type((msb_pos +                 0U ) / k)
-            : 1U + unsinged_fast_type((msb_pos + (k - msb_pos_mod_k)) / k));
+        for(auto j = static_cast<size_t>(0U); j < static_cast<size_t>(LimbCount - i); ++j)
+        {
+                limb_type* pr = r + ((i + j) * LaneCount);
+          const limb_type* pv = v + (j       * LaneCount);
 
-        local_wide_integer_type u(local_wide_integer_type(std::uint_fast8_t(1U)) << left_shift_amount);
+          for(auto k = first; k < last; ++k)
+          {
+            const auto t =
+              static_cast<double_limb_type>
+              (
+                  static_cast<double_limb_type>(static_cast<double_limb_type>(pu[k]) * pv[k])
+                + static_cast<double_limb_type>(static_cast<double_limb_type>(pr[k]) + carry[k])
+              );
+
+            pr[k]    = static_cast<limb_type>(t);
+            carry[k] = static_cast<limb_type>(t >> limb_digits);
+          }
+        }
+      }
+    }
 
-        // Perform the iteration for the k'th root.
-        // See Algorithm 1.14 RootInt, Sect. 1.5.2
-        // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-        // Cambridge University Press, 2011.
+    static auto compare(      std::int_fast8_t* result,
+                        const limb_type*        u,
+                        const limb_type*        v,
+                        const size_t            first,
+                        const size_t            last) -> void
+    {
+      // Compare from the most significant limb down.
+      std::fill(result + first, result + last, static_cast<std::int_fast8_t>(INT8_C(0)));
+
+      for(auto i = LimbCount; i != static_cast<size_t>(0U); --i)
+      {
+        const limb_type* pu = u + ((i - 1U) * LaneCount);
+        const limb_type* pv = v + ((i - 1U) * LaneCount);
+
+        for(auto k = first; k < last; ++k)
+        {
+          const auto cmp = static_cast<int>(static_cast<int>(pu[k] > pv[k]) - static_cast<int>(pu[k] < pv[k]));
+
+          result[k] = static_cast<std::int_fast8_t>((result[k] != 0) ? static_cast<int>(result[k]) : cmp);
+        }
+      }
+    }
+
+    static auto shl(      limb_type*         r,
+                    const limb_type*         u,
+                    const unsinged_fast_type n,
+                    const size_t             first,
+                    const size_t             last) -> void
+    {
+      // Set r = u << n, where r may be the same as u.
+      // The rows are written from the top down.
+      const auto limb_shift = static_cast<size_t>  (n / limb_digits);
+      const auto bit_shift  = static_cast<unsigned>(n % limb_digits);
 
-        const unsinged_fast_type k_minus_one(k - 1U);
+      for(auto i = LimbCount; i != static_cast<size_t>(0U); --i)
+      {
+        const auto row = static_cast<size_t>((i - 1U) * LaneCount);
 
-        for(unsinged_fast_type i = 0U; i < unsinged_fast_type(UINT8_C(64)); ++i)
+        if((i - 1U) < limb_shift)
         {
-          s = u;
+          std::fill(r + (row + first), r + (row + last), static_cast<limb_type>(0U));
+        }
+        else
+        {
+                limb_type* pr = r + row;
+          const limb_type* pu = u + (((i - 1U) - limb_shift) * LaneCount);
 
-          local_wide_integer_type m_over_s_pow_k_minus_one = m;
+          const auto has_lo = ((bit_shift != 0U) && (pu != u));
 
-          for(unsinged_fast_type j = 0U; j < k - 1U; ++j)
-          {
-            // Use a loop here to divide by s^(k - 1) because
-            // without a loop, s^(k - 1) is likely to overflow.
+          const limb_type* pl = (has_lo ? (pu - LaneCount) : pu);
 
-            m_over_s_pow_k_minus_one /= s;
+          for(auto k = first; k < last; ++k)
+          {
+            const auto lo =
+              static_cast<limb_type>
+              (
+                has_lo ? static_cast<limb_type>(pl[k] >> (limb_digits - bit_shift))
+                       : static_cast<limb_type>(0U)
+              );
+
+            pr[k] = static_cast<limb_type>(static_cast<limb_type>(pu[k] << bit_shift) | lo);
           }
+        }
+      }
+    }
 
-          u = ((s * k_minus_one) + m_over_s_pow_k_minus_one) / k;
+    static auto shr(      limb_type*         r,
+                    const limb_type*         u,
+                    const unsinged_fast_type n,
+                    const size_t             first,
+                    const size_t             last) -> void
+    {
+      // Set r = u >> n, where r may be the same as u.
+      // The rows are written from the bottom up.
+      const auto limb_shift = static_cast<size_t>  (n / limb_digits);
+      const auto bit_shift  = static_cast<unsigned>(n % limb_digits);
 
-          if(u >= s)
+      for(auto i = static_cast<size_t>(0U); i < LimbCount; ++i)
+      {
+        const auto row = static_cast<size_t>(i * LaneCount);
+
+        if(limb_shift >= static_cast<size_t>(LimbCount - i))
+        {
+          std::fill(r + (row + first), r + (row + last), static_cast<limb_type>(0U));
+        }
+        else
+        {
+                limb_type* pr = r + row;
+          const limb_type* pu = u + ((i + limb_shift) * LaneCount);
+
+          const auto has_hi = ((bit_shift != 0U) && ((i + limb_shift + 1U) < LimbCount));
+
+          const limb_type* ph = (has_hi ? (pu + LaneCount) : pu);
+
+          for(auto k = first; k < last; ++k)
           {
-            break;
+            const auto hi =
+              static_cast<limb_type>
+              (
+                has_hi ? static_cast<limb_type>(ph[k] << (limb_digits - bit_shift))
+                       : static_cast<limb_type>(0U)
+              );
+
+            pr[k] = static_cast<limb_type>(static_cast<limb_type>(pu[k] >> bit_shift) | hi);
           }
         }
       }
     }
+  };
 
-    return s;
-  }
+  template<typename LimbType,
+           const size_t LaneCount,
+           const size_t LimbCount>
+  struct batch_kernels : public batch_kernels_portable<LimbType, LaneCount, LimbCount> { };
 
-  template<typename OtherIntegralTypeP,
-           const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  WIDE_INTEGER_CONSTEXPR auto pow(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b, const OtherIntegralTypeP& p) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  #if (WIDE_INTEGER_X86_64_AVX2_KERNELS_ARE_ACTIVE == 1)
+  // Vector operations on the lanes of the batch kernels. The masks
+  // are vectors having all bits set in the selected elements (AVX2)
+  // or mask registers (AVX-512).
+
+  template<typename LimbType>
+  struct batch_simd;
+
+  // The same, with the 32-bit limbs of the lanes widened
+  // to 64 bits for the 32 * 32 = 64 bit products.
+  struct batch_simd_wide;
+
+  #if (WIDE_INTEGER_X86_64_AVX512_KERNELS_ARE_ACTIVE == 1)
+  template<>
+  struct batch_simd<std::uint32_t>
   {
-    // Calculate (b ^ p).
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_limb_type         = typename local_wide_integer_type::limb_type;
+    using vector_type = __m512i;
+    using mask_type   = __mmask16;
+
+    static constexpr size_t width = static_cast<size_t>(UINT8_C(16));
+
+    static auto load   (const std::uint32_t* p) -> vector_type { return _mm512_loadu_si512(p); }
+    static auto store  (std::uint32_t* p, const vector_type a) -> void { _mm512_storeu_si512(p, a); }
+    static auto zero   () -> vector_type { return _mm512_setzero_si512(); }
+    static auto add    (const vector_type a, const vector_type b) -> vector_type { return _mm512_add_epi32(a, b); }
+    static auto sub    (const vector_type a, const vector_type b) -> vector_type { return _mm512_sub_epi32(a, b); }
+    static auto bit_or (const vector_type a, const vector_type b) -> vector_type { return _mm512_or_si512(a, b); }
+    static auto shl    (const vector_type a, const unsigned n) -> vector_type { return _mm512_sll_epi32(a, _mm_cvtsi32_si128(static_cast<int>(n))); }
+    static auto shr    (const vector_type a, const unsigned n) -> vector_type { return _mm512_srl_epi32(a, _mm_cvtsi32_si128(static_cast<int>(n))); }
+    static auto inc    (const vector_type a, const mask_type m) -> vector_type { return _mm512_mask_add_epi32(a, m, a, _mm512_set1_epi32(1)); }
+    static auto dec    (const vector_type a, const mask_type m) -> vector_type { return _mm512_mask_sub_epi32(a, m, a, _mm512_set1_epi32(1)); }
+    static auto less   (const vector_type a, const vector_type b) -> mask_type { return _mm512_cmplt_epu32_mask(a, b); }
+    static auto is_zero(const vector_type a) -> mask_type { return _mm512_testn_epi32_mask(a, a); }
+    static auto none   () -> mask_type { return static_cast<mask_type>(0U); }
+    static auto m_or   (const mask_type a, const mask_type b) -> mask_type { return static_cast<mask_type>(a | b); }
+    static auto m_and  (const mask_type a, const mask_type b) -> mask_type { return static_cast<mask_type>(a & b); }
+    static auto m_andn (const mask_type a, const mask_type b) -> mask_type { return static_cast<mask_type>(static_cast<unsigned>(~static_cast<unsigned>(a)) & b); }
+    static auto bits   (const mask_type a) -> std::uint32_t { return static_cast<std::uint32_t>(a); }
+  };
 
-    local_wide_integer_type result;
-    auto p0(static_cast<local_limb_type>(p));
+  template<>
+  struct batch_simd<std::uint64_t>
+  {
+    using vector_type = __m512i;
+    using mask_type   = __mmask8;
+
+    static constexpr size_t width = static_cast<size_t>(UINT8_C(8));
+
+    static auto load   (const std::uint64_t* p) -> vector_type { return _mm512_loadu_si512(p); }
+    static auto store  (std::uint64_t* p, const vector_type a) -> void { _mm512_storeu_si512(p, a); }
+    static auto zero   () -> vector_type { return _mm512_setzero_si512(); }
+    static auto add    (const vector_type a, const vector_type b) -> vector_type { return _mm512_add_epi64(a, b); }
+    static auto sub    (const vector_type a, const vector_type b) -> vector_type { return _mm512_sub_epi64(a, b); }
+    static auto bit_or (const vector_type a, const vector_type b) -> vector_type { return _mm512_or_si512(a, b); }
+    static auto shl    (const vector_type a, const unsigned n) -> vector_type { return _mm512_sll_epi64(a, _mm_cvtsi32_si128(static_cast<int>(n))); }
+    static auto shr    (const vector_type a, const unsigned n) -> vector_type { return _mm512_srl_epi64(a, _mm_cvtsi32_si128(static_cast<int>(n))); }
+    static auto inc    (const vector_type a, const mask_type m) -> vector_type { return _mm512_mask_add_epi64(a, m, a, _mm512_set1_epi64(1)); }
+    static auto dec    (const vector_type a, const mask_type m) -> vector_type { return _mm512_mask_sub_epi64(a, m, a, _mm512_set1_epi64(1)); }
+    static auto less   (const vector_type a, const vector_type b) -> mask_type { return _mm512_cmplt_epu64_mask(a, b); }
+    static auto is_zero(const vector_type a) -> mask_type { return _mm512_testn_epi64_mask(a, a); }
+    static auto none   () -> mask_type { return static_cast<mask_type>(0U); }
+    static auto m_or   (const mask_type a, const mask_type b) -> mask_type { return static_cast<mask_type>(a | b); }
+    static auto m_and  (const mask_type a, const mask_type b) -> mask_type { return static_cast<mask_type>(a & b); }
+    static auto m_andn (const mask_type a, const mask_type b) -> mask_type { return static_cast<mask_type>(static_cast<unsigned>(~static_cast<unsigned>(a)) & b); }
+    static auto bits   (const mask_type a) -> std::uint32_t { return static_cast<std::uint32_t>(a); }
+  };
 
-    if((p0 == 0U) && (p == OtherIntegralTypeP(0)))
-    {
-      result = local_wide_integer_type(std::uint8_t(1U));
+  struct batch_simd_wide
+  {
+    using vector_type = __m512i;
+
+    static constexpr size_t width = static_cast<size_t>(UINT8_C(8));
+
+    static auto load (const std::uint32_t* p) -> vector_type { return _mm512_cvtepu32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))); } // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    static auto store(std::uint32_t* p, const vector_type a) -> void { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtepi64_epi32(a)); } // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    static auto zero () -> vector_type { return _mm512_setzero_si512(); }
+    static auto add  (const vector_type a, const vector_type b) -> vector_type { return _mm512_add_epi64(a, b); }
+    static auto mul  (const vector_type a, const vector_type b) -> vector_type { return _mm512_mul_epu32(a, b); }
+    static auto hi   (const vector_type a) -> vector_type { return _mm512_srli_epi64(a, 32); }
+  };
+  #else
+  template<>
+  struct batch_simd<std::uint32_t>
+  {
+    using vector_type = __m256i;
+    using mask_type   = __m256i;
+
+    static constexpr size_t width = static_cast<size_t>(UINT8_C(8));
+
+    static auto load   (const std::uint32_t* p) -> vector_type { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); } // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    static auto store  (std::uint32_t* p, const vector_type a) -> void { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a); } // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    static auto zero   () -> vector_type { return _mm256_setzero_si256(); }
+    static auto add    (const vector_type a, const vector_type b) -> vector_type { return _mm256_add_epi32(a, b); }
+    static auto sub    (const vector_type a, const vector_type b) -> vector_type { return _mm256_sub_epi32(a, b); }
+    static auto bit_or (const vector_type a, const vector_type b) -> vector_type { return _mm256_or_si256(a, b); }
+    static auto shl    (const vector_type a, const unsigned n) -> vector_type { return _mm256_sll_epi32(a, _mm_cvtsi32_si128(static_cast<int>(n))); }
+    static auto shr    (const vector_type a, const unsigned n) -> vector_type { return _mm256_srl_epi32(a, _mm_cvtsi32_si128(static_cast<int>(n))); }
+    static auto inc    (const vector_type a, const mask_type m) -> vector_type { return _mm256_sub_epi32(a, m); }
+    static auto dec    (const vector_type a, const mask_type m) -> vector_type { return _mm256_add_epi32(a, m); }
+    static auto is_zero(const vector_type a) -> mask_type { return _mm256_cmpeq_epi32(a, _mm256_setzero_si256()); }
+    static auto none   () -> mask_type { return _mm256_setzero_si256(); }
+    static auto m_or   (const mask_type a, const mask_type b) -> mask_type { return _mm256_or_si256(a, b); }
+    static auto m_and  (const mask_type a, const mask_type b) -> mask_type { return _mm256_and_si256(a, b); }
+    static auto m_andn (const mask_type a, const mask_type b) -> mask_type { return _mm256_andnot_si256(a, b); }
+    static auto bits   (const mask_type a) -> std::uint32_t { return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(a))); }
+
+    static auto less(const vector_type a, const vector_type b) -> mask_type
+    {
+      // Unsigned comparison with the signed comparison
+      // of the operands having their sign bits flipped.
+      const vector_type sign = _mm256_set1_epi32(INT32_MIN);
+
+      return _mm256_cmpgt_epi32(_mm256_xor_si256(b, sign), _mm256_xor_si256(a, sign));
     }
-    else if((p0 == 1U) && (p == OtherIntegralTypeP(1)))
+  };
+
+  template<>
+  struct batch_simd<std::uint64_t>
+  {
+    using vector_type = __m256i;
+    using mask_type   = __m256i;
+
+    static constexpr size_t width = static_cast<size_t>(UINT8_C(4));
+
+    static auto load   (const std::uint64_t* p) -> vector_type { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); } // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    static auto store  (std::uint64_t* p, const vector_type a) -> void { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a); } // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    static auto zero   () -> vector_type { return _mm256_setzero_si256(); }
+    static auto add    (const vector_type a, const vector_type b) -> vector_type { return _mm256_add_epi64(a, b); }
+    static auto sub    (const vector_type a, const vector_type b) -> vector_type { return _mm256_sub_epi64(a, b); }
+    static auto bit_or (const vector_type a, const vector_type b) -> vector_type { return _mm256_or_si256(a, b); }
+    static auto shl    (const vector_type a, const unsigned n) -> vector_type { return _mm256_sll_epi64(a, _mm_cvtsi32_si128(static_cast<int>(n))); }
+    static auto shr    (const vector_type a, const unsigned n) -> vector_type { return _mm256_srl_epi64(a, _mm_cvtsi32_si128(static_cast<int>(n))); }
+    static auto inc    (const vector_type a, const mask_type m) -> vector_type { return _mm256_sub_epi64(a, m); }
+    static auto dec    (const vector_type a, const mask_type m) -> vector_type { return _mm256_add_epi64(a, m); }
+    static auto is_zero(const vector_type a) -> mask_type { return _mm256_cmpeq_epi64(a, _mm256_setzero_si256()); }
+    static auto none   () -> mask_type { return _mm256_setzero_si256(); }
+    static auto m_or   (const mask_type a, const mask_type b) -> mask_type { return _mm256_or_si256(a, b); }
+    static auto m_and  (const mask_type a, const mask_type b) -> mask_type { return _mm256_and_si256(a, b); }
+    static auto m_andn (const mask_type a, const mask_type b) -> mask_type { return _mm256_andnot_si256(a, b); }
+    static auto bits   (const mask_type a) -> std::uint32_t { return static_cast<std::uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(a))); }
+
+    static auto less(const vector_type a, const vector_type b) -> mask_type
+    {
+      const vector_type sign = _mm256_set1_epi64x(INT64_MIN);
+
+      return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign), _mm256_xor_si256(a, sign));
+    }
+  };
+
+  struct batch_simd_wide
+  {
+    using vector_type = __m256i;
+
+    static constexpr size_t width = static_cast<size_t>(UINT8_C(4));
+
+    static auto load (const std::uint32_t* p) -> vector_type { return _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); } // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    static auto zero () -> vector_type { return _mm256_setzero_si256(); }
+    static auto add  (const vector_type a, const vector_type b) -> vector_type { return _mm256_add_epi64(a, b); }
+    static auto mul  (const vector_type a, const vector_type b) -> vector_type { return _mm256_mul_epu32(a, b); }
+    static auto hi   (const vector_type a) -> vector_type { return _mm256_srli_epi64(a, 32); }
+
+    static auto store(std::uint32_t* p, const vector_type a) -> void
     {
-      result = b;
+      // Gather the lower halves of the four 64-bit elements.
+      const __m256i lo = _mm256_permutevar8x32_epi32(a, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6));
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_castsi256_si128(lo)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
     }
-    else if((p0 == 2U) && (p == OtherIntegralTypeP(2)))
+  };
+  #endif
+
+  template<typename LimbType,
+           const size_t LaneCount,
+           const size_t LimbCount,
+           typename EnableType = void>
+  struct batch_mul_lo_simd
+  {
+    // Without a vector multiplication that pays off,
+    // such as for 64-bit limbs lacking IFMA, the portable
+    // multiplication is used.
+    static auto mul_lo(      LimbType* r,
+                       const LimbType* u,
+                       const LimbType* v,
+                       const size_t    first,
+                       const size_t    last) -> void
     {
-      result  = b;
-      result *= b;
+      batch_kernels_portable<LimbType, LaneCount, LimbCount>::mul_lo(r, u, v, first, last);
     }
-    else
+  };
+
+  template<const size_t LaneCount,
+           const size_t LimbCount>
+  struct batch_mul_lo_simd<std::uint32_t, LaneCount, LimbCount>
+  {
+    static auto mul_lo(      std::uint32_t* r,
+                       const std::uint32_t* u,
+                       const std::uint32_t* v,
+                       const size_t         first,
+                       const size_t         last) -> void
     {
-      result = local_wide_integer_type(std::uint8_t(1U));
+      // Schoolbook multiplication with the 32-bit limbs widened to
+      // 64 bits. The sum u_i * v_j + r_(i+j) + carry fits in 64 bits.
+      using wide_type = batch_simd_wide;
 
-      local_wide_integer_type y      (b);
-      local_wide_integer_type p_local(p);
+      const auto vector_last = static_cast<size_t>(first + (((last - first) / wide_type::width) * wide_type::width));
 
-      while(((p0 = local_limb_type(p_local)) != 0U) || (p_local != 0U))
+      for(auto c = first; c < vector_last; c += wide_type::width)
       {
-        if((p0 & 1U) != 0U)
+        for(auto i = static_cast<size_t>(0U); i < LimbCount; ++i)
         {
-          result *= y;
+          wide_type::store(r + ((i * LaneCount) + c), wide_type::zero());
         }
 
-        y *= y;
+        for(auto i = static_cast<size_t>(0U); i < LimbCount; ++i)
+        {
+          const typename wide_type::vector_type ui = wide_type::load(u + ((i * LaneCount) + c));
 
-        p_local >>= 1;
+          typename wide_type::vector_type carry = wide_type::zero();
+
+          for(auto j = static_cast<size_t>(0U); j < static_cast<size_t>(LimbCount - i); ++j)
+          {
+            std::uint32_t* pr = r + (((i + j) * LaneCount) + c);
+
+            const typename wide_type::vector_type t =
+              wide_type::add(wide_type::add(wide_type::mul(ui, wide_type::load(v + ((j * LaneCount) + c))), wide_type::load(pr)), carry);
+
+            wide_type::store(pr, t);
+
+            carry = wide_type::hi(t);
+          }
+        }
       }
-    }
 
-    return result;
-  }
+      batch_kernels_portable<std::uint32_t, LaneCount, LimbCount>::mul_lo(r, u, v, vector_last, last);
+    }
+  };
 
-  template<typename OtherIntegralTypeP,
-           typename OtherIntegralTypeM,
-           const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  WIDE_INTEGER_CONSTEXPR auto powm(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b,
-                                   const OtherIntegralTypeP& p,
-                                   const OtherIntegralTypeM& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  #if (WIDE_INTEGER_X86_64_AVX512_IFMA_KERNELS_ARE_ACTIVE == 1)
+  template<const size_t LaneCount,
+           const size_t LimbCount>
+  struct batch_mul_lo_simd<std::uint64_t,
+                           LaneCount,
+                           LimbCount,
+                           typename std::enable_if<(LimbCount <= static_cast<size_t>(UINT8_C(32)))>::type>
   {
-    // Calculate (b ^ p) % m.
+    // The 64-bit limbs of eight lanes are converted to digits of 52 bits,
+    // multiplied with the 52 * 52 = 104 bit products of IFMA and converted
+    // back. The columns of the product are summed in 64 bits without
+    // carries, which holds for up to 2^12 digits. Beyond 2048 bits,
+    // the digits would no longer fit in the registers and the stack
+    // is used without benefit, so these are left to the portable code.
 
-    using local_normal_width_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_double_width_type = typename local_normal_width_type::double_width_type;
-    using local_limb_type         = typename local_normal_width_type::limb_type;
+    static constexpr auto digit_bits  = static_cast<unsigned>(UINT8_C(52));
+    static constexpr auto digit_count = static_cast<size_t>(((LimbCount * 64U) + (digit_bits - 1U)) / digit_bits);
 
-          local_normal_width_type result;
-          local_double_width_type y      (b);
-    const local_double_width_type m_local(m);
-          auto                    p0     (static_cast<local_limb_type>(p));
+    // A plain array, since std::array would drop the
+    // alignment attributes of the vector type.
+    using digits_array_type = __m512i[digit_count]; // NOLINT(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays)
 
-    if((p0 == 0U) && (p == OtherIntegralTypeP(0)))
-    {
-      result = local_normal_width_type((m != 1U) ? std::uint8_t(1U) : std::uint8_t(0U));
-    }
-    else if((p0 == 1U) && (p == OtherIntegralTypeP(1)))
-    {
-      result = b % m;
-    }
-    else if((p0 == 2U) && (p == OtherIntegralTypeP(2)))
+    static auto to_digits(digits_array_type& d, const std::uint64_t* u) -> void
     {
-      y *= y;
-      y %= m_local;
+      const __m512i mask = _mm512_set1_epi64(static_cast<long long>((UINT64_C(1) << digit_bits) - 1U)); // NOLINT(google-runtime-int)
 
-      result = local_normal_width_type(y);
+      for(auto k = static_cast<size_t>(0U); k < digit_count; ++k)
+      {
+        const auto bit = static_cast<size_t>  (k * digit_bits);
+        const auto q   = static_cast<size_t>  (bit / 64U);
+        const auto s   = static_cast<unsigned>(bit % 64U);
+
+        __m512i x = _mm512_srl_epi64(_mm512_loadu_si512(u + (q * LaneCount)), _mm_cvtsi32_si128(static_cast<int>(s)));
+
+        if((s > (64U - digit_bits)) && ((q + 1U) < LimbCount))
+        {
+          x = _mm512_or_si512(x, _mm512_sll_epi64(_mm512_loadu_si512(u + ((q + 1U) * LaneCount)), _mm_cvtsi32_si128(static_cast<int>(64U - s))));
+        }
+
+        d[k] = _mm512_and_si512(x, mask);
+      }
     }
-    else
-    {
-      local_double_width_type x      (std::uint8_t(1U));
-      OtherIntegralTypeP      p_local(p);
 
-      while(((p0 = local_limb_type(p_local)) != 0U) || (p_local != 0U))
+    static auto from_digits(std::uint64_t* r, const digits_array_type& d) -> void
+    {
+      for(auto q = static_cast<size_t>(0U); q < LimbCount; ++q)
       {
-        if((p0 & 1U) != 0U)
+        __m512i x = _mm512_setzero_si512();
+
+        for(auto k = static_cast<size_t>((q * 64U) / digit_bits); ((k < digit_count) && ((k * digit_bits) < ((q + 1U) * 64U))); ++k)
         {
-          x *= y;
-          x %= m_local;
-        }
+          const auto bit = static_cast<size_t>(k * digit_bits);
 
-        y *= y;
-        y %= m_local;
+          x = _mm512_or_si512(x, ((bit < (q * 64U)) ? _mm512_srl_epi64(d[k], _mm_cvtsi32_si128(static_cast<int>((q * 64U) - bit)))
+                                                    : _mm512_sll_epi64(d[k], _mm_cvtsi32_si128(static_cast<int>(bit - (q * 64U))))));
+        }
 
-        p_local >>= 1U; // NOLINT(hicpp-signed-bitwise)
+        _mm512_storeu_si512(r + (q * LaneCount), x);
       }
-
-      result = local_normal_width_type(x);
     }
 
-    return result;
-  }
+    static auto mul_lo(      std::uint64_t* r,
+                       const std::uint64_t* u,
+                       const std::uint64_t* v,
+                       const size_t         first,
+                       const size_t         last) -> void
+    {
+      constexpr auto width = static_cast<size_t>(UINT8_C(8));
 
-  namespace detail {
+      const auto vector_last = static_cast<size_t>(first + (((last - first) / width) * width));
 
-  template<typename UnsignedShortType>
-  WIDE_INTEGER_CONSTEXPR auto integer_gcd_reduce_short(UnsignedShortType u, UnsignedShortType v) -> UnsignedShortType
-  {
-    // This implementation of GCD reduction is based on an
-    // adaptation of existing code from Boost.Multiprecision.
+      const __m512i mask = _mm512_set1_epi64(static_cast<long long>((UINT64_C(1) << digit_bits) - 1U)); // NOLINT(google-runtime-int)
 
-    for(;;)
-    {
-      if(u > v)
+      for(auto c = first; c < vector_last; c += width)
       {
-        std::swap(u, v);
-      }
+        digits_array_type a;
+        digits_array_type b;
+        digits_array_type p;
 
-      if(u == v)
-      {
-        break;
+        to_digits(a, u + c);
+        to_digits(b, v + c);
+
+        std::fill(p, p + digit_count, _mm512_setzero_si512());
+
+        for(auto i = static_cast<size_t>(0U); i < digit_count; ++i)
+        {
+          for(auto j = static_cast<size_t>(0U); j < static_cast<size_t>(digit_count - i); ++j)
+          {
+            p[i + j] = _mm512_madd52lo_epu64(p[i + j], a[i], b[j]);
+
+            if((i + j + 1U) < digit_count)
+            {
+              p[i + j + 1U] = _mm512_madd52hi_epu64(p[i + j + 1U], a[i], b[j]);
+            }
+          }
+        }
+
+        __m512i carry = _mm512_setzero_si512();
+
+        for(auto k = static_cast<size_t>(0U); k < digit_count; ++k)
+        {
+          const __m512i x = _mm512_add_epi64(p[k], carry);
+
+          carry = _mm512_srli_epi64(x, 52);
+          p[k]  = _mm512_and_si512(x, mask);
+        }
+
+        from_digits(r + c, p);
       }
 
-      v  -= u;
-      v >>= detail::lsb_helper(v);
+      batch_kernels_portable<std::uint64_t, LaneCount, LimbCount>::mul_lo(r, u, v, vector_last, last);
     }
+  };
+  #endif
 
-    return u;
-  }
-
-  template<typename UnsignedLargeType>
-  WIDE_INTEGER_CONSTEXPR auto integer_gcd_reduce_large(UnsignedLargeType u, UnsignedLargeType v) -> UnsignedLargeType
+  template<typename LimbType,
+           const size_t LaneCount,
+           const size_t LimbCount>
+  struct batch_kernels_simd : public batch_kernels_portable<LimbType, LaneCount, LimbCount>
   {
-    // This implementation of GCD reduction is based on an
-    // adaptation of existing code from Boost.Multiprecision.
+    // The vector kernels work on whole vectors of lanes
+    // and leave the remaining lanes to the portable kernels.
 
-    using local_ularge_type = UnsignedLargeType;
-    using local_ushort_type = typename detail::uint_type_helper<size_t(std::numeric_limits<local_ularge_type>::digits / 2)>::exact_unsigned_type;
+    using base_class_type = batch_kernels_portable<LimbType, LaneCount, LimbCount>;
+    using limb_type       = LimbType;
+    using simd_type       = batch_simd<limb_type>;
+    using vector_type     = typename simd_type::vector_type;
+    using mask_type       = typename simd_type::mask_type;
 
-    for(;;)
+    static constexpr auto limb_digits = static_cast<unsigned>(std::numeric_limits<limb_type>::digits);
+
+    static auto vector_last(const size_t first, const size_t last) -> size_t
     {
-      if(u > v)
-      {
-        std::swap(u, v);
-      }
+      return static_cast<size_t>(first + (((last - first) / simd_type::width) * simd_type::width));
+    }
 
-      if(u == v)
-      {
-        break;
-      }
+    static auto add(      limb_type* r,
+                    const limb_type* u,
+                    const limb_type* v,
+                    const size_t     first,
+                    const size_t     last) -> void
+    {
+      const size_t v_last = vector_last(first, last);
 
-      if(v <= local_ularge_type((std::numeric_limits<local_ushort_type>::max)()))
+      for(auto c = first; c < v_last; c += simd_type::width)
       {
-        u = integer_gcd_reduce_short(local_ushort_type(v),
-                                     local_ushort_type(u));
+        mask_type carry = simd_type::none();
 
-        break;
-      }
+        for(auto i = static_cast<size_t>(0U); i < LimbCount; ++i)
+        {
+          const auto row = static_cast<size_t>((i * LaneCount) + c);
 
-      v -= u;
+          const vector_type a = simd_type::load(u + row);
+          const vector_type s = simd_type::add(a, simd_type::load(v + row));
+          const vector_type t = simd_type::inc(s, carry);
 
-      while((local_ushort_type(v) & 1U) == 0U)
-      {
-        v >>= 1U;
+          // The carry out is (s < a) or (t == 0 with a carry in).
+          carry = simd_type::m_or(simd_type::less(s, a), simd_type::m_and(simd_type::is_zero(t), carry));
+
+          simd_type::store(r + row, t);
+        }
       }
-    }
 
-    return u;
-  }
+      base_class_type::add(r, u, v, v_last, last);
+    }
 
-  } // namespace detail
+    static auto sub(      limb_type* r,
+                    const limb_type* u,
+                    const limb_type* v,
+                    const size_t     first,
+                    const size_t     last) -> void
+    {
+      const size_t v_last = vector_last(first, last);
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  WIDE_INTEGER_CONSTEXPR auto gcd(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
-                                  const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
-  {
-    // This implementation of GCD is an adaptation
-    // of existing code from Boost.Multiprecision.
+      for(auto c = first; c < v_last; c += simd_type::width)
+      {
+        mask_type borrow = simd_type::none();
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_ushort_type       = typename local_wide_integer_type::limb_type;
-    using local_ularge_type       = typename local_wide_integer_type::double_limb_type;
+        for(auto i = static_cast<size_t>(0U); i < LimbCount; ++i)
+        {
+          const auto row = static_cast<size_t>((i * LaneCount) + c);
 
-    const bool u_is_neg = local_wide_integer_type::is_neg(a);
-    const bool v_is_neg = local_wide_integer_type::is_neg(b);
+          const vector_type a = simd_type::load(u + row);
+          const vector_type b = simd_type::load(v + row);
+          const vector_type d = simd_type::sub(a, b);
 
-    local_wide_integer_type u((!u_is_neg) ? a : -a);
-    local_wide_integer_type v((!v_is_neg) ? b : -b);
+          // The borrow out is (a < b) or (d == 0 with a borrow in).
+          const mask_type borrow_out = simd_type::m_or(simd_type::less(a, b), simd_type::m_and(simd_type::is_zero(d), borrow));
 
-    local_wide_integer_type result;
+          simd_type::store(r + row, simd_type::dec(d, borrow));
 
-    if(u == v)
-    {
-      // This handles cases having (u = v) and also (u = v = 0).
-      result = u;
-    }
+          borrow = borrow_out;
+        }
+      }
 
-    if((static_cast<local_ushort_type>(v) == 0U) && (v == 0U))
-    {
-      // This handles cases having (v = 0) with (u != 0).
-      result = u;
+      base_class_type::sub(r, u, v, v_last, last);
     }
 
-    if((static_cast<local_ushort_type>(u) == 0U) && (u == 0U))
+    static auto mul_lo(      limb_type* r,
+                       const limb_type* u,
+                       const limb_type* v,
+                       const size_t     first,
+                       const size_t     last) -> void
     {
-      // This handles cases having (u = 0) with (v != 0).
-      result = v;
+      batch_mul_lo_simd<limb_type, LaneCount, LimbCount>::mul_lo(r, u, v, first, last);
     }
-    else
+
+    static auto compare(      std::int_fast8_t* result,
+                        const limb_type*        u,
+                        const limb_type*        v,
+                        const size_t            first,
+                        const size_t            last) -> void
     {
-      // Now we handle cases having (u != 0) and (v != 0).
+      const size_t v_last = vector_last(first, last);
 
-      // Let shift := lg K, where K is the greatest
-      // power of 2 dividing both u and v.
+      constexpr auto all_lanes = static_cast<std::uint32_t>((UINT64_C(1) << simd_type::width) - 1U);
 
-      const unsinged_fast_type u_shift = lsb(u);
-      const unsinged_fast_type v_shift = lsb(v);
+      for(auto c = first; c < v_last; c += simd_type::width)
+      {
+        mask_type greater = simd_type::none();
+        mask_type less    = simd_type::none();
 
-      const unsinged_fast_type left_shift_amount = (std::min)(u_shift, v_shift);
+        // Stop as soon as all lanes are decided, which for
+        // uniformly distributed values is mostly the top limb.
+        for(auto i = LimbCount; i != static_cast<size_t>(0U); --i)
+        {
+          const auto row = static_cast<size_t>(((i - 1U) * LaneCount) + c);
 
-      u >>= u_shift;
-      v >>= v_shift;
+          const vector_type a = simd_type::load(u + row);
+          const vector_type b = simd_type::load(v + row);
 
-      for(;;)
-      {
-        // Now u and v are both odd, so diff(u, v) is even.
-        // Let u = min(u, v), v = diff(u, v) / 2.
+          const mask_type decided = simd_type::m_or(greater, less);
 
-        if(u > v)
-        {
-          swap(u, v);
+          greater = simd_type::m_or(greater, simd_type::m_andn(decided, simd_type::less(b, a)));
+          less    = simd_type::m_or(less,    simd_type::m_andn(decided, simd_type::less(a, b)));
+
+          if(simd_type::bits(simd_type::m_or(greater, less)) == all_lanes)
+          {
+            break;
+          }
         }
 
-        if(u == v)
+        const std::uint32_t greater_bits = simd_type::bits(greater);
+        const std::uint32_t less_bits    = simd_type::bits(less);
+
+        for(auto k = static_cast<size_t>(0U); k < simd_type::width; ++k)
         {
-          break;
+          result[c + k] =
+            static_cast<std::int_fast8_t>
+            (
+                static_cast<int>((greater_bits >> k) & 1U)
+              - static_cast<int>((less_bits    >> k) & 1U)
+            );
         }
+      }
+
+      base_class_type::compare(result, u, v, v_last, last);
+    }
 
-        if(v <= (std::numeric_limits<local_ularge_type>::max)())
+    static auto shl(      limb_type*         r,
+                    const limb_type*         u,
+                    const unsinged_fast_type n,
+                    const size_t             first,
+                    const size_t             last) -> void
+    {
+      const size_t v_last = vector_last(first, last);
+
+      const auto limb_shift = static_cast<size_t>  (n / limb_digits);
+      const auto bit_shift  = static_cast<unsigned>(n % limb_digits);
+
+      for(auto c = first; c < v_last; c += simd_type::width)
+      {
+        for(auto i = LimbCount; i != static_cast<size_t>(0U); --i)
         {
-          if(v <= (std::numeric_limits<local_ushort_type>::max)())
+          const auto row = static_cast<size_t>(((i - 1U) * LaneCount) + c);
+
+          if((i - 1U) < limb_shift)
           {
-            u = detail::integer_gcd_reduce_short(*(v.crepresentation().cbegin() + 0U),
-                                                 *(u.crepresentation().cbegin() + 0U));
+            simd_type::store(r + row, simd_type::zero());
           }
           else
           {
-            const local_ularge_type v_large =
-              detail::make_large(*(v.crepresentation().cbegin() + 0U),
-                                 *(v.crepresentation().cbegin() + 1U));
+            const auto src = static_cast<size_t>((((i - 1U) - limb_shift) * LaneCount) + c);
 
-            const local_ularge_type u_large =
-              detail::make_large(*(u.crepresentation().cbegin() + 0U),
-                                 *(u.crepresentation().cbegin() + 1U));
+            vector_type x = simd_type::load(u + src);
 
-            u = detail::integer_gcd_reduce_large(v_large, u_large);
-          }
+            if(bit_shift != 0U)
+            {
+              x = simd_type::shl(x, bit_shift);
 
-          break;
-        }
+              if(src >= LaneCount)
+              {
+                x = simd_type::bit_or(x, simd_type::shr(simd_type::load(u + (src - LaneCount)), limb_digits - bit_shift));
+              }
+            }
 
-        v  -= u;
-        v >>= lsb(v);
+            simd_type::store(r + row, x);
+          }
+        }
       }
 
-      result = (u << left_shift_amount);
-    }
-
-    return ((u_is_neg == v_is_neg) ? result : -result);
-  }
-
-  template<typename UnsignedShortType>
-  WIDE_INTEGER_CONSTEXPR auto gcd(const UnsignedShortType& u, const UnsignedShortType& v) -> typename std::enable_if<(   (std::is_integral   <UnsignedShortType>::value)
-                                                                                                                      && (std::is_unsigned   <UnsignedShortType>::value)), UnsignedShortType>::type
-  {
-    UnsignedShortType result;
-
-    if(u > v)
-    {
-      result = gcd(v, u);
+      base_class_type::shl(r, u, n, v_last, last);
     }
 
-    if(u == v)
+    static auto shr(      limb_type*         r,
+                    const limb_type*         u,
+                    const unsinged_fast_type n,
+                    const size_t             first,
+                    const size_t             last) -> void
     {
-      // This handles cases having (u = v) and also (u = v = 0).
-      result = u;
-    }
+      const size_t v_last = vector_last(first, last);
 
-    if(v == 0U)
-    {
-      // This handles cases having (v = 0) with (u != 0).
-      result = u;
-    }
+      const auto limb_shift = static_cast<size_t>  (n / limb_digits);
+      const auto bit_shift  = static_cast<unsigned>(n % limb_digits);
 
-    if(u == 0U)
-    {
-      // This handles cases having (u = 0) with (v != 0).
-      result = v;
-    }
-    else
-    {
-      result = detail::integer_gcd_reduce_short(u, v);
-    }
+      for(auto c = first; c < v_last; c += simd_type::width)
+      {
+        for(auto i = static_cast<size_t>(0U); i < LimbCount; ++i)
+        {
+          const auto row = static_cast<size_t>((i * LaneCount) + c);
 
-    return result;
-  }
+          if(limb_shift >= static_cast<size_t>(LimbCount - i))
+          {
+            simd_type::store(r + row, simd_type::zero());
+          }
+          else
+          {
+            const auto src = static_cast<size_t>(((i + limb_shift) * LaneCount) + c);
 
-  namespace detail {
+            vector_type x = simd_type::load(u + src);
 
-  template<typename IntegerType>
-  WIDE_INTEGER_CONSTEXPR auto lcm_impl(const IntegerType& a, const IntegerType& b) -> IntegerType
-  {
-    using local_integer_type = IntegerType;
+            if(bit_shift != 0U)
+            {
+              x = simd_type::shr(x, bit_shift);
 
-    using std::abs;
+              if((i + limb_shift + 1U) < LimbCount)
+              {
+                x = simd_type::bit_or(x, simd_type::shl(simd_type::load(u + (src + LaneCount)), limb_digits - bit_shift));
+              }
+            }
 
-    const local_integer_type ap = abs(a);
-    const local_integer_type bp = abs(b);
+            simd_type::store(r + row, x);
+          }
+        }
+      }
 
-    const bool a_is_greater_than_b = (ap > bp);
+      base_class_type::shr(r, u, n, v_last, last);
+    }
+  };
 
-    const local_integer_type gcd_of_ab = gcd(a, b);
+  template<const size_t LaneCount,
+           const size_t LimbCount>
+  struct batch_kernels<std::uint32_t, LaneCount, LimbCount> : public batch_kernels_simd<std::uint32_t, LaneCount, LimbCount> { };
 
-    return (a_is_greater_than_b ? ap * (bp / gcd_of_ab)
-                                : bp * (ap / gcd_of_ab));
-  }
+  template<const size_t LaneCount,
+           const size_t LimbCount>
+  struct batch_kernels<std::uint64_t, LaneCount, LimbCount> : public batch_kernels_simd<std::uint64_t, LaneCount, LimbCount> { };
+  #endif
 
   } // namespace detail
 
   template<const size_t Width2,
            typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  WIDE_INTEGER_CONSTEXPR auto lcm(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
-                                  const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
-  {
-    return detail::lcm_impl(a, b);
-  }
-
-  template<typename UnsignedShortType>
-  WIDE_INTEGER_CONSTEXPR auto lcm(const UnsignedShortType& a, const UnsignedShortType& b) -> typename std::enable_if<(   (std::is_integral<UnsignedShortType>::value)
-                                                                                                                      && (std::is_unsigned<UnsignedShortType>::value)), UnsignedShortType>::type
-  {
-    return detail::lcm_impl(a, b);
-  }
-
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  class uniform_int_distribution
+           const size_t LaneCount>
+  class uintwide_batch
   {
   public:
-    using result_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    // A batch of LaneCount unsigned wide integers stored as a
+    // structure of arrays: limb i of all lanes is contiguous.
+    // The arithmetic runs lane-parallel, so that the limbs of
+    // many independent values are processed by one vector instruction.
 
-    struct param_type
-    {
-    public:
-      explicit param_type(const result_type& p_a = (std::numeric_limits<result_type>::min)(), // NOLINT(modernize-pass-by-value)
-                          const result_type& p_b = (std::numeric_limits<result_type>::max)()) // NOLINT(modernize-pass-by-value)
-        : param_a(p_a),
-          param_b(p_b) { }
+    using value_type          = uintwide_t<Width2, LimbType>;
+    using limb_type           = LimbType;
+    using representation_type = std::array<limb_type, static_cast<size_t>(value_type::number_of_limbs * LaneCount)>;
+    using compare_result_type = std::array<std::int_fast8_t, LaneCount>;
 
-      ~param_type() = default;
+    static constexpr size_t number_of_limbs = value_type::number_of_limbs;
+    static constexpr size_t lane_count      = LaneCount;
 
-      param_type(const param_type& other_params) : param_a(other_params.param_a),
-                                                   param_b(other_params.param_b) { }
+    static_assert(lane_count > static_cast<size_t>(0U),
+                  "Error: uintwide_batch needs at least one lane");
 
-      param_type(param_type&& other_params) noexcept : param_a(other_params.param_a),
-                                                       param_b(other_params.param_b) { }
+    uintwide_batch() : my_limbs() { }
 
-      auto operator=(const param_type& other_params) -> param_type&
+    template<typename InputIteratorType>
+    uintwide_batch(InputIteratorType first, InputIteratorType last)
+      : my_limbs()
+    {
+      // Load the values of [first, last) into the lanes. The lanes
+      // beyond the end of the range are set to zero, and the values
+      // beyond the last lane are ignored.
+      for(auto k = static_cast<size_t>(0U); ((k < lane_count) && (first != last)); ++k)
       {
-        if(this != &other_params)
-        {
-          param_a = other_params.param_a;
-          param_b = other_params.param_b;
-        }
-
-        return *this;
+        set(k, *first++);
       }
+    }
 
-      auto operator=(param_type&& other_params) noexcept -> param_type&
+    template<typename AllocatorType = void,
+             typename OutputIteratorType>
+    auto copy(OutputIteratorType result) const -> OutputIteratorType
+    {
+      // Store the values of all lanes to the range beginning at result.
+      for(auto k = static_cast<size_t>(0U); k < lane_count; ++k)
       {
-        param_a = other_params.param_a;
-        param_b = other_params.param_b;
-
-        return *this;
+        *result++ = get<AllocatorType>(k);
       }
 
-      constexpr auto get_a() const -> result_type { return param_a; }
-      constexpr auto get_b() const -> result_type { return param_b; }
-
-      void set_a(const result_type& p_a) { param_a = p_a; }
-      void set_b(const result_type& p_b) { param_b = p_b; }
+      return result;
+    }
 
-    private:
-      result_type param_a;
-      result_type param_b;
+    template<typename AllocatorType = void>
+    auto get(const size_t lane) const -> uintwide_t<Width2, LimbType, AllocatorType>
+    {
+      uintwide_t<Width2, LimbType, AllocatorType> x;
 
-      friend inline constexpr auto operator==(const param_type& lhs,
-                                              const param_type& rhs) -> bool
+      for(auto i = static_cast<size_t>(0U); i < number_of_limbs; ++i)
       {
-        return (   (lhs.param_a == rhs.param_a)
-                && (lhs.param_b == rhs.param_b));
+        x.representation()[i] = my_limbs[(i * lane_count) + lane];
       }
 
-      friend inline constexpr auto operator!=(const param_type& lhs,
-                                              const param_type& rhs) -> bool
+      return x;
+    }
+
+    template<typename AllocatorType>
+    auto set(const size_t lane, const uintwide_t<Width2, LimbType, AllocatorType>& x) -> void
+    {
+      for(auto i = static_cast<size_t>(0U); i < number_of_limbs; ++i)
       {
-        return (   (lhs.param_a != rhs.param_a)
-                || (lhs.param_b != rhs.param_b));
+        my_limbs[(i * lane_count) + lane] = x.crepresentation()[i];
       }
-    };
-
-    uniform_int_distribution() : my_params() { }
-
-    explicit uniform_int_distribution(const result_type& p_a,
-                                      const result_type& p_b = (std::numeric_limits<result_type>::max)())
-        : my_params(param_type(p_a, p_b)) { }
-
-    explicit uniform_int_distribution(const param_type& other_params)
-      : my_params(other_params) { }
-
-    uniform_int_distribution(const uniform_int_distribution& other_distribution) = delete;
-
-    uniform_int_distribution(uniform_int_distribution&& other) noexcept : my_params(other.my_params) { }
+    }
 
-    ~uniform_int_distribution() = default;
+    auto  representation()       ->       representation_type& { return my_limbs; }
+    auto  representation() const -> const representation_type& { return my_limbs; }
+    auto crepresentation() const -> const representation_type& { return my_limbs; }
 
-    auto operator=(const uniform_int_distribution& other) -> uniform_int_distribution&
+    auto operator+=(const uintwide_batch& other) -> uintwide_batch&
     {
-      if(this != &other)
-      {
-        my_params = other.my_params;
-      }
+      kernels_type::add(my_limbs.data(), my_limbs.data(), other.my_limbs.data(), static_cast<size_t>(0U), lane_count);
 
       return *this;
     }
 
-    auto operator=(uniform_int_distribution&& other) noexcept -> uniform_int_distribution&
+    auto operator-=(const uintwide_batch& other) -> uintwide_batch&
     {
-      my_params = other.my_params;
+      kernels_type::sub(my_limbs.data(), my_limbs.data(), other.my_limbs.data(), static_cast<size_t>(0U), lane_count);
 
       return *this;
     }
 
-    void param(const param_type& new_params)
+    auto operator*=(const uintwide_batch& other) -> uintwide_batch&
     {
-      my_params = new_params;
+      // Keep the lower Width2 bits of the products.
+      representation_type result;
+
+      kernels_type::mul_lo(result.data(), my_limbs.data(), other.my_limbs.data(), static_cast<size_t>(0U), lane_count);
+
+      my_limbs = result;
+
+      return *this;
     }
 
-    auto param() const -> const param_type& { return my_params; }
+    auto operator<<=(const unsinged_fast_type n) -> uintwide_batch&
+    {
+      kernels_type::shl(my_limbs.data(), my_limbs.data(), n, static_cast<size_t>(0U), lane_count);
 
-    auto a() const -> result_type { return my_params.get_a(); }
-    auto b() const -> result_type { return my_params.get_b(); }
+      return *this;
+    }
 
-    template<typename GeneratorType,
-             const int GeneratorResultBits = std::numeric_limits<typename GeneratorType::result_type>::digits>
-    WIDE_INTEGER_CONSTEXPR auto operator()(GeneratorType& generator) -> result_type
+    auto operator>>=(const unsinged_fast_type n) -> uintwide_batch&
     {
-      return generate<GeneratorType, GeneratorResultBits>(generator, my_params);
+      kernels_type::shr(my_limbs.data(), my_limbs.data(), n, static_cast<size_t>(0U), lane_count);
+
+      return *this;
     }
 
-    template<typename GeneratorType,
-             const int GeneratorResultBits = std::numeric_limits<typename GeneratorType::result_type>::digits>
-    WIDE_INTEGER_CONSTEXPR auto operator()(      GeneratorType& input_generator,
-                                           const param_type&    input_params) -> result_type
+    auto compare(const uintwide_batch& other) const -> compare_result_type
     {
-      return generate<GeneratorType, GeneratorResultBits>(input_generator, input_params);
+      // The result of lane k is the same as
+      // get(k).compare(other.get(k)), being -1, 0 or 1.
+      compare_result_type result;
+
+      kernels_type::compare(result.data(), my_limbs.data(), other.my_limbs.data(), static_cast<size_t>(0U), lane_count);
+
+      return result;
     }
 
   private:
-    param_type my_params;
+    using kernels_type = detail::batch_kernels<limb_type, lane_count, number_of_limbs>;
 
-    template<typename GeneratorType,
-             const int GeneratorResultBits = std::numeric_limits<typename GeneratorType::result_type>::digits>
-    WIDE_INTEGER_CONSTEXPR auto generate(      GeneratorType& input_generator,
-                                         const param_type&    input_params) const -> result_type
-    {
-      // Generate random numbers r, where a <= r <= b.
+    representation_type my_limbs;
+  };
+
+  template<const size_t Width2, typename LimbType, const size_t LaneCount>
+  auto operator+(const uintwide_batch<Width2, LimbType, LaneCount>& u, const uintwide_batch<Width2, LimbType, LaneCount>& v) -> uintwide_batch<Width2, LimbType, LaneCount> { return uintwide_batch<Width2, LimbType, LaneCount>(u) += v; }
+
+  template<const size_t Width2, typename LimbType, const size_t LaneCount>
+  auto operator-(const uintwide_batch<Width2, LimbType, LaneCount>& u, const uintwide_batch<Width2, LimbType, LaneCount>& v) -> uintwide_batch<Width2, LimbType, LaneCount> { return uintwide_batch<Width2, LimbType, LaneCount>(u) -= v; }
+
+  template<const size_t Width2, typename LimbType, const size_t LaneCount>
+  auto operator*(const uintwide_batch<Width2, LimbType, LaneCount>& u, const uintwide_batch<Width2, LimbType, LaneCount>& v) -> uintwide_batch<Width2, LimbType, LaneCount> { return uintwide_batch<Width2, LimbType, LaneCount>(u) *= v; }
+
+  template<const size_t Width2, typename LimbType, const size_t LaneCount>
+  auto operator<<(const uintwide_batch<Width2, LimbType, LaneCount>& u, const unsinged_fast_type n) -> uintwide_batch<Width2, LimbType, LaneCount> { return uintwide_batch<Width2, LimbType, LaneCount>(u) <<= n; }
+
+  template<const size_t Width2, typename LimbType, const size_t LaneCount>
+  auto operator>>(const uintwide_batch<Width2, LimbType, LaneCount>& u, const unsinged_fast_type n) -> uintwide_batch<Width2, LimbType, LaneCount> { return uintwide_batch<Width2, LimbType, LaneCount>(u) >>= n; }
+
+  template<const size_t Width2, typename LimbType, const size_t LaneCount>
+  auto operator==(const uintwide_batch<Width2, LimbType, LaneCount>& u, const uintwide_batch<Width2, LimbType, LaneCount>& v) -> bool { return (u.crepresentation() == v.crepresentation()); }
+
+  template<const size_t Width2, typename LimbType, const size_t LaneCount>
+  auto operator!=(const uintwide_batch<Width2, LimbType, LaneCount>& u, const uintwide_batch<Width2, LimbType, LaneCount>& v) -> bool { return (u.crepresentation() != v.crepresentation()); }
+
+  namespace detail {
+
+  template<typename ValueType>
+  struct parallel_limb_count
+  {
+    static constexpr auto value = static_cast<std::size_t>(1U);
+  };
+
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
+  struct parallel_limb_count<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  {
+    static constexpr auto value = static_cast<std::size_t>(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::number_of_limbs);
+  };
 
-      result_type result(std::uint8_t(0U));
+  inline auto parallel_chunk_size(const std::size_t element_count, const std::size_t element_cost, const unsigned worker_count) -> std::size_t
+  {
+    // The cost of an element is given in limb operations. Each chunk gets
+    // at least about 2^14 limb operations, so that the scheduling does not
+    // dominate for short widths. Above that there are about eight chunks
+    // per worker, which leaves enough chunks for balancing by stealing.
+    constexpr auto minimum_chunk_cost = static_cast<std::size_t>(UINT16_C(16384));
 
-      using local_limb_type = typename result_type::limb_type;
+    const auto chunks_per_pool = static_cast<std::size_t>(static_cast<std::size_t>(worker_count) * 8U);
 
-      using generator_result_type = typename GeneratorType::result_type;
+    const std::size_t size_from_cost    = (std::max)(static_cast<std::size_t>(1U), static_cast<std::size_t>(minimum_chunk_cost / (std::max)(static_cast<std::size_t>(1U), element_cost)));
+    const std::size_t size_from_balance = static_cast<std::size_t>((element_count + (chunks_per_pool - 1U)) / chunks_per_pool);
 
-      constexpr auto digits_generator_result_type = static_cast<std::uint32_t>(GeneratorResultBits);
+    return (std::max)(size_from_cost, size_from_balance);
+  }
 
-      static_assert((digits_generator_result_type % UINT32_C(8)) == UINT32_C(0),
-                    "Error: Generator result type must have a multiple of 8 bits.");
+  inline auto parallel_chunk_count(const std::size_t element_count, const std::size_t chunk_size) -> std::size_t
+  {
+    return static_cast<std::size_t>((element_count + (chunk_size - 1U)) / chunk_size);
+  }
 
-      constexpr auto digits_limb_ratio = 
-        std::uint32_t(std::numeric_limits<local_limb_type>::digits / 8U);
+  template<typename RangeFunctionType>
+  auto parallel_for_each_chunk(parallel::thread_pool& pool,
+                               const std::size_t      element_count,
+                               const std::size_t      chunk_size,
+                               RangeFunctionType&     range_function) -> void
+  {
+    // Call range_function(chunk_index, begin, end) for the consecutive
+    // chunks [begin, end) of the elements [0, element_count).
+    auto chunk_function =
+      [&range_function, element_count, chunk_size](const std::size_t chunk_index)
+      {
+        const auto begin = static_cast<std::size_t>(chunk_index * chunk_size);
 
-      constexpr auto digits_gtor_ratio = std::uint32_t(digits_generator_result_type / 8U);
+        range_function(chunk_index, begin, (std::min)(static_cast<std::size_t>(begin + chunk_size), element_count));
+      };
 
-      generator_result_type value = generator_result_type();
+    pool.run(parallel_chunk_count(element_count, chunk_size), chunk_function);
+  }
 
-      auto it = (result.representation()).begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto,-warnings-as-errors)
+  template<typename ValueType, typename BinaryOperationType>
+  auto parallel_reduce_tree(dynamic_array<ValueType>& partials, BinaryOperationType& op) -> ValueType
+  {
+    // Combine neighbouring partial results pairwise, level by level.
+    // The order of the operands is kept, so op must be associative,
+    // but it need not be commutative.
+    for(auto count = partials.size(); count > 1U; count = static_cast<std::size_t>((count + 1U) / 2U))
+    {
+      for(auto i = static_cast<std::size_t>(0U); (i * 2U) < count; ++i)
+      {
+        partials[i] = ((((i * 2U) + 1U) < count) ? op(partials[i * 2U], partials[(i * 2U) + 1U]) : partials[i * 2U]);
+      }
+    }
 
-      unsinged_fast_type j = 0U;
+    return partials.front();
+  }
 
-      while(it < result.representation().end())
-      {
-        if((j % digits_gtor_ratio) == 0U)
-        {
-          value = input_generator();
-        }
+  template<typename RandomAccessInputIteratorType1,
+           typename RandomAccessInputIteratorType2,
+           typename ValueType,
+           typename ReduceOperationType,
+           typename ElementFunctionType>
+  auto parallel_reduce(parallel::thread_pool&         pool,
+                       RandomAccessInputIteratorType1 first1,
+                       RandomAccessInputIteratorType1 last1,
+                       RandomAccessInputIteratorType2 first2,
+                       ValueType                      init,
+                       ReduceOperationType&           reduce_op,
+                       ElementFunctionType&           element_function,
+                       const std::size_t              element_cost) -> ValueType
+  {
+    // Reduce the values element_function(first1[i], first2[i]) with
+    // reduce_op, starting from init. Each chunk is reduced from left
+    // to right and the partial results of the chunks are then combined
+    // in a tree.
+    using local_difference_type1 = typename std::iterator_traits<RandomAccessInputIteratorType1>::difference_type;
+    using local_difference_type2 = typename std::iterator_traits<RandomAccessInputIteratorType2>::difference_type;
 
-        const auto next_byte = std::uint8_t(value >> unsigned(unsinged_fast_type(j % digits_gtor_ratio) * unsinged_fast_type(UINT8_C(8))));
+    const auto count = static_cast<std::size_t>(std::distance(first1, last1));
 
-        *it =
-          static_cast<typename result_type::limb_type>
-          (
-            *it | local_limb_type(local_limb_type(next_byte) << unsigned(unsinged_fast_type(j % digits_limb_ratio) * unsinged_fast_type(UINT8_C(8))))
-          );
+    if(count == 0U)
+    {
+      return init;
+    }
 
-        ++j;
+    const std::size_t chunk_size = parallel_chunk_size(count, element_cost, pool.size());
 
-        if((j % digits_limb_ratio) == 0U)
+    dynamic_array<ValueType> partials(parallel_chunk_count(count, chunk_size));
+
+    auto range_function =
+      [&](const std::size_t chunk_index, const std::size_t begin, const std::size_t end)
+      {
+        ValueType partial(element_function(first1[static_cast<local_difference_type1>(begin)], first2[static_cast<local_difference_type2>(begin)]));
+
+        for(auto i = static_cast<std::size_t>(begin + 1U); i < end; ++i)
         {
-          ++it;
+          partial = reduce_op(partial, element_function(first1[static_cast<local_difference_type1>(i)], first2[static_cast<local_difference_type2>(i)]));
         }
-      }
 
-      if(   (input_params.get_a() != (std::numeric_limits<result_type>::min)())
-         || (input_params.get_b() != (std::numeric_limits<result_type>::max)()))
-      {
-        // Note that this restricts the range r to:
-        //   r = {[input_generator() % ((b - a) + 1)] + a}
+        partials[chunk_index] = partial;
+      };
 
-        result_type range(input_params.get_b() - input_params.get_a());
+    parallel_for_each_chunk(pool, count, chunk_size, range_function);
 
-        ++range;
+    return reduce_op(init, parallel_reduce_tree(partials, reduce_op));
+  }
 
-        result %= range;
-        result += input_params.get_a();
-      }
+  template<typename ValueType>
+  class parallel_powm_context
+  {
+  public:
+    // In general, powm is called for each of the elements.
+    explicit parallel_powm_context(const ValueType& m) : my_m(m) { }
 
-      return result;
-    }
+    template<typename OtherIntegralTypeP>
+    auto pow(const ValueType& b, const OtherIntegralTypeP& p) const -> ValueType { return powm(b, p, my_m); }
+
+  private:
+    const ValueType& my_m;
   };
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto operator==(const uniform_int_distribution<Width2, LimbType, AllocatorType, IsSigned>& lhs,
-                            const uniform_int_distribution<Width2, LimbType, AllocatorType, IsSigned>& rhs) -> bool
+  template<const size_t Width2, typename LimbType, typename AllocatorType>
+  class parallel_powm_context<uintwide_t<Width2, LimbType, AllocatorType, false>>
   {
-    return (lhs.param() == rhs.param());
-  }
+  public:
+    using value_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto operator!=(const uniform_int_distribution<Width2, LimbType, AllocatorType, IsSigned>& lhs,
-                            const uniform_int_distribution<Width2, LimbType, AllocatorType, IsSigned>& rhs) -> bool
-  {
-    return (lhs.param() != rhs.param());
-  }
+    // For an odd unsigned modulus, the Montgomery context is set
+    // up once and then shared by all of the elements.
+    explicit parallel_powm_context(const value_type& m)
+      : my_m            (m),
+        my_is_montgomery((static_cast<LimbType>(m) & 1U) != 0U),
+        my_ctx          (my_is_montgomery ? m : value_type(std::uint8_t(1U))) { }
 
-  template<typename DistributionType,
-           typename GeneratorType,
-           const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  auto miller_rabin(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& n, // NOLINT(readability-function-cognitive-complexity)
-                    const unsinged_fast_type                                     number_of_trials,
-                    DistributionType&                                            distribution,
-                    GeneratorType&                                               generator) -> bool
-  {
-    // This Miller-Rabin primality test is loosely based on
-    // an adaptation of some code from Boost.Multiprecision.
-    // The Boost.Multiprecision code can be found here:
-    // https://www.boost.org/doc/libs/1_76_0/libs/multiprecision/doc/html/boost_multiprecision/tut/primetest.html
+    template<typename OtherIntegralTypeP>
+    auto pow(const value_type& b, const OtherIntegralTypeP& p) const -> value_type
+    {
+      // The small exponents are left to the special cases of powm.
+      return ((my_is_montgomery && (p > OtherIntegralTypeP(2))) ? my_ctx.pow(b, p) : powm(b, p, my_m));
+    }
 
-    // Note: Some comments in this subroutine use the Wolfram Language(TM).
-    // These can be exercised at the web links to WolframAlpha(R) provided
+  private:
+    const value_type&                                         my_m;
+    const bool                                                my_is_montgomery;
+    const montgomery_context<Width2, LimbType, AllocatorType> my_ctx;
+  };
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_limb_type         = typename local_wide_integer_type::limb_type;
+  } // namespace detail
 
-    const local_wide_integer_type np((local_wide_integer_type::is_neg(n) == false) ? n : -n);
+  namespace parallel {
 
-    {
-      const local_limb_type n0(np);
+  template<typename RandomAccessInputIteratorType,
+           typename RandomAccessOutputIteratorType,
+           typename UnaryOperationType>
+  auto transform(thread_pool&                   pool,
+                 RandomAccessInputIteratorType  first,
+                 RandomAccessInputIteratorType  last,
+                 RandomAccessOutputIteratorType result,
+                 UnaryOperationType             op) -> RandomAccessOutputIteratorType
+  {
+    // Store op(first[i]) in result[i]. The cost of op
+    // is taken to be that of a multiplication.
+    using local_value_type       = typename std::iterator_traits<RandomAccessInputIteratorType>::value_type;
+    using local_difference_type  = typename std::iterator_traits<RandomAccessInputIteratorType>::difference_type;
+    using result_difference_type = typename std::iterator_traits<RandomAccessOutputIteratorType>::difference_type;
 
-      if((n0 & 1U) == 0U)
-      {
-        // Not prime because n is even.
-        return false;
-      }
+    constexpr auto limb_count = detail::parallel_limb_count<local_value_type>::value;
 
-      if((n0 <= local_limb_type(UINT8_C(227))) && (np <= local_limb_type(UINT8_C(227))))
+    const auto count = static_cast<std::size_t>(std::distance(first, last));
+
+    auto range_function =
+      [&](const std::size_t, const std::size_t begin, const std::size_t end)
       {
-        if((n0 == local_limb_type(UINT8_C(2))) && (np == local_limb_type(UINT8_C(2))))
+        for(auto i = begin; i < end; ++i)
         {
-          // Trivial special case of (n = 2).
-          return true;
+          result[static_cast<result_difference_type>(i)] = op(first[static_cast<local_difference_type>(i)]);
         }
+      };
 
-        // Exclude pure small primes from 3...227.
-        // Table[Prime[i], {i, 2, 49}] =
-        // {
-        //     3,   5,   7,  11,  13,  17,  19,  23,
-        //    29,  31,  37,  41,  43,  47,  53,  59,
-        //    61,  67,  71,  73,  79,  83,  89,  97,
-        //   101, 103, 107, 109, 113, 127, 131, 137,
-        //   139, 149, 151, 157, 163, 167, 173, 179,
-        //   181, 191, 193, 197, 199, 211, 223, 227
-        // }
-        // See also:
-        // https://www.wolframalpha.com/input/?i=Table%5BPrime%5Bi%5D%2C+%7Bi%2C+2%2C+49%7D%5D
-
-        constexpr std::array<local_limb_type, 48U> small_primes = 
-        {{
-          UINT8_C(  3), UINT8_C(  5), UINT8_C(  7), UINT8_C( 11), UINT8_C( 13), UINT8_C( 17), UINT8_C( 19), UINT8_C( 23),
-          UINT8_C( 29), UINT8_C( 31), UINT8_C( 37), UINT8_C( 41), UINT8_C( 43), UINT8_C( 47), UINT8_C( 53), UINT8_C( 59),
-          UINT8_C( 61), UINT8_C( 67), UINT8_C( 71), UINT8_C( 73), UINT8_C( 79), UINT8_C( 83), UINT8_C( 89), UINT8_C( 97),
-          UINT8_C(101), UINT8_C(103), UINT8_C(107), UINT8_C(109), UINT8_C(113), UINT8_C(127), UINT8_C(131), UINT8_C(137),
-          UINT8_C(139), UINT8_C(149), UINT8_C(151), UINT8_C(157), UINT8_C(163), UINT8_C(167), UINT8_C(173), UINT8_C(179),
-          UINT8_C(181), UINT8_C(191), UINT8_C(193), UINT8_C(197), UINT8_C(199), UINT8_C(211), UINT8_C(223), UINT8_C(227)
-        }};
+    detail::parallel_for_each_chunk(pool, count, detail::parallel_chunk_size(count, limb_count * limb_count, pool.size()), range_function);
 
-        return std::binary_search(small_primes.cbegin(),
-                                  small_primes.cend(),
-                                  n0);
-      }
-    }
+    return result + static_cast<result_difference_type>(count);
+  }
 
-    // Check small factors.
+  template<typename RandomAccessInputIteratorType1,
+           typename RandomAccessInputIteratorType2,
+           typename RandomAccessOutputIteratorType,
+           typename BinaryOperationType>
+  auto transform(thread_pool&                   pool,
+                 RandomAccessInputIteratorType1 first1,
+                 RandomAccessInputIteratorType1 last1,
+                 RandomAccessInputIteratorType2 first2,
+                 RandomAccessOutputIteratorType result,
+                 BinaryOperationType            op) -> RandomAccessOutputIteratorType
+  {
+    // Store op(first1[i], first2[i]) in result[i].
+    using local_value_type       = typename std::iterator_traits<RandomAccessInputIteratorType1>::value_type;
+    using local_difference_type1 = typename std::iterator_traits<RandomAccessInputIteratorType1>::difference_type;
+    using local_difference_type2 = typename std::iterator_traits<RandomAccessInputIteratorType2>::difference_type;
+    using result_difference_type = typename std::iterator_traits<RandomAccessOutputIteratorType>::difference_type;
 
-    // Exclude small prime factors from { 3 ...  53 }.
-    // Product[Prime[i], {i, 2, 16}] = 16294579238595022365
-    // See also: https://www.wolframalpha.com/input/?i=Product%5BPrime%5Bi%5D%2C+%7Bi%2C+2%2C+16%7D%5D
-    {
-      constexpr std::uint64_t pp0 = UINT64_C(16294579238595022365);
+    constexpr auto limb_count = detail::parallel_limb_count<local_value_type>::value;
 
-      const std::uint64_t m0(np % pp0);
+    const auto count = static_cast<std::size_t>(std::distance(first1, last1));
 
-      if(detail::integer_gcd_reduce_large(m0, pp0) != 1U)
+    auto range_function =
+      [&](const std::size_t, const std::size_t begin, const std::size_t end)
       {
-        return false;
-      }
-    }
+        for(auto i = begin; i < end; ++i)
+        {
+          result[static_cast<result_difference_type>(i)] = op(first1[static_cast<local_difference_type1>(i)], first2[static_cast<local_difference_type2>(i)]);
+        }
+      };
 
-    // Exclude small prime factors from { 59 ... 101 }.
-    // Product[Prime[i], {i, 17, 26}] = 7145393598349078859
-    // See also: https://www.wolframalpha.com/input/?i=Product%5BPrime%5Bi%5D%2C+%7Bi%2C+17%2C+26%7D%5D
-    {
-      constexpr std::uint64_t pp1 = UINT64_C(7145393598349078859);
+    detail::parallel_for_each_chunk(pool, count, detail::parallel_chunk_size(count, limb_count * limb_count, pool.size()), range_function);
 
-      const std::uint64_t m1(np % pp1);
+    return result + static_cast<result_difference_type>(count);
+  }
 
-      if(detail::integer_gcd_reduce_large(m1, pp1) != 1U)
-      {
-        return false;
-      }
-    }
+  template<typename RandomAccessInputIteratorType,
+           typename ValueType>
+  auto accumulate(thread_pool&                  pool,
+                  RandomAccessInputIteratorType first,
+                  RandomAccessInputIteratorType last,
+                  ValueType                     init) -> ValueType
+  {
+    // Calculate the sum of init and the elements of [first, last).
+    using local_value_type = typename std::iterator_traits<RandomAccessInputIteratorType>::value_type;
 
-    // Exclude small prime factors from { 103 ... 149 }.
-    // Product[Prime[i], {i, 27, 35}] = 6408001374760705163
-    // See also: https://www.wolframalpha.com/input/?i=Product%5BPrime%5Bi%5D%2C+%7Bi%2C+27%2C+35%7D%5D
-    {
-      constexpr std::uint64_t pp2 = UINT64_C(6408001374760705163);
+    auto sum_op   = [](const ValueType& a, const ValueType& b) -> ValueType { return a + b; };
+    auto identity = [](const local_value_type& a, const local_value_type&) -> const local_value_type& { return a; };
 
-      const std::uint64_t m2(np % pp2);
+    return detail::parallel_reduce(pool, first, last, first, init, sum_op, identity, detail::parallel_limb_count<local_value_type>::value);
+  }
 
-      if(detail::integer_gcd_reduce_large(m2, pp2) != 1U)
-      {
-        return false;
-      }
-    }
+  template<typename RandomAccessInputIteratorType,
+           typename ValueType,
+           typename BinaryOperationType>
+  auto accumulate(thread_pool&                  pool,
+                  RandomAccessInputIteratorType first,
+                  RandomAccessInputIteratorType last,
+                  ValueType                     init,
+                  BinaryOperationType           op) -> ValueType
+  {
+    // Reduce init and the elements of [first, last) with op, which
+    // must be associative, for instance the product with std::multiplies.
+    // The partial results of the chunks are combined in a tree. The cost
+    // of op is taken to be that of a multiplication.
+    using local_value_type = typename std::iterator_traits<RandomAccessInputIteratorType>::value_type;
 
-    // Exclude small prime factors from { 151 ... 191 }.
-    // Product[Prime[i], {i, 36, 43}] = 690862709424854779
-    // See also: https://www.wolframalpha.com/input/?i=Product%5BPrime%5Bi%5D%2C+%7Bi%2C+36%2C+43%7D%5D
-    {
-      constexpr std::uint64_t pp3 = UINT64_C(690862709424854779);
+    constexpr auto limb_count = detail::parallel_limb_count<local_value_type>::value;
 
-      const std::uint64_t m3(np % pp3);
+    auto identity = [](const local_value_type& a, const local_value_type&) -> const local_value_type& { return a; };
 
-      if(detail::integer_gcd_reduce_large(m3, pp3) != 1U)
-      {
-        return false;
-      }
-    }
+    return detail::parallel_reduce(pool, first, last, first, init, op, identity, limb_count * limb_count);
+  }
 
-    // Exclude small prime factors from { 193 ... 227 }.
-    // Product[Prime[i], {i, 44, 49}] = 80814592450549
-    // See also: https://www.wolframalpha.com/input/?i=Product%5BPrime%5Bi%5D%2C+%7Bi%2C+44%2C+49%7D%5D
-    {
-      constexpr std::uint64_t pp4 = UINT64_C(80814592450549);
+  template<typename RandomAccessInputIteratorType1,
+           typename RandomAccessInputIteratorType2,
+           typename ValueType>
+  auto inner_product(thread_pool&                   pool,
+                     RandomAccessInputIteratorType1 first1,
+                     RandomAccessInputIteratorType1 last1,
+                     RandomAccessInputIteratorType2 first2,
+                     ValueType                      init) -> ValueType
+  {
+    // Calculate the sum of init and the products first1[i] * first2[i].
+    using local_value_type1 = typename std::iterator_traits<RandomAccessInputIteratorType1>::value_type;
+    using local_value_type2 = typename std::iterator_traits<RandomAccessInputIteratorType2>::value_type;
 
-      const std::uint64_t m4(np % pp4);
+    constexpr auto limb_count = detail::parallel_limb_count<local_value_type1>::value;
 
-      if(detail::integer_gcd_reduce_large(m4, pp4) != 1U)
-      {
-        return false;
-      }
-    }
+    auto sum_op     = [](const ValueType& a, const ValueType& b) -> ValueType { return a + b; };
+    auto product_op = [](const local_value_type1& a, const local_value_type2& b) -> ValueType { return a * b; };
 
-    const local_wide_integer_type nm1(np - 1U);
+    return detail::parallel_reduce(pool, first1, last1, first2, init, sum_op, product_op, limb_count * limb_count);
+  }
 
-    // Since we have already excluded all small factors
-    // up to and including 227, n is greater than 227.
+  template<typename RandomAccessInputIteratorType1,
+           typename RandomAccessInputIteratorType2,
+           typename ValueType,
+           typename BinaryOperationType1,
+           typename BinaryOperationType2>
+  auto inner_product(thread_pool&                   pool,
+                     RandomAccessInputIteratorType1 first1,
+                     RandomAccessInputIteratorType1 last1,
+                     RandomAccessInputIteratorType2 first2,
+                     ValueType                      init,
+                     BinaryOperationType1           op1,
+                     BinaryOperationType2           op2) -> ValueType
+  {
+    // Reduce init and the values op2(first1[i], first2[i]) with op1,
+    // which must be associative.
+    using local_value_type1 = typename std::iterator_traits<RandomAccessInputIteratorType1>::value_type;
 
-    {
-      // Perform a single Fermat test which will
-      // exclude many non-prime candidates.
+    constexpr auto limb_count = detail::parallel_limb_count<local_value_type1>::value;
 
-      const local_wide_integer_type fn = powm(local_wide_integer_type(local_limb_type(228U)), nm1, np);
+    return detail::parallel_reduce(pool, first1, last1, first2, init, op1, op2, limb_count * limb_count);
+  }
 
-      const auto fn0 = static_cast<local_limb_type>(fn);
+  template<typename RandomAccessInputIteratorType,
+           typename RandomAccessOutputIteratorType,
+           typename OtherIntegralTypeP>
+  auto powm_each(thread_pool&                                                                  pool,
+                 RandomAccessInputIteratorType                                                 first,
+                 RandomAccessInputIteratorType                                                 last,
+                 RandomAccessOutputIteratorType                                                result,
+                 const OtherIntegralTypeP&                                                     p,
+                 const typename std::iterator_traits<RandomAccessInputIteratorType>::value_type& m) -> RandomAccessOutputIteratorType
+  {
+    // Store powm(first[i], p, m) in result[i]. For an odd unsigned
+    // modulus, the Montgomery context is set up only once.
+    using local_value_type       = typename std::iterator_traits<RandomAccessInputIteratorType>::value_type;
+    using local_difference_type  = typename std::iterator_traits<RandomAccessInputIteratorType>::difference_type;
+    using result_difference_type = typename std::iterator_traits<RandomAccessOutputIteratorType>::difference_type;
 
-      if((fn0 != 1U) && (fn != 1U))
-      {
-        return false;
-      }
-    }
+    constexpr auto limb_count = detail::parallel_limb_count<local_value_type>::value;
 
-    const unsinged_fast_type k = lsb(nm1);
+    const detail::parallel_powm_context<local_value_type> ctx(m);
 
-    const local_wide_integer_type q = nm1 >> k;
+    const auto count = static_cast<std::size_t>(std::distance(first, last));
 
-    using local_param_type = typename DistributionType::param_type;
+    auto range_function =
+      [&](const std::size_t, const std::size_t begin, const std::size_t end)
+      {
+        for(auto i = begin; i < end; ++i)
+        {
+          result[static_cast<result_difference_type>(i)] = ctx.pow(first[static_cast<local_difference_type>(i)], p);
+        }
+      };
 
-    const local_param_type params(local_wide_integer_type(2U), np - 2U);
+    const auto element_cost = static_cast<std::size_t>((limb_count * limb_count) * static_cast<std::size_t>(std::numeric_limits<local_value_type>::digits));
 
-    bool is_probably_prime = true;
+    detail::parallel_for_each_chunk(pool, count, detail::parallel_chunk_size(count, element_cost, pool.size()), range_function);
 
-    unsinged_fast_type i = 0U;
+    return result + static_cast<result_difference_type>(count);
+  }
 
-    local_wide_integer_type x;
-    local_wide_integer_type y;
+  // The following overloads use the default pool.
 
-    // Execute the random trials.
-    do
-    {
-      x = distribution(generator, params);
-      y = powm(x, q, np);
+  template<typename RandomAccessInputIteratorType, typename RandomAccessOutputIteratorType, typename UnaryOperationType>
+  auto transform(RandomAccessInputIteratorType first, RandomAccessInputIteratorType last, RandomAccessOutputIteratorType result, UnaryOperationType op) -> RandomAccessOutputIteratorType
+  {
+    return parallel::transform(thread_pool::default_pool(), first, last, result, op);
+  }
 
-      unsinged_fast_type j = 0U;
+  template<typename RandomAccessInputIteratorType1, typename RandomAccessInputIteratorType2, typename RandomAccessOutputIteratorType, typename BinaryOperationType>
+  auto transform(RandomAccessInputIteratorType1 first1, RandomAccessInputIteratorType1 last1, RandomAccessInputIteratorType2 first2, RandomAccessOutputIteratorType result, BinaryOperationType op) -> RandomAccessOutputIteratorType
+  {
+    return parallel::transform(thread_pool::default_pool(), first1, last1, first2, result, op);
+  }
 
-      while(y != nm1)
-      {
-        const local_limb_type y0(y);
+  template<typename RandomAccessInputIteratorType, typename ValueType>
+  auto accumulate(RandomAccessInputIteratorType first, RandomAccessInputIteratorType last, ValueType init) -> ValueType
+  {
+    return parallel::accumulate(thread_pool::default_pool(), first, last, init);
+  }
 
-        if((y0 == 1U) && (y == 1U))
-        {
-          if(j != 0U)
-          {
-            is_probably_prime = false;
-          }
-          else
-          {
-            break;
-          }
-        }
-        else
-        {
-          ++j;
+  template<typename RandomAccessInputIteratorType, typename ValueType, typename BinaryOperationType>
+  auto accumulate(RandomAccessInputIteratorType first, RandomAccessInputIteratorType last, ValueType init, BinaryOperationType op) -> ValueType
+  {
+    return parallel::accumulate(thread_pool::default_pool(), first, last, init, op);
+  }
 
-          if(j == k)
-          {
-            is_probably_prime = false;
-          }
-          else
-          {
-            y = powm(y, 2U, np);
-          }
-        }
-      }
+  template<typename RandomAccessInputIteratorType1, typename RandomAccessInputIteratorType2, typename ValueType>
+  auto inner_product(RandomAccessInputIteratorType1 first1, RandomAccessInputIteratorType1 last1, RandomAccessInputIteratorType2 first2, ValueType init) -> ValueType
+  {
+    return parallel::inner_product(thread_pool::default_pool(), first1, last1, first2, init);
+  }
 
-      ++i;
-    }
-    while((i < number_of_trials) && is_probably_prime);
+  template<typename RandomAccessInputIteratorType1, typename RandomAccessInputIteratorType2, typename ValueType, typename BinaryOperationType1, typename BinaryOperationType2>
+  auto inner_product(RandomAccessInputIteratorType1 first1, RandomAccessInputIteratorType1 last1, RandomAccessInputIteratorType2 first2, ValueType init, BinaryOperationType1 op1, BinaryOperationType2 op2) -> ValueType
+  {
+    return parallel::inner_product(thread_pool::default_pool(), first1, last1, first2, init, op1, op2);
+  }
 
-    // The prime candidate is probably prime in the sense
-    // of the very high probability resulting from Miller-Rabin.
-    return is_probably_prime;
+  template<typename RandomAccessInputIteratorType, typename RandomAccessOutputIteratorType, typename OtherIntegralTypeP>
+  auto powm_each(RandomAccessInputIteratorType first, RandomAccessInputIteratorType last, RandomAccessOutputIteratorType result, const OtherIntegralTypeP& p, const typename std::iterator_traits<RandomAccessInputIteratorType>::value_type& m) -> RandomAccessOutputIteratorType
+  {
+    return parallel::powm_each(thread_pool::default_pool(), first, last, result, p, m);
   }
 
+  } // namespace parallel
+
   } // namespace wide_integer
   } // namespace math
   WIDE_INTEGER_NAMESPACE_END
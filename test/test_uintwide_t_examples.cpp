@@ -33,6 +33,14 @@ auto math::wide_integer::test_uintwide_t_examples() -> bool
   result_is_ok &= math::wide_integer::example009_timed_mul          (); std::cout << "result_is_ok after example009_timed_mul          : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok &= math::wide_integer::example009a_timed_mul_4_by_4  (); std::cout << "result_is_ok after example009a_timed_mul_4_by_4  : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok &= math::wide_integer::example009b_timed_mul_8_by_8  (); std::cout << "result_is_ok after example009b_timed_mul_8_by_8  : " << std::boolalpha << result_is_ok << std::endl;
+  result_is_ok &= math::wide_integer::example009c_timed_mul_tiers   (); std::cout << "result_is_ok after example009c_timed_mul_tiers   : " << std::boolalpha << result_is_ok << std::endl;
+  result_is_ok &= math::wide_integer::example009d_mul_thresholds    (); std::cout << "result_is_ok after example009d_mul_thresholds    : " << std::boolalpha << result_is_ok << std::endl;
+  result_is_ok &= math::wide_integer::example009e_timed_limb_ops    (); std::cout << "result_is_ok after example009e_timed_limb_ops    : " << std::boolalpha << result_is_ok << std::endl;
+  #if defined(WIDE_INTEGER_TEST_DUDECT_CONST_TIME)
+  // The timing-leak statistics depend on the load of the host,
+  // so this example is opt-in and not part of the default test run.
+  result_is_ok &= math::wide_integer::example009f_dudect_const_time (); std::cout << "result_is_ok after example009f_dudect_const_time : " << std::boolalpha << result_is_ok << std::endl;
+  #endif
   result_is_ok &= math::wide_integer::example010_uint48_t           (); std::cout << "result_is_ok after example010_uint48_t           : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok &= math::wide_integer::example011_uint24_t           (); std::cout << "result_is_ok after example011_uint24_t           : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok &= math::wide_integer::example012_rsa_crypto         (); std::cout << "result_is_ok after example012_rsa_crypto         : " << std::boolalpha << result_is_ok << std::endl;
@@ -0,0 +1,155 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2019 - 2022.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef TEST_UINTWIDE_T_N_BINARY_OPS_MUL_TIERS_TEMPLATE_2022_06_18_H
+  #define TEST_UINTWIDE_T_N_BINARY_OPS_MUL_TIERS_TEMPLATE_2022_06_18_H
+
+  #include <atomic>
+  #include <cstddef>
+  #include <limits>
+  #include <string>
+  #include <vector>
+
+  #include <test/test_uintwide_t_n_binary_ops_base.h>
+
+  // Multiplication compared with Boost at a width whose number of limbs
+  // selects one of the schoolbook, Karatsuba, Toom-3 or NTT tiers.
+  // Besides random operands, this covers squaring (self-multiplication),
+  // operands of unequal length (having leading zero limbs)
+  // and operands having all bits set.
+
+  template<const math::wide_integer::size_t MyDigits2,
+           typename MyLimbType = std::uint32_t,
+           typename AllocatorType = void>
+  class test_uintwide_t_n_binary_ops_mul_tiers_template : public test_uintwide_t_n_binary_ops_base // NOLINT(cppcoreguidelines-special-member-functions,hicpp-special-member-functions)
+  {
+  private:
+    static constexpr math::wide_integer::size_t digits2 = MyDigits2;
+
+    using boost_uint_backend_type =
+      boost::multiprecision::cpp_int_backend<digits2,
+                                             digits2,
+                                             boost::multiprecision::unsigned_magnitude>;
+
+    using boost_uint_type = boost::multiprecision::number<boost_uint_backend_type, boost::multiprecision::et_off>;
+
+    using local_limb_type = MyLimbType;
+
+    using local_uint_type = math::wide_integer::uintwide_t<digits2, local_limb_type, AllocatorType>;
+
+  public:
+    explicit test_uintwide_t_n_binary_ops_mul_tiers_template(const std::size_t count)
+      : test_uintwide_t_n_binary_ops_base(count),
+        a_local(),
+        b_local(),
+        a_boost(),
+        b_boost() { }
+
+    ~test_uintwide_t_n_binary_ops_mul_tiers_template() override = default;
+
+    auto get_digits2() const -> math::wide_integer::size_t override { return digits2; }
+
+    auto do_test(const std::size_t rounds) -> bool override
+    {
+      bool result_is_ok = true;
+
+      for(std::size_t i = 0U; i < rounds; ++i)
+      {
+        std::cout << "initialize()       boost compare with uintwide_t: round " << i << ",  digits2: " << this->get_digits2() << std::endl;
+        this->initialize();
+
+        std::cout << "test_binary_mul()  boost compare with uintwide_t: round " << i << ",  digits2: " << this->get_digits2() << std::endl;
+        result_is_ok &= this->test_binary_mul();
+      }
+
+      return result_is_ok;
+    }
+
+    void initialize() override
+    {
+      a_local.clear();
+      b_local.clear();
+
+      a_boost.clear();
+      b_boost.clear();
+
+      a_local.resize(size());
+      b_local.resize(size());
+
+      a_boost.resize(size());
+      b_boost.resize(size());
+
+      get_equal_random_test_values_boost_and_local_n<local_uint_type, boost_uint_type, AllocatorType>(a_local.data(), a_boost.data(), size());
+      get_equal_random_test_values_boost_and_local_n<local_uint_type, boost_uint_type, AllocatorType>(b_local.data(), b_boost.data(), size());
+    }
+
+    auto test_binary_mul() const -> bool override
+    {
+      bool result_is_ok = true;
+
+      std::atomic_flag test_lock = ATOMIC_FLAG_INIT;
+
+      const local_uint_type max_local = (std::numeric_limits<local_uint_type>::max)();
+      const boost_uint_type max_boost = (std::numeric_limits<boost_uint_type>::max)();
+
+      const std::string str_max_sqr_boost = hexlexical_cast(boost_uint_type(max_boost * max_boost));
+
+      my_concurrency::parallel_for
+      (
+        std::size_t(0U),
+        size(),
+        [&test_lock, &result_is_ok, &max_local, &max_boost, &str_max_sqr_boost, this](std::size_t i)
+        {
+          // The shortened operand has between one limb
+          // and all but one limb of the full width.
+          const auto shift =
+            static_cast<unsigned>
+            (
+              static_cast<unsigned>(std::numeric_limits<local_limb_type>::digits) * static_cast<unsigned>(1U + (i % static_cast<std::size_t>(local_uint_type::number_of_limbs - 1U)))
+            );
+
+          const local_uint_type b_short_local = b_local[i] >> shift;
+          const boost_uint_type b_short_boost = b_boost[i] >> shift;
+
+          local_uint_type a_sqr_local(a_local[i]);
+
+          a_sqr_local *= a_sqr_local;
+
+          local_uint_type max_sqr_local(max_local);
+
+          max_sqr_local *= max_sqr_local;
+
+          const std::string str_short_boost = hexlexical_cast(boost_uint_type(a_boost[i] * b_short_boost));
+
+          bool case_is_ok = true;
+
+          case_is_ok &= (hexlexical_cast(a_local[i] * b_local[i])    == hexlexical_cast(boost_uint_type(a_boost[i] * b_boost[i])));
+          case_is_ok &= (hexlexical_cast(a_sqr_local)                == hexlexical_cast(boost_uint_type(a_boost[i] * a_boost[i])));
+          case_is_ok &= (hexlexical_cast(a_local[i] * b_short_local) == str_short_boost);
+          case_is_ok &= (hexlexical_cast(b_short_local * a_local[i]) == str_short_boost);
+          case_is_ok &= (hexlexical_cast(max_local * b_local[i])     == hexlexical_cast(boost_uint_type(max_boost * b_boost[i])));
+          case_is_ok &= (hexlexical_cast(max_local * max_local)      == str_max_sqr_boost);
+          case_is_ok &= (hexlexical_cast(max_sqr_local)              == str_max_sqr_boost);
+
+          while(test_lock.test_and_set()) { ; }
+          result_is_ok &= case_is_ok;
+          test_lock.clear();
+        }
+      );
+
+      return result_is_ok;
+    }
+
+  private:
+    std::vector<local_uint_type> a_local;
+    std::vector<local_uint_type> b_local;
+
+    std::vector<boost_uint_type> a_boost;
+    std::vector<boost_uint_type> b_boost;
+  };
+
+#endif // TEST_UINTWIDE_T_N_BINARY_OPS_MUL_TIERS_TEMPLATE_2022_06_18_H
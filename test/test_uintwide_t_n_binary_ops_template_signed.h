@@ -11,6 +11,7 @@
   #include <algorithm>
   #include <atomic>
   #include <cstddef>
+  #include <limits>
   #include <random>
   #include <vector>
 
@@ -82,6 +83,20 @@
       get_equal_random_test_values_boost_and_local_n<local_uint_type, boost_uint_type, AllocatorType>(a_local.data(), a_boost.data(), size());
       get_equal_random_test_values_boost_and_local_n<local_uint_type, boost_uint_type, AllocatorType>(b_local.data(), b_boost.data(), size());
 
+      // The signed operands are non-negative, since the boost
+      // signed-magnitude type does not reinterpret the sign bit.
+      const local_uint_type mask_local = (std::numeric_limits<local_uint_type>::max)() >> 1U;
+      const boost_uint_type mask_boost = (std::numeric_limits<boost_uint_type>::max)() >> 1U;
+
+      for(auto i = static_cast<std::size_t>(0U); i < size(); ++i)
+      {
+        a_local[i] &= mask_local;
+        b_local[i] &= mask_local;
+
+        a_boost[i] &= mask_boost;
+        b_boost[i] &= mask_boost;
+      }
+
       std::copy(a_local.cbegin(), a_local.cend(), a_local_signed.begin());
       std::copy(b_local.cbegin(), b_local.cend(), b_local_signed.begin());
 
@@ -5,8 +5,21 @@
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
 #include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include <math/wide_integer/uintwide_t.h>
 #include <test/test_uintwide_t.h>
@@ -68,6 +81,109 @@ namespace local
 
     return b_ok;
   }
+
+  auto counting_allocator_count() -> std::size_t&
+  {
+    static std::size_t count { };
+
+    return count;
+  }
+
+  template<typename T>
+  class counting_allocator : public std::allocator<T>
+  {
+  public:
+    template<typename U>
+    struct rebind
+    {
+      using other = counting_allocator<U>;
+    };
+
+    counting_allocator() = default;
+
+    template<typename U>
+    counting_allocator(const counting_allocator<U>&) noexcept { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    auto allocate(const std::size_t n) -> T*
+    {
+      ++counting_allocator_count();
+
+      return std::allocator<T>::allocate(n);
+    }
+  };
+
+  template<const math::wide_integer::size_t Width2,
+           typename LimbType,
+           const math::wide_integer::size_t LaneCount>
+  auto test_uintwide_batch() -> bool
+  {
+    using local_uint_type  = math::wide_integer::uintwide_t<Width2, LimbType>;
+    using local_batch_type = math::wide_integer::uintwide_batch<Width2, LimbType, LaneCount>;
+
+    std::mt19937_64 generator; // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    math::wide_integer::uniform_int_distribution<Width2, LimbType> distribution;
+
+    std::vector<local_uint_type> u(local_batch_type::lane_count);
+    std::vector<local_uint_type> v(local_batch_type::lane_count);
+
+    distribution.generate_n(u.begin(), u.end(), generator);
+    distribution.generate_n(v.begin(), v.end(), generator);
+
+    // Some lanes have equal values, carries and borrows through all limbs.
+    // With a single lane, the carry through all limbs is in lane 0.
+    const auto lane_eq = static_cast<std::size_t>(1U % local_batch_type::lane_count);
+    const auto lane_cy = static_cast<std::size_t>(2U % local_batch_type::lane_count);
+    const auto lane_bw = static_cast<std::size_t>(3U % local_batch_type::lane_count);
+
+    v[lane_eq] = u[lane_eq];
+    u[lane_bw] = 0U;
+    v[lane_bw] = u[lane_bw] + 1U;
+    u[lane_cy] = (std::numeric_limits<local_uint_type>::max)();
+    v[lane_cy] = 1U;
+
+    const local_batch_type bu(u.cbegin(), u.cend());
+    const local_batch_type bv(v.cbegin(), v.cend());
+
+    std::vector<local_uint_type> sum (local_batch_type::lane_count);
+    std::vector<local_uint_type> diff(local_batch_type::lane_count);
+    std::vector<local_uint_type> prod(local_batch_type::lane_count);
+    std::vector<local_uint_type> shl (local_batch_type::lane_count);
+    std::vector<local_uint_type> shr (local_batch_type::lane_count);
+    std::vector<local_uint_type> w   (local_batch_type::lane_count);
+
+    static_cast<void>((bu + bv).copy(sum.begin()));
+    static_cast<void>((bu - bv).copy(diff.begin()));
+    static_cast<void>((bu * bv).copy(prod.begin()));
+    static_cast<void>((bu << 77U).copy(shl.begin()));
+    static_cast<void>((bu >> 77U).copy(shr.begin()));
+
+    const typename local_batch_type::compare_result_type cmp = bu.compare(bv);
+
+    bool local_result_is_ok = true;
+
+    for(auto k = static_cast<std::size_t>(0U); k < local_batch_type::lane_count; ++k)
+    {
+      local_result_is_ok &= (   (sum [k] == (u[k] + v[k]))
+                             && (diff[k] == (u[k] - v[k]))
+                             && (prod[k] == (u[k] * v[k]))
+                             && (shl [k] == (u[k] << 77U))
+                             && (shr [k] == (u[k] >> 77U))
+                             && (cmp [k] == u[k].compare(v[k])));
+    }
+
+    local_result_is_ok &= ((bu.copy(w.begin()) == w.end()) && (w == u) && (local_batch_type(v.cbegin(), v.cend()) == bv) && (bu != bv));
+    local_result_is_ok &= (sum[lane_cy] == 0U);
+
+    if(local_batch_type::lane_count > 3U)
+    {
+      local_result_is_ok &= ((cmp[lane_eq] == 0) && (diff[lane_bw] == (std::numeric_limits<local_uint_type>::max)()));
+    }
+
+    local_result_is_ok &= (((bu << Width2) == local_batch_type()) && ((bu >> (Width2 + 44U)) == local_batch_type()));
+
+    return local_result_is_ok;
+  }
 } // namespace local
 
 auto math::wide_integer::test_uintwide_t_spot_values() -> bool // NOLINT(readability-function-cognitive-complexity)
@@ -549,5 +665,880 @@ auto math::wide_integer::test_uintwide_t_spot_values() -> bool // NOLINT(readabi
     result_is_ok &= ((a % b) == m);
   }
 
+  {
+    // Modular exponentiation with odd moduli, which uses Montgomery multiplication.
+
+    using math::wide_integer::uint256_t;
+
+    //   PowerMod[16^^DA4033C9B1B0675C20B7879EA63FFFBEEBEC3F89F78D22C393FAD98E7AE9BF69,
+    //            16^^A4748AD2DAFEED29C73927BD0945EF45EFEC9DAA95CC59390D406FC27236A174,
+    //            m]
+
+    WIDE_INTEGER_CONSTEXPR uint256_t b ("0xDA4033C9B1B0675C20B7879EA63FFFBEEBEC3F89F78D22C393FAD98E7AE9BF69");
+    WIDE_INTEGER_CONSTEXPR uint256_t p ("0xA4748AD2DAFEED29C73927BD0945EF45EFEC9DAA95CC59390D406FC27236A174");
+    WIDE_INTEGER_CONSTEXPR uint256_t m0("0xB6EC4DAB21E2856D488D669C210DC1FAD00366F92D602B1D42B88E24531F907F");
+    WIDE_INTEGER_CONSTEXPR uint256_t m1("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F");
+    WIDE_INTEGER_CONSTEXPR uint256_t m2("0x1FFFFFFFFFFFFFFF");
+
+    result_is_ok &= (powm(b, p, m0) == "0x616384CA523658E89814C09278DE035BAF28F2AB1EFAC74463AA3BCB67912AA3");
+    result_is_ok &= (powm(b, p, m1) == "0x1F75129CA16580E21319B3224496E8ADCC0A1AFAD7D82F1479343D5177A7E297");
+    result_is_ok &= (powm(b, p, m2) == "0xAA3CD3CEFBA607D");
+
+    const math::wide_integer::montgomery_context<256U> ctx(m0);
+
+    const uint256_t b_mont = ctx.to_montgomery(b);
+
+    result_is_ok &= (ctx.from_montgomery(b_mont) == (b % m0));
+    result_is_ok &= (ctx.mul(b, b) == "0x49E7CBCDE985B55E47910DA76BF1A185F646AF89E582EB2F0FA36EED736C33CA");
+    result_is_ok &= (ctx.from_montgomery(ctx.one()) == 1U);
+
+    for(auto window_bits = static_cast<unsigned>(UINT8_C(1)); window_bits <= static_cast<unsigned>(UINT8_C(5)); ++window_bits)
+    {
+      result_is_ok &= (ctx.pow(b, p, window_bits) == "0x616384CA523658E89814C09278DE035BAF28F2AB1EFAC74463AA3BCB67912AA3");
+    }
+  }
+
+  {
+    // Repeated reduction by a fixed modulus using Barrett reduction.
+
+    using math::wide_integer::uint256_t;
+    using math::wide_integer::uint512_t;
+
+    WIDE_INTEGER_CONSTEXPR uint256_t a("0xDA4033C9B1B0675C20B7879EA63FFFBEEBEC3F89F78D22C393FAD98E7AE9BF69");
+    WIDE_INTEGER_CONSTEXPR uint256_t b("0xA4748AD2DAFEED29C73927BD0945EF45EFEC9DAA95CC59390D406FC27236A174");
+    WIDE_INTEGER_CONSTEXPR uint256_t m("0xB6EC4DAB21E2856D488D669C210DC1FAD00366F92D602B1D42B88E24531F907E");
+
+    const math::wide_integer::barrett_reducer<uint256_t> reducer(m);
+
+    result_is_ok &= ((a % reducer) == "0x2353E61E8FCDE1EED82A210285323DC41BE8D890CA2CF7A651424B6A27CA2EEB");
+    result_is_ok &= ((b % reducer) == b);
+    result_is_ok &= ((uint512_t(a) * uint512_t(b)) % reducer == "0xC961932E708FDFB5051CDA70CE71BE4E6878DA40FF3ABF15BAB173BD946593C");
+
+    std::array<uint256_t, 3U> values = {{ a, b, m }};
+
+    static_cast<void>(reducer.reduce(values.cbegin(), values.cend(), values.begin()));
+
+    result_is_ok &= ((values[0U] == (a % m)) && (values[1U] == b) && (values[2U] == 0U));
+  }
+
+  {
+    // Self-multiplication uses the dedicated squaring kernels.
+
+    using math::wide_integer::uint256_t;
+    using math::wide_integer::uint512_t;
+    using math::wide_integer::uint8192_t;
+
+    WIDE_INTEGER_CONSTEXPR uint256_t a("0xDA4033C9B1B0675C20B7879EA63FFFBEEBEC3F89F78D22C393FAD98E7AE9BF69");
+
+    uint256_t a2(a);
+    uint512_t a4(a);
+
+    a2 *= a2;
+    a4 *= a4;
+
+    result_is_ok &= (a2 == "0xFA2EC3FC997F2BFAEFA7F03BC59DA81C499A549812EEDBFF4BE7FA5A103FD911");
+    result_is_ok &= (a4 == "0xBA11684D71F343F1614F5AEE305A564EACEC9F14D5ABD1EDC4E27056B3543BEBFA2EC3FC997F2BFAEFA7F03BC59DA81C499A549812EEDBFF4BE7FA5A103FD911");
+
+    // Karatsuba squaring compared with the general Karatsuba multiplication.
+    const uint8192_t x = ((std::numeric_limits<uint8192_t>::max)() >> 3U) ^ (uint8192_t(a) << 4000U);
+
+    uint8192_t x_sqr(x);
+    uint8192_t x_mul(x);
+
+    x_sqr *= x_sqr;
+    x_mul *= uint8192_t(x);
+
+    result_is_ok &= (x_sqr == x_mul);
+
+    const math::wide_integer::montgomery_context<256U> ctx(uint256_t("0xB6EC4DAB21E2856D488D669C210DC1FAD00366F92D602B1D42B88E24531F907F"));
+
+    const uint256_t a_mont = ctx.to_montgomery(a);
+
+    result_is_ok &= (ctx.sqr(a_mont) == ctx.mul(a_mont, a_mont));
+  }
+
+  {
+    // Toom-3 multiplication and squaring, which are used above
+    // number_of_limbs_toom3_threshold limbs.
+
+    using local_uint_type = math::wide_integer::uintwide_t<size_t(UINT32_C(65536)), std::uint32_t, std::allocator<void>>;
+
+    static_assert(local_uint_type::number_of_limbs >= local_uint_type::number_of_limbs_toom3_threshold,
+                  "Error: This test is intended for the Toom-3 multiplication");
+
+    constexpr auto half_digits = static_cast<unsigned>(std::numeric_limits<local_uint_type>::digits / 2);
+
+    const local_uint_type half_max = (std::numeric_limits<local_uint_type>::max)() >> half_digits;
+
+    // (2^(n/2) - 1)^2 = 2^n - 2^(n/2 + 1) + 1
+    local_uint_type x(half_max);
+
+    x *= x;
+
+    result_is_ok &= (x == ((local_uint_type(1U) << half_digits) - 1U) * local_uint_type(half_max));
+    result_is_ok &= (x == (((std::numeric_limits<local_uint_type>::max)() - (local_uint_type(1U) << (half_digits + 1U))) + 2U));
+  }
+
+  #if !defined(WIDE_INTEGER_DISABLE_SCRATCH_ARENA)
+  {
+    // The temporaries of multiplication and division draw from the
+    // scratch arena. Its blocks are taken from the allocator during the
+    // first use, after which the allocator is no longer called.
+
+    using local_uint_type = math::wide_integer::uintwide_t<size_t(UINT32_C(65536)), std::uint32_t, local::counting_allocator<void>>;
+
+    local_uint_type a = (std::numeric_limits<local_uint_type>::max)() >> 3U;
+    local_uint_type b = (std::numeric_limits<local_uint_type>::max)() / 7U;
+    local_uint_type c = local_uint_type(UINT32_C(123456789)) << 4000U;
+
+    const std::size_t count_cold = local::counting_allocator_count();
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(2)); ++i)
+    {
+      if(i == 1U)
+      {
+        result_is_ok &= (local::counting_allocator_count() > count_cold);
+      }
+
+      const std::size_t count = local::counting_allocator_count();
+
+      a *= b;
+      b *= b;
+      a /= c;
+
+      result_is_ok &= ((i == 0U) || (local::counting_allocator_count() == count));
+    }
+  }
+  #endif
+
+  {
+    // Karatsuba multiplication of 49 * 4 limbs, whose recursion
+    // reaches an odd number of limbs above the schoolbook base case.
+
+    using local_uint_type = math::wide_integer::uintwide_t<size_t(UINT32_C(6272)), std::uint32_t>;
+
+    static_assert(local_uint_type::number_of_limbs_karatsuba_threshold == math::wide_integer::multiplication_thresholds<std::uint32_t>::karatsuba_threshold,
+                  "Error: The multiplication thresholds are not taken from multiplication_thresholds");
+
+    constexpr auto half_digits = static_cast<unsigned>(std::numeric_limits<local_uint_type>::digits / 2);
+
+    const local_uint_type half_max = (std::numeric_limits<local_uint_type>::max)() >> half_digits;
+
+    local_uint_type x(half_max);
+
+    x *= x;
+
+    result_is_ok &= (x == (((std::numeric_limits<local_uint_type>::max)() - (local_uint_type(1U) << (half_digits + 1U))) + 2U));
+  }
+
+  {
+    // NTT multiplication and squaring, which are used above
+    // number_of_limbs_ntt_threshold limbs.
+
+    using local_uint_type = math::wide_integer::uintwide_t<size_t(UINT32_C(262144)), std::uint32_t, std::allocator<void>>;
+
+    static_assert(local_uint_type::number_of_limbs >= local_uint_type::number_of_limbs_ntt_threshold,
+                  "Error: This test is intended for the NTT multiplication");
+
+    constexpr auto half_digits = static_cast<unsigned>(std::numeric_limits<local_uint_type>::digits / 2);
+
+    const local_uint_type half_max = (std::numeric_limits<local_uint_type>::max)() >> half_digits;
+
+    // (2^(n/2) - 1)^2 = 2^n - 2^(n/2 + 1) + 1
+    local_uint_type x(half_max);
+
+    x *= x;
+
+    result_is_ok &= (x == (((std::numeric_limits<local_uint_type>::max)() - (local_uint_type(1U) << (half_digits + 1U))) + 2U));
+
+    // The low half of the product is retained: (2^n - 1)^2 = 1 mod 2^n.
+    result_is_ok &= (((std::numeric_limits<local_uint_type>::max)() * (std::numeric_limits<local_uint_type>::max)()) == 1U);
+
+    // Without an allocator, the buffers of the transform are taken
+    // from the scratch arena rather than from the stack.
+    using local_uint_void_type = math::wide_integer::uintwide_t<size_t(UINT32_C(262144)), std::uint32_t>;
+
+    local_uint_void_type x_void((std::numeric_limits<local_uint_void_type>::max)() >> half_digits);
+
+    x_void *= x_void;
+
+    result_is_ok &= std::equal(x.crepresentation().cbegin(), x.crepresentation().cend(), x_void.crepresentation().cbegin());
+  }
+
+  {
+    // Fused quotient and remainder, compared with (a / b) and (a % b).
+
+    using math::wide_integer::uint256_t;
+    using math::wide_integer::int256_t;
+
+    WIDE_INTEGER_CONSTEXPR uint256_t a("0xDA4033C9B1B0675C20B7879EA63FFFBEEBEC3F89F78D22C393FAD98E7AE9BF69");
+    WIDE_INTEGER_CONSTEXPR uint256_t b("0xA4748AD2DAFEED29C73927BD0945EF");
+
+    const auto qr = math::wide_integer::divmod(a, b);
+
+    result_is_ok &= ((qr.first == (a / b)) && (qr.second == (a % b)));
+    result_is_ok &= (((qr.first * b) + qr.second) == a);
+
+    const auto qr_limb = math::wide_integer::divmod(a, static_cast<std::uint32_t>(UINT32_C(1000000007)));
+
+    result_is_ok &= ((qr_limb.first == (a / UINT32_C(1000000007))) && (qr_limb.second == (a % UINT32_C(1000000007))));
+
+    const auto qr_zero = math::wide_integer::divmod(a, uint256_t(0U));
+
+    result_is_ok &= ((qr_zero.first == (a / uint256_t(0U))) && (qr_zero.second == (a % uint256_t(0U))));
+
+    const auto qr_limb_zero = math::wide_integer::divmod(a, static_cast<std::uint32_t>(UINT32_C(0)));
+
+    result_is_ok &= ((qr_limb_zero.first == (std::numeric_limits<uint256_t>::max)()) && (qr_limb_zero.second == 0U));
+
+    const int256_t sa(a >> 1U);
+    const int256_t sb(b);
+
+    for(const auto& num_den : { std::make_pair(sa, sb), std::make_pair(-sa, sb), std::make_pair(sa, -sb), std::make_pair(-sa, -sb) })
+    {
+      const auto sqr = math::wide_integer::divmod(num_den.first, num_den.second);
+
+      result_is_ok &= ((sqr.first == (num_den.first / num_den.second)) && (sqr.second == (num_den.first % num_den.second)));
+      result_is_ok &= (((sqr.first * num_den.second) + sqr.second) == num_den.first);
+    }
+
+    const auto sqr_limb = math::wide_integer::divmod(-sa, static_cast<std::uint32_t>(UINT32_C(1000000007)));
+
+    result_is_ok &= ((sqr_limb.first == (-sa / UINT32_C(1000000007))) && (sqr_limb.second == (-sa % UINT32_C(1000000007))));
+
+    #if(WIDE_INTEGER_CONSTEXPR_IS_COMPILE_TIME_CONST == 1)
+    static_assert(math::wide_integer::divmod(a, b).first  == (a / b), "Error: Static check of divmod fails");
+    static_assert(math::wide_integer::divmod(a, b).second == (a % b), "Error: Static check of divmod fails");
+    #endif
+  }
+
+  {
+    // Division by invariant single-limb divisors having a precomputed reciprocal.
+
+    using math::wide_integer::uint256_t;
+    using math::wide_integer::int256_t;
+
+    using local_limb_divisor_type = math::wide_integer::limb_divisor<uint256_t::limb_type>;
+
+    WIDE_INTEGER_CONSTEXPR uint256_t a("0xDA4033C9B1B0675C20B7879EA63FFFBEEBEC3F89F78D22C393FAD98E7AE9BF69");
+
+    for(const auto d : { UINT32_C(1), UINT32_C(3), UINT32_C(10), UINT32_C(1000000007), UINT32_C(0x80000000), UINT32_C(0xFFFFFFFF) })
+    {
+      const local_limb_divisor_type ld(d);
+
+      result_is_ok &= ((ld.divisor() == d) && ((ld.normalized() >> 31U) == 1U));
+
+      uint256_t q(a);
+
+      const auto r = q.divide_by(ld);
+
+      result_is_ok &= ((q == (a / d)) && (r == (a % d)));
+
+      int256_t sq(-int256_t(a >> 1U));
+
+      const auto sr = sq.divide_by(ld);
+
+      result_is_ok &= ((sq == (-int256_t(a >> 1U) / d)) && (sr == (-int256_t(a >> 1U) % d)));
+    }
+
+    // Division of a small value having leading zero limbs.
+    uint256_t q_small(UINT32_C(123456789));
+
+    result_is_ok &= ((q_small.divide_by(local_limb_divisor_type(UINT32_C(10))) == 9U) && (q_small == UINT32_C(12345678)));
+
+    // The decimal string representation divides by the limb divisor 10.
+    std::stringstream strm;
+
+    strm << a;
+
+    result_is_ok &= (strm.str() == "98717636630023699597280645681121625821676232532841814333262250038863357132649");
+  }
+
+  {
+    // Decimal output of a wide type that is converted by divide and conquer.
+
+    using local_uint_type = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(8192)), std::uint32_t, std::allocator<void>>;
+
+    for(const auto k : { 1U, 19U, 311U, 1234U, 2466U })
+    {
+      local_uint_type p10(1U);
+
+      for(auto i = 0U; i < k; ++i) { p10 *= 10U; }
+
+      std::stringstream strm_p10;
+      std::stringstream strm_nines;
+
+      strm_p10   << p10;
+      strm_nines << (p10 - 1U);
+
+      // Powers of ten have long runs of zeros to be padded within each part.
+      std::string str_p10(std::string::size_type(k + 1U), '0');
+
+      str_p10[0U] = '1';
+
+      result_is_ok &= (strm_p10.str()   == str_p10);
+      result_is_ok &= (strm_nines.str() == std::string(k, '9'));
+    }
+
+    const local_uint_type x = ((std::numeric_limits<local_uint_type>::max)() / 3U) >> 7U;
+
+    std::stringstream strm;
+
+    strm << x;
+
+    result_is_ok &= (local_uint_type(strm.str().c_str()) == x);
+  }
+
+  {
+    // Decimal and hexadecimal input converted in chunks, with and without delimiters.
+
+    using math::wide_integer::uint256_t;
+    using math::wide_integer::int256_t;
+
+    const uint256_t a("98717636630023699597280645681121625821676232532841814333262250038863357132649");
+    const uint256_t b("98'717'636'630'023'699'597'280'645'681'121'625'821'676'232'532'841'814'333'262'250'038'863'357'132'649");
+    const uint256_t c("0xDA4033C9B1B0675C20B7879EA63FFFBEEBEC3F89F78D22C393FAD98E7AE9BF69");
+    const uint256_t d("0xda40'33c9'b1b0'675c'20b7'879e'a63f'ffbe'ebec'3f89'f78d'22c3'93fa'd98e'7ae9'bf69");
+
+    result_is_ok &= ((a == b) && (a == c) && (a == d));
+
+    result_is_ok &= (int256_t("-123456789012345678901234567890") == -int256_t("0x18EE90FF6C373E0EE4E3F0AD2"));
+
+    // A non-digit within a block of eight digits is rejected.
+    result_is_ok &= (uint256_t("1234567890123456789012345678:0") == (std::numeric_limits<uint256_t>::max)());
+    result_is_ok &= (uint256_t("0x1234567g")                     == (std::numeric_limits<uint256_t>::max)());
+
+    // Long strings of digits are converted by divide and conquer.
+    using local_uint_type = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(65536)), std::uint32_t, std::allocator<void>>;
+
+    std::string str_digits;
+
+    for(auto i = 0U; i < 1972U; ++i) { str_digits += "1234567890"; }
+
+    const local_uint_type x(str_digits.c_str());
+
+    std::stringstream strm;
+
+    strm << x;
+
+    result_is_ok &= (strm.str() == str_digits);
+  }
+
+  #if !defined(WIDE_INTEGER_DISABLE_TO_CHARS)
+  {
+    // Character conversion in the manner of std::to_chars and std::from_chars.
+
+    using math::wide_integer::uint256_t;
+    using math::wide_integer::int256_t;
+
+    const int256_t a("-49358818315011849798640322840560812910838116266420907166631125019431678566324");
+
+    std::array<char, static_cast<std::size_t>(UINT8_C(128))> buf { };
+
+    const auto result_to_dec = math::wide_integer::to_chars(buf.data(), buf.data() + buf.size(), a);
+
+    result_is_ok &= (   (result_to_dec.ec == std::errc())
+                     && (std::string(buf.data(), result_to_dec.ptr) == "-49358818315011849798640322840560812910838116266420907166631125019431678566324"));
+
+    int256_t b;
+
+    const auto result_from_dec = math::wide_integer::from_chars(buf.data(), result_to_dec.ptr, b);
+
+    result_is_ok &= ((result_from_dec.ec == std::errc()) && (result_from_dec.ptr == result_to_dec.ptr) && (b == a));
+
+    const auto result_to_hex = math::wide_integer::to_chars(buf.data(), buf.data() + buf.size(), uint256_t(-a), 16);
+
+    result_is_ok &= (   (result_to_hex.ec == std::errc())
+                     && (std::string(buf.data(), result_to_hex.ptr) == "6d2019e4d8d833ae105bc3cf531fffdf75f61fc4fbc69161c9fd6cc73d74dfb4"));
+
+    // Other bases, and the digits are followed by a non-digit.
+    const std::string str_base36("zz9e8y,");
+
+    uint256_t c;
+
+    const auto result_from_36 = math::wide_integer::from_chars(str_base36.data(), str_base36.data() + str_base36.size(), c, 36);
+
+    result_is_ok &= ((result_from_36.ec == std::errc()) && (*result_from_36.ptr == ',') && (c == UINT32_C(2175541090)));
+
+    // The output range is too small.
+    const auto result_too_small = math::wide_integer::to_chars(buf.data(), buf.data() + 8U, a, 10);
+
+    result_is_ok &= ((result_too_small.ec == std::errc::value_too_large) && (result_too_small.ptr == buf.data() + 8U));
+
+    // The value is out of range and is left unchanged.
+    const std::string str_too_large("57896044618658097711785492504343953926634992332820282019728792003956564819968");
+
+    const auto result_too_large = math::wide_integer::from_chars(str_too_large.data(), str_too_large.data() + str_too_large.size(), b);
+
+    result_is_ok &= ((result_too_large.ec == std::errc::result_out_of_range) && (b == a));
+
+    // The negated value, on the other hand, is the minimum of the signed type.
+    const std::string str_min("-" + str_too_large);
+
+    const auto result_min = math::wide_integer::from_chars(str_min.data(), str_min.data() + str_min.size(), b);
+
+    result_is_ok &= ((result_min.ec == std::errc()) && (b == (std::numeric_limits<int256_t>::min)()));
+
+    // No digits at all, or a plus sign.
+    const std::string str_plus("+1");
+
+    const auto result_plus = math::wide_integer::from_chars(str_plus.data(), str_plus.data() + str_plus.size(), c);
+
+    result_is_ok &= ((result_plus.ec == std::errc::invalid_argument) && (result_plus.ptr == str_plus.data()));
+  }
+
+  {
+    // The internal decimal buffer holds all 315653 digits of 2^(2^20) - 1,
+    // which ends in the digit 5.
+
+    using local_uint_type = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(1048576)), std::uint32_t, std::allocator<void>>;
+
+    std::vector<char> buf(static_cast<std::size_t>(UINT32_C(315653)));
+
+    const auto result_exact = math::wide_integer::to_chars(buf.data(), buf.data() + buf.size(), (std::numeric_limits<local_uint_type>::max)(), 10);
+    const auto result_short = math::wide_integer::to_chars(buf.data(), buf.data() + (buf.size() - 1U), (std::numeric_limits<local_uint_type>::max)(), 10);
+
+    result_is_ok &= ((result_exact.ec == std::errc()) && (result_exact.ptr == (buf.data() + buf.size())) && (buf.back() == '5'));
+    result_is_ok &= (result_short.ec == std::errc::value_too_large);
+  }
+  #endif
+
+  {
+    // Export and import of the bytes of the representation.
+
+    using math::wide_integer::uint256_t;
+    using math::wide_integer::int256_t;
+
+    const uint256_t a("0x00000000000000000102030405060708090A0B0C0D0E0F101112131415161718");
+
+    std::array<std::uint8_t, static_cast<std::size_t>(UINT8_C(40))> buf { };
+
+    // Only the significant bytes, most significant byte first.
+    const auto end_msv = math::wide_integer::export_bytes(a, buf.data(), buf.data() + buf.size());
+
+    result_is_ok &= ((end_msv == buf.data() + 24U) && (buf[0U] == UINT8_C(1)) && (buf[23U] == UINT8_C(0x18)));
+
+    uint256_t b;
+
+    result_is_ok &= (math::wide_integer::import_bytes(b, buf.data(), end_msv) && (b == a));
+
+    // A fixed width, least significant byte first and sign-extended beyond the width.
+    const auto end_lsv = math::wide_integer::export_bytes(int256_t(-1), buf.data(), buf.data() + buf.size(), false, true);
+
+    result_is_ok &= ((end_lsv == buf.data() + buf.size()) && (std::count(buf.cbegin(), buf.cend(), UINT8_C(0xFF)) == 40));
+
+    const auto end_lsv_a = math::wide_integer::export_bytes(a, buf.data(), buf.data() + 32U, false, true);
+
+    result_is_ok &= ((end_lsv_a == buf.data() + 32U) && (buf[0U] == UINT8_C(0x18)) && (buf[23U] == UINT8_C(1)) && (buf[24U] == UINT8_C(0)));
+
+    result_is_ok &= (math::wide_integer::import_bytes(b, buf.data(), end_lsv_a, false) && (b == a));
+
+    // The range is too small for the significant bytes.
+    result_is_ok &= (math::wide_integer::export_bytes(a, buf.data(), buf.data() + 23U) == nullptr);
+
+    // Nonzero bytes beyond the width of the value (here, the bytes 0xFF
+    // remaining from the sign extension) are reported, and the value
+    // is left unchanged.
+    b = 3U;
+
+    result_is_ok &= ((!math::wide_integer::import_bytes(b, buf.data(), buf.data() + buf.size(), false)) && (b == 3U));
+
+    // Zero bytes beyond the width of the value are dropped.
+    std::fill(buf.begin() + 32U, buf.end(), UINT8_C(0));
+
+    result_is_ok &= (math::wide_integer::import_bytes(b, buf.data(), buf.data() + buf.size(), false) && (b == a));
+
+    // A negative signed value round-trips through a fixed width
+    // larger than the type, since the sign extension is accepted.
+    const int256_t n(-5);
+
+    int256_t m;
+
+    result_is_ok &= (math::wide_integer::export_bytes(n, buf.data(), buf.data() + buf.size(), true, true) == buf.data() + buf.size());
+    result_is_ok &= (math::wide_integer::import_bytes(m, buf.data(), buf.data() + buf.size()) && (m == n));
+
+    result_is_ok &= (math::wide_integer::export_bytes(n, buf.data(), buf.data() + buf.size(), false, true) == buf.data() + buf.size());
+    result_is_ok &= (math::wide_integer::import_bytes(m, buf.data(), buf.data() + buf.size(), false) && (m == n));
+
+    // For the unsigned type, the bytes 0xFF of the sign extension are not dropped.
+    b = 3U;
+
+    result_is_ok &= ((!math::wide_integer::import_bytes(b, buf.data(), buf.data() + buf.size(), false)) && (b == 3U));
+
+    // Bytes 0xFF beyond the width of a positive signed value are not its sign extension.
+    const int256_t p(5);
+
+    static_cast<void>(math::wide_integer::export_bytes(p, buf.data(), buf.data() + buf.size(), false, true));
+
+    std::fill(buf.begin() + 32U, buf.end(), UINT8_C(0xFF));
+
+    m = 3;
+
+    result_is_ok &= ((!math::wide_integer::import_bytes(m, buf.data(), buf.data() + buf.size(), false)) && (m == 3));
+  }
+
+  {
+    // Views of externally owned limbs.
+
+    using local_uint_type = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t, void, false>;
+
+    using local_view_type       = math::wide_integer::uintwide_view<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t>;
+    using local_const_view_type = math::wide_integer::uintwide_view<static_cast<math::wide_integer::size_t>(UINT32_C(256)), const std::uint32_t>;
+
+    std::array<std::uint32_t, static_cast<std::size_t>(UINT8_C(16))> limbs =
+    {{
+      UINT32_C(0x00000001), UINT32_C(0x00000000), UINT32_C(0x00000000), UINT32_C(0x00000000),
+      UINT32_C(0x00000000), UINT32_C(0x00000000), UINT32_C(0x00000000), UINT32_C(0x80000000),
+      UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF),
+      UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF), UINT32_C(0x7FFFFFFF)
+    }};
+
+    const local_uint_type a("0x8000000000000000000000000000000000000000000000000000000000000001");
+    const local_uint_type b("0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+
+    local_view_type             va(limbs.data());
+    const local_const_view_type vb(limbs.data() + 8U);
+
+    result_is_ok &= ((va == a) && (vb == b) && (vb < va) && (a > vb) && (static_cast<local_uint_type>(vb) == b));
+    result_is_ok &= ((msb(va) == 255U) && (lsb(va) == 0U) && (msb(vb) == 254U));
+    result_is_ok &= ((static_cast<std::uint64_t>(va) == UINT64_C(1)) && ((vb % 10U) == static_cast<std::uint32_t>(b % 10U)));
+
+    // In-place arithmetic writes through to the limbs.
+    va += vb;
+
+    result_is_ok &= ((limbs[0U] == UINT32_C(0)) && (limbs[7U] == UINT32_C(0)) && va.is_zero());
+
+    va -= a;
+    va >>= 1U;
+    va <<= 2U;
+
+    result_is_ok &= ((va == ((b >> 1U) << 2U)) && (limbs[0U] == UINT32_C(0xFFFFFFFC)));
+  }
+
+  {
+    // GCD with (mostly) Lehmer steps, also having a zero argument.
+
+    using local_uint_type = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(2048)), std::uint32_t, void, false>;
+
+    const local_uint_type a("0xF123456789ABCDEF0123456789ABCDEF");
+
+    result_is_ok &= ((gcd(a, local_uint_type(0U)) == a) && (gcd(local_uint_type(0U), a) == a));
+
+    // Consecutive Fibonacci numbers have only quotients of one.
+    local_uint_type f0(1U);
+    local_uint_type f1(1U);
+
+    while(msb(f1) < 1900U)
+    {
+      const local_uint_type f2 = f0 + f1;
+
+      f0 = f1;
+      f1 = f2;
+    }
+
+    result_is_ok &= ((gcd(f1, f0) == 1U) && (gcd(f1 * a, f0 * a) == a));
+
+    // Here gcd(2^m + 1, 2^n + 1) = 2^gcd(m, n) + 1, since m / gcd(m, n)
+    // and n / gcd(m, n) are odd.
+    const local_uint_type b = ((local_uint_type(1U) << 1900U) + 1U);
+    const local_uint_type c = ((local_uint_type(1U) << 1500U) + 1U);
+
+    result_is_ok &= ((gcd(b, c) == ((local_uint_type(1U) << 100U) + 1U)) && (gcd(a * b, a * c) == (a * gcd(b, c))));
+    result_is_ok &= (lcm(f1 >> 1024U, f0 >> 1024U) == ((f1 >> 1024U) * (f0 >> 1024U)) / gcd(f1 >> 1024U, f0 >> 1024U));
+  }
+
+  {
+    // Extended GCD and modular inverse, also for negative arguments.
+
+    using local_int_type = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(2048)), std::uint32_t, void, true>;
+
+    const local_int_type g("0xF123456789ABCDEF0123456789ABCDEF");
+
+    local_int_type f0(1);
+    local_int_type f1(1);
+
+    while(msb(f1) < 900U)
+    {
+      const local_int_type f2 = f0 + f1;
+
+      f0 = f1;
+      f1 = f2;
+    }
+
+    const local_int_type a =  (f1 * g);
+    const local_int_type b = -(f0 * g);
+
+    const auto r = xgcd(a, b);
+
+    result_is_ok &= ((std::get<0>(r) == g) && (((std::get<1>(r) * a) + (std::get<2>(r) * b)) == g));
+
+    const auto r0 = xgcd(a, local_int_type(0));
+
+    result_is_ok &= ((std::get<0>(r0) == a) && (std::get<1>(r0) == 1) && (std::get<2>(r0) == 0));
+
+    // The modulus m = 2^607 - 1 is a Mersenne prime.
+    const local_int_type m = ((local_int_type(1) << 607U) - 1);
+
+    const local_int_type a_inv     = invmod(a, m);
+    const local_int_type neg_a_inv = invmod(-a, m);
+
+    result_is_ok &= ((((a_inv * a) % m) == 1) && ((a_inv + neg_a_inv) == m));
+    result_is_ok &= ((invmod(a, b) == 0) && (((invmod(f1, f0) * f1) % f0) == 1));
+    result_is_ok &= ((invmod_ct(a % m, m) == a_inv) && (invmod_ct(g, g * 3) == 0));
+  }
+
+  {
+    // Branch-free comparison, selection and reduction, and the Montgomery
+    // ladder for exponentiation, compared with their usual counterparts.
+
+    using local_uint_type = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t, void, false>;
+    using local_int_type  = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t, void, true>;
+
+    namespace const_time = math::wide_integer::const_time;
+
+    const local_uint_type a("0xF123456789ABCDEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF");
+    const local_uint_type b("0xF123456789ABCDEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEE");
+
+    result_is_ok &= (const_time::less(b, a) && (!const_time::less(a, b)) && (!const_time::less(a, a)));
+    result_is_ok &= ((const_time::compare(a, b) == 1) && (const_time::compare(b, a) == -1) && (const_time::compare(a, a) == 0));
+    result_is_ok &= (const_time::equal(a, a) && (!const_time::equal(a, b)) && const_time::is_zero(a - a) && (!const_time::is_zero(a)));
+    result_is_ok &= ((const_time::select(true, a, b) == a) && (const_time::select(false, a, b) == b));
+
+    const local_int_type c(-1);
+    const local_int_type d(1);
+
+    result_is_ok &= (const_time::less(c, d) && (const_time::compare(d, c) == 1));
+
+    local_uint_type x(a);
+    local_uint_type y(b);
+
+    const_time::cswap(false, x, y);
+    result_is_ok &= ((x == a) && (y == b));
+
+    const_time::cswap(true, x, y);
+    result_is_ok &= ((x == b) && (y == a));
+
+    // The modulus m = 2^255 - 19 is prime.
+    const local_uint_type m((local_uint_type(1U) << 255U) - 19U);
+
+    result_is_ok &= ((const_time::mod(a, m) == (a % m)) && (const_time::mod(a, b) == 1U) && (const_time::mod(m, a) == m));
+
+    result_is_ok &= (powm_ct(a, b, m) == powm(a, b, m));
+    result_is_ok &= ((powm_ct(a, 0U, m) == 1U) && (powm_ct(a, m - 2U, m) == invmod(a, m)));
+  }
+
+  {
+    // Prime search with the sieve front-end and batched Miller-Rabin tests,
+    // using two threads. The modulus 2^127 - 1 is a Mersenne prime.
+
+    using local_uint_type = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t, void, false>;
+
+    using local_distribution_type = math::wide_integer::uniform_int_distribution<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t, void, false>;
+
+    static const math::wide_integer::small_prime_table<> table;
+
+    local_distribution_type distribution;
+
+    std::mt19937 generator; // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    const local_uint_type p127 = (local_uint_type(1U) << 127U);
+    const local_uint_type p255 = (local_uint_type(1U) << 255U);
+
+    result_is_ok &= (find_next_prime(p127,                  25U, distribution, generator, table, 2U) == (p127 + 29U));
+    result_is_ok &= (find_next_prime(p255 - 60U,            25U, distribution, generator, table, 2U) == (p255 - 31U));
+    result_is_ok &= (find_next_prime(local_uint_type(1000U), 25U, distribution, generator, table, 2U) == 1009U);
+
+    const std::array<local_uint_type, 6U> candidates = {{ p127 - 1U, p127 + 29U, p127 + 1U, local_uint_type(1009U), local_uint_type(1011U), local_uint_type(2U) }};
+
+    std::array<std::uint8_t, 6U> results { };
+
+    miller_rabin_batch(candidates.cbegin(), candidates.cend(), results.begin(), 25U, distribution, generator, table, 2U);
+
+    const std::array<std::uint8_t, 6U> control = {{ 1U, 1U, 0U, 1U, 0U, 1U }};
+
+    result_is_ok &= (results == control);
+  }
+
+  {
+    // Baillie-PSW on primes and on pseudoprimes of its two parts:
+    // 3825123056546413051 = 149491 * 747451 * 34233211 is a strong
+    // pseudoprime to base 2 and 161027 = 283 * 569 is a strong Lucas
+    // pseudoprime, both without factors up to 227.
+
+    using local_uint_type = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t, void, false>;
+    using local_int_type  = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t, void, true>;
+
+    const local_uint_type p127((local_uint_type(1U) << 127U) - 1U);
+    const local_uint_type p255((local_uint_type(1U) << 255U) - 19U);
+
+    result_is_ok &= (baillie_psw(p127) && baillie_psw(p255) && baillie_psw(local_uint_type(2U)) && baillie_psw(local_uint_type(227U)));
+    result_is_ok &= ((!baillie_psw(local_uint_type(0U))) && (!baillie_psw(local_uint_type(1U))) && (!baillie_psw(p127 * p127)));
+    result_is_ok &= ((!baillie_psw(local_uint_type("3825123056546413051"))) && (!baillie_psw(local_uint_type(UINT32_C(161027)))));
+    result_is_ok &= (baillie_psw(-local_int_type(p127)) && (!baillie_psw(-local_int_type(p127 * 3U))));
+  }
+
+  {
+    // Restricted (also signed and single-valued) ranges of the uniform
+    // distribution, with generators of 32 bits, 64 bits and of a range
+    // that is not a power of two, and bulk generation with generate_n.
+
+    using local_uint_type = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t, void, false>;
+    using local_int_type  = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t, void, true>;
+
+    using local_uint_distribution_type = math::wide_integer::uniform_int_distribution<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t, void, false>;
+    using local_int_distribution_type  = math::wide_integer::uniform_int_distribution<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t, void, true>;
+
+    std::mt19937     generator32; // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::mt19937_64  generator64; // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::minstd_rand generator31; // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    const local_uint_type a((local_uint_type(1U) << 200U) + 7U);
+    const local_uint_type b(a + (local_uint_type(1U) << 100U));
+
+    local_uint_distribution_type distribution_ab(a, b);
+    local_uint_distribution_type distribution_01(0U, 1U);
+    local_uint_distribution_type distribution_33(3U, 3U);
+    local_int_distribution_type  distribution_pm(-5, 5);
+
+    local_uint_type x_or(0U);
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(64)); ++i)
+    {
+      const local_uint_type x = distribution_ab(generator32);
+      const local_uint_type y = distribution_01(generator31);
+      const local_int_type  z = distribution_pm(generator64);
+
+      x_or |= y;
+
+      result_is_ok &= ((x >= a) && (x <= b) && (y <= 1U) && (z >= -5) && (z <= 5) && (distribution_33(generator32) == 3U));
+    }
+
+    result_is_ok &= (x_or == 1U);
+
+    std::array<local_uint_type, 64U> values { };
+
+    local_uint_distribution_type distribution;
+
+    distribution.generate_n(values.begin(), values.end(), generator64);
+
+    local_uint_type values_and((std::numeric_limits<local_uint_type>::max)());
+    local_uint_type values_or (0U);
+
+    for(const auto& v : values)
+    {
+      values_and &= v;
+      values_or  |= v;
+    }
+
+    // The bits of 64 random values are all set in at least
+    // one value and clear in at least one value (with certainty
+    // of about 1 - 2^-55).
+    result_is_ok &= ((values_and == 0U) && (values_or == (std::numeric_limits<local_uint_type>::max)()));
+
+    distribution.generate_n(values.begin(), values.end(), generator32, distribution_ab.param());
+
+    result_is_ok &= std::all_of(values.cbegin(), values.cend(), [&a, &b](const local_uint_type& v) { return ((v >= a) && (v <= b)); });
+  }
+
+  {
+    // The lane-parallel arithmetic of uintwide_batch agrees with
+    // the arithmetic of the single values. The lane counts of 7, 9,
+    // 11 and 17 leave lanes beyond the last full vector of the
+    // vector kernels (of 4 or 8 lanes), and a single lane has no
+    // full vector at all.
+
+    result_is_ok &= local::test_uintwide_batch<static_cast<math::wide_integer::size_t>(UINT32_C( 256)), std::uint32_t, static_cast<math::wide_integer::size_t>(UINT8_C( 1))>();
+    result_is_ok &= local::test_uintwide_batch<static_cast<math::wide_integer::size_t>(UINT32_C( 256)), std::uint32_t, static_cast<math::wide_integer::size_t>(UINT8_C( 7))>();
+    result_is_ok &= local::test_uintwide_batch<static_cast<math::wide_integer::size_t>(UINT32_C( 256)), std::uint32_t, static_cast<math::wide_integer::size_t>(UINT8_C(11))>();
+    result_is_ok &= local::test_uintwide_batch<static_cast<math::wide_integer::size_t>(UINT32_C( 512)), std::uint32_t, static_cast<math::wide_integer::size_t>(UINT8_C(17))>();
+    result_is_ok &= local::test_uintwide_batch<static_cast<math::wide_integer::size_t>(UINT32_C(4096)), std::uint32_t, static_cast<math::wide_integer::size_t>(UINT8_C( 9))>();
+
+    #if defined(WIDE_INTEGER_HAS_LIMB_TYPE_UINT64)
+    result_is_ok &= local::test_uintwide_batch<static_cast<math::wide_integer::size_t>(UINT32_C( 256)), std::uint64_t, static_cast<math::wide_integer::size_t>(UINT8_C( 1))>();
+    result_is_ok &= local::test_uintwide_batch<static_cast<math::wide_integer::size_t>(UINT32_C( 256)), std::uint64_t, static_cast<math::wide_integer::size_t>(UINT8_C( 7))>();
+    result_is_ok &= local::test_uintwide_batch<static_cast<math::wide_integer::size_t>(UINT32_C( 512)), std::uint64_t, static_cast<math::wide_integer::size_t>(UINT8_C( 9))>();
+    result_is_ok &= local::test_uintwide_batch<static_cast<math::wide_integer::size_t>(UINT32_C(4096)), std::uint64_t, static_cast<math::wide_integer::size_t>(UINT8_C(17))>();
+    #endif
+  }
+
+  {
+    // The parallel algorithms agree with the sequential algorithms
+    // of the standard library. The pool of three workers is used
+    // even on a single core, and the transform starts nested jobs.
+
+    using local_uint_type = math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t>;
+
+    std::mt19937_64 generator; // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    math::wide_integer::uniform_int_distribution<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint32_t> distribution;
+
+    std::vector<local_uint_type> u(static_cast<std::size_t>(UINT16_C(1000)));
+    std::vector<local_uint_type> v(u.size());
+
+    distribution.generate_n(u.begin(), u.end(), generator);
+    distribution.generate_n(v.begin(), v.end(), generator);
+
+    math::wide_integer::parallel::thread_pool pool(3U);
+
+    std::vector<local_uint_type> w_par(u.size());
+    std::vector<local_uint_type> w_seq(u.size());
+
+    const auto op_sum_of_three =
+      [&pool](const local_uint_type& a)
+      {
+        const std::array<local_uint_type, 3U> three { a, a, a };
+
+        return math::wide_integer::parallel::accumulate(pool, three.cbegin(), three.cend(), local_uint_type(0U));
+      };
+
+    math::wide_integer::parallel::transform(pool, u.cbegin(), u.cend(), w_par.begin(), op_sum_of_three);
+
+    std::transform(u.cbegin(), u.cend(), w_seq.begin(), [](const local_uint_type& a) { return a * 3U; });
+
+    result_is_ok &= (w_par == w_seq);
+
+    math::wide_integer::parallel::transform(pool, u.cbegin(), u.cend(), v.cbegin(), w_par.begin(), std::minus<local_uint_type>());
+
+    std::transform(u.cbegin(), u.cend(), v.cbegin(), w_seq.begin(), std::minus<local_uint_type>());
+
+    result_is_ok &= (w_par == w_seq);
+
+    result_is_ok &= (math::wide_integer::parallel::accumulate(pool, u.cbegin(), u.cend(), local_uint_type(1U)) == std::accumulate(u.cbegin(), u.cend(), local_uint_type(1U)));
+
+    result_is_ok &= (math::wide_integer::parallel::accumulate(pool, u.cbegin(), u.cend(), local_uint_type(3U), std::multiplies<local_uint_type>()) == std::accumulate(u.cbegin(), u.cend(), local_uint_type(3U), std::multiplies<local_uint_type>()));
+
+    result_is_ok &= (math::wide_integer::parallel::inner_product(pool, u.cbegin(), u.cend(), v.cbegin(), local_uint_type(5U)) == std::inner_product(u.cbegin(), u.cend(), v.cbegin(), local_uint_type(5U)));
+
+    // An odd modulus (with a Montgomery context) and an even modulus.
+    const local_uint_type m_odd  = (local_uint_type(1U) << 255U) - 19U;
+    const local_uint_type m_even = m_odd + 1U;
+
+    for(const auto& m : { m_odd, m_even })
+    {
+      const auto w_end = math::wide_integer::parallel::powm_each(pool, u.cbegin(), u.cbegin() + 100, w_par.begin(), v.front(), m);
+
+      std::transform(u.cbegin(), u.cbegin() + 100, w_seq.begin(), [&v, &m](const local_uint_type& a) { return powm(a, v.front(), m); });
+
+      result_is_ok &= ((w_end == (w_par.begin() + 100)) && std::equal(w_par.begin(), w_end, w_seq.begin()));
+    }
+
+    // An exception thrown by the operation is rethrown by the
+    // algorithm, after which the pool is still usable.
+    bool exception_is_rethrown = false;
+
+    try
+    {
+      math::wide_integer::parallel::transform(pool, u.cbegin(), u.cend(), w_par.begin(), [&u](const local_uint_type& a) -> local_uint_type { if(&a == &u.back()) { throw std::runtime_error("op"); } return a; });
+    }
+    catch(const std::runtime_error&)
+    {
+      exception_is_rethrown = true;
+    }
+
+    math::wide_integer::parallel::transform(pool, u.cbegin(), u.cend(), w_par.begin(), [](const local_uint_type& a) { return a; });
+
+    result_is_ok &= (exception_is_rethrown && (w_par == u));
+  }
+
   return result_is_ok;
 }